@@ -0,0 +1,208 @@
+#include "system_bench.h"
+#include "engine/resource/resource_manager.h"
+#include "game/factory/blueprint_manager.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <SDL3/SDL.h>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#ifndef MONSTERWAR_VERSION
+#define MONSTERWAR_VERSION "unknown"
+#endif
+#ifndef MONSTERWAR_BUILD_TYPE
+#define MONSTERWAR_BUILD_TYPE "unknown"
+#endif
+
+/*
+ * MonsterWar-bench：ECS系统微基准测试
+ *
+ * 用法：MonsterWar-bench [选项]
+ *   --scales 250,1000,4000   各轮测试的敌人数量 (玩家、投射物、瓦片按比例生成)
+ *   --iterations 200         每个系统计时的迭代次数
+ *   --warmup 10              预热次数
+ *   --seed 12345             生成世界的随机数种子
+ *   --filter Block           只运行名称中包含此字符串的系统
+ *   --label <文本>           写入结果文件的标签 (例如提交哈希)
+ *   --output <路径>          结果文件路径 (默认 bench_results.json，"-" 表示输出到标准输出)
+ */
+
+namespace {
+
+struct CommandLine {
+    bench::BenchOptions options_;
+    std::string label_;
+    std::string output_{"bench_results.json"};
+};
+
+std::vector<int> parseScales(std::string_view text) {
+    std::vector<int> scales;
+    std::stringstream stream{std::string(text)};
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (item.empty()) continue;
+        scales.push_back(std::max(1, std::stoi(item)));
+    }
+    return scales;
+}
+
+std::optional<CommandLine> parseCommandLine(int argc, char* argv[]) {
+    CommandLine command_line;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string_view arg = argv[i];
+            if (i + 1 >= argc) {
+                spdlog::error("missing value for argument: {}", arg);
+                return std::nullopt;
+            }
+            std::string_view value = argv[++i];
+            if (arg == "--scales") {
+                command_line.options_.scales_ = parseScales(value);
+            } else if (arg == "--iterations") {
+                command_line.options_.iterations_ = std::max(1, std::stoi(std::string(value)));
+            } else if (arg == "--warmup") {
+                command_line.options_.warmup_ = std::max(0, std::stoi(std::string(value)));
+            } else if (arg == "--seed") {
+                command_line.options_.seed_ = static_cast<std::uint32_t>(std::stoul(std::string(value)));
+            } else if (arg == "--filter") {
+                command_line.options_.filter_ = value;
+            } else if (arg == "--label") {
+                command_line.label_ = value;
+            } else if (arg == "--output") {
+                command_line.output_ = value;
+            } else {
+                spdlog::error("unknown argument: {}", arg);
+                return std::nullopt;
+            }
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("invalid argument: {}", e.what());
+        return std::nullopt;
+    }
+    if (command_line.options_.scales_.empty()) {
+        spdlog::error("no scales given");
+        return std::nullopt;
+    }
+    return command_line;
+}
+
+/**
+ * @brief 不创建窗口的SDL环境 (软件渲染器 + 哑音频设备)。
+ *
+ * 只用于构造资源管理器 (实体工厂 -> 蓝图管理器 -> 资源管理器)，测试中不会加载任何资源。
+ */
+class HeadlessRuntime final {
+    SDL_Surface* surface_{nullptr};
+    SDL_Renderer* renderer_{nullptr};
+
+public:
+    HeadlessRuntime() {
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+        if (!SDL_Init(SDL_INIT_AUDIO)) {
+            throw std::runtime_error("SDL_Init failed: " + std::string(SDL_GetError()));
+        }
+        surface_ = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_RGBA8888);
+        renderer_ = surface_ ? SDL_CreateSoftwareRenderer(surface_) : nullptr;
+        if (!renderer_) {
+            std::string error = SDL_GetError();
+            if (surface_) SDL_DestroySurface(surface_);
+            SDL_Quit();
+            throw std::runtime_error("create software renderer failed: " + error);
+        }
+    }
+
+    ~HeadlessRuntime() {
+        SDL_DestroyRenderer(renderer_);
+        SDL_DestroySurface(surface_);
+        SDL_Quit();
+    }
+
+    // 删除复制/移动操作
+    HeadlessRuntime(const HeadlessRuntime&) = delete;
+    HeadlessRuntime& operator=(const HeadlessRuntime&) = delete;
+    HeadlessRuntime(HeadlessRuntime&&) = delete;
+    HeadlessRuntime& operator=(HeadlessRuntime&&) = delete;
+
+    SDL_Renderer* getRenderer() const { return renderer_; }
+};
+
+nlohmann::ordered_json toJson(const CommandLine& command_line, const std::vector<bench::BenchResult>& results) {
+    const auto now = std::chrono::system_clock::now();
+    nlohmann::ordered_json json;
+    json["version"] = MONSTERWAR_VERSION;
+    json["build_type"] = MONSTERWAR_BUILD_TYPE;
+    json["label"] = command_line.label_;
+    json["timestamp"] = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+    json["iterations"] = command_line.options_.iterations_;
+    json["warmup"] = command_line.options_.warmup_;
+    json["seed"] = command_line.options_.seed_;
+    json["delta_time"] = command_line.options_.delta_time_;
+    auto& json_results = json["results"] = nlohmann::ordered_json::array();
+    for (const auto& result : results) {
+        json_results.push_back({
+            {"system", result.system_},
+            {"players", result.scale_.players_},
+            {"enemies", result.scale_.enemies_},
+            {"projectiles", result.scale_.projectiles_},
+            {"tiles", result.scale_.tiles_},
+            {"entities", result.scale_.total()},
+            {"iterations", result.iterations_},
+            {"mean_us", result.mean_us_},
+            {"median_us", result.median_us_},
+            {"p95_us", result.p95_us_},
+            {"min_us", result.min_us_},
+            {"max_us", result.max_us_},
+        });
+    }
+    return json;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    spdlog::set_level(spdlog::level::info);
+    auto command_line = parseCommandLine(argc, argv);
+    if (!command_line) return EXIT_FAILURE;
+
+    // 输出到标准输出时，日志只保留错误，避免混入结果
+    const bool to_stdout = command_line->output_ == "-";
+    if (to_stdout) spdlog::set_level(spdlog::level::err);
+
+    std::vector<bench::BenchResult> results;
+    try {
+        HeadlessRuntime runtime;
+        engine::resource::ResourceManager resource_manager(runtime.getRenderer());
+        game::factory::BlueprintManager blueprint_manager(resource_manager);
+        bench::SystemBench system_bench(command_line->options_, blueprint_manager);
+        system_bench.runAll();
+        results = system_bench.getResults();
+    } catch (const std::exception& e) {
+        spdlog::error("benchmark failed: {}", e.what());
+        return EXIT_FAILURE;
+    }
+
+    const auto json = toJson(*command_line, results);
+    if (to_stdout) {
+        std::cout << json.dump(4) << std::endl;
+        return EXIT_SUCCESS;
+    }
+    std::ofstream file(std::filesystem::path(command_line->output_));
+    if (!file.is_open()) {
+        spdlog::error("not open output file: {}", command_line->output_);
+        return EXIT_FAILURE;
+    }
+    file << json.dump(4);
+    spdlog::info("{} results written to {}", results.size(), command_line->output_);
+    return EXIT_SUCCESS;
+}
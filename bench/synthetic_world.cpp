@@ -0,0 +1,176 @@
+#include "synthetic_world.h"
+#include "engine/component/animation_component.h"
+#include "engine/component/render_component.h"
+#include "engine/component/sprite_component.h"
+#include "engine/component/static_render_tag.h"
+#include "engine/component/transform_component.h"
+#include "engine/component/velocity_component.h"
+#include "game/component/blocker_component.h"
+#include "game/component/class_name_component.h"
+#include "game/component/enemy_component.h"
+#include "game/component/player_component.h"
+#include "game/component/projectile_component.h"
+#include "game/component/stats_component.h"
+#include "game/defs/tags.h"
+#include <entt/core/hashed_string.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/trigonometric.hpp>
+
+using namespace entt::literals;
+
+namespace bench {
+
+namespace {
+    constexpr glm::vec2 UNIT_SIZE{64.0f, 64.0f};        ///< @brief 角色精灵大小
+    constexpr glm::vec2 PROJECTILE_SIZE{16.0f, 16.0f};  ///< @brief 投射物精灵大小
+    constexpr glm::vec2 TILE_SIZE{32.0f, 32.0f};        ///< @brief 瓦片精灵大小
+    constexpr float UNIT_HP = 1.0e9f;                   ///< @brief 单位血量足够高，多次迭代中不会死亡
+}
+
+SyntheticWorld::SyntheticWorld(const Scale& scale, std::uint32_t seed)
+    : camera_(glm::vec2(MAP_WIDTH * 0.5f, MAP_HEIGHT * 0.5f), glm::vec2(MAP_WIDTH * 0.25f, MAP_HEIGHT * 0.25f)),
+      random_(seed) {
+    registry_.ctx().emplace<game::data::GameStats&>(game_stats_);
+    registry_.ctx().emplace<engine::utils::Random&>(random_);
+    game_stats_.enemy_count_ = scale.enemies_;
+
+    createWaypoints();
+    createPlayers(scale.players_);
+    createEnemies(scale.enemies_);
+    createProjectiles(scale.projectiles_);
+    createTiles(scale.tiles_);
+}
+
+entt::entity SyntheticWorld::randomUnit() {
+    const int index = random_.randomInt(0, static_cast<int>(players_.size() + enemies_.size()) - 1);
+    return index < static_cast<int>(players_.size()) ? players_[index] : enemies_[index - players_.size()];
+}
+
+entt::entity SyntheticWorld::createDeadUnit() {
+    auto entity = registry_.create();
+    registry_.emplace<engine::component::TransformComponent>(entity, randomPosition());
+    registry_.emplace<engine::component::VelocityComponent>(entity);
+    registry_.emplace<game::component::StatsComponent>(entity);
+    addVisuals(entity, UNIT_SIZE);
+    registry_.emplace<game::defs::DeadTag>(entity);
+    return entity;
+}
+
+void SyntheticWorld::createWaypoints() {
+    // 沿地图中的椭圆均匀放置节点，每个节点可以前往后面的一个或两个节点
+    for (int i = 0; i < WAYPOINT_COUNT; ++i) {
+        const float angle = glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(WAYPOINT_COUNT);
+        glm::vec2 position{MAP_WIDTH * 0.5f + glm::cos(angle) * MAP_WIDTH * 0.4f,
+                           MAP_HEIGHT * 0.5f + glm::sin(angle) * MAP_HEIGHT * 0.4f};
+        waypoint_nodes_.emplace(i, game::data::WaypointNode{i, position,
+                                                             {(i + 1) % WAYPOINT_COUNT, (i + 2) % WAYPOINT_COUNT}});
+    }
+}
+
+void SyntheticWorld::createPlayers(int count) {
+    players_.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        auto entity = registry_.create();
+        registry_.emplace<engine::component::TransformComponent>(entity, randomPosition());
+        registry_.emplace<game::component::StatsComponent>(entity, UNIT_HP, UNIT_HP, randomFloat(20.0f, 80.0f),
+            randomFloat(5.0f, 20.0f), randomFloat(60.0f, 200.0f), randomFloat(0.5f, 2.0f));
+        registry_.emplace<game::component::PlayerComponent>(entity, random_.randomInt(5, 20));
+        registry_.emplace<game::component::ClassNameComponent>(entity, "warrior"_hs, "warrior");
+        // 近战 50%，远程 40%，治疗 10%
+        const int kind = random_.randomInt(0, 9);
+        if (kind < 5) {
+            registry_.emplace<game::defs::MeleeUnitTag>(entity);
+            registry_.emplace<game::component::BlockerComponent>(entity, random_.randomInt(1, 3));
+        } else {
+            registry_.emplace<game::defs::RangedUnitTag>(entity);
+            if (kind == 9) registry_.emplace<game::defs::HealerTag>(entity);
+        }
+        // 一部分单位受伤 (治疗者的目标)
+        if (random_.randomInt(0, 3) == 0) {
+            registry_.get<game::component::StatsComponent>(entity).hp_ = UNIT_HP * 0.5f;
+            registry_.emplace<game::defs::InjuredTag>(entity);
+        }
+        addVisuals(entity, UNIT_SIZE);
+        players_.push_back(entity);
+    }
+}
+
+void SyntheticWorld::createEnemies(int count) {
+    enemies_.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        auto entity = registry_.create();
+        registry_.emplace<engine::component::TransformComponent>(entity, randomPosition());
+        registry_.emplace<engine::component::VelocityComponent>(entity);
+        registry_.emplace<game::component::EnemyComponent>(entity, random_.randomInt(0, WAYPOINT_COUNT - 1), randomFloat(20.0f, 60.0f));
+        registry_.emplace<game::component::StatsComponent>(entity, UNIT_HP, UNIT_HP, randomFloat(10.0f, 40.0f),
+            randomFloat(0.0f, 10.0f), randomFloat(40.0f, 160.0f), randomFloat(0.8f, 2.5f));
+        registry_.emplace<game::component::ClassNameComponent>(entity, "slime"_hs, "slime");
+        // 远程 30%，近战 70%
+        if (random_.randomInt(0, 9) < 3) {
+            registry_.emplace<game::defs::RangedUnitTag>(entity);
+        } else {
+            registry_.emplace<game::defs::MeleeUnitTag>(entity);
+        }
+        addVisuals(entity, UNIT_SIZE);
+        enemies_.push_back(entity);
+    }
+}
+
+void SyntheticWorld::createProjectiles(int count) {
+    projectiles_.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        auto entity = registry_.create();
+        const auto start = randomPosition();
+        const auto target = enemies_.empty() ? entt::entity{entt::null} : enemies_[random_.randomInt(0, static_cast<int>(enemies_.size()) - 1)];
+        const auto target_position = target == entt::null ? randomPosition()
+            : registry_.get<engine::component::TransformComponent>(target).position_;
+        const float total_flight_time = randomFloat(0.5f, 1.5f);
+        registry_.emplace<engine::component::TransformComponent>(entity, start);
+        registry_.emplace<game::component::ProjectileComponent>(entity, target, 10.0f, start, target_position, start,
+            randomFloat(20.0f, 80.0f), total_flight_time, randomFloat(0.0f, total_flight_time));
+        registry_.emplace<engine::component::SpriteComponent>(entity,
+            engine::component::Sprite("arrow"_hs, engine::utils::Rect(glm::vec2(0.0f), PROJECTILE_SIZE)));
+        registry_.emplace<engine::component::RenderComponent>(entity, engine::component::RenderComponent::MAIN_LAYER + 1);
+        projectiles_.push_back(entity);
+    }
+}
+
+void SyntheticWorld::createTiles(int count) {
+    for (int i = 0; i < count; ++i) {
+        auto entity = registry_.create();
+        registry_.emplace<engine::component::TransformComponent>(entity, randomPosition());
+        registry_.emplace<engine::component::SpriteComponent>(entity,
+            engine::component::Sprite("tileset"_hs, engine::utils::Rect(glm::vec2(0.0f), TILE_SIZE)));
+        registry_.emplace<engine::component::RenderComponent>(entity, 0);
+        registry_.emplace<engine::component::StaticRenderTag>(entity);
+    }
+}
+
+glm::vec2 SyntheticWorld::randomPosition() {
+    return {randomFloat(0.0f, MAP_WIDTH), randomFloat(0.0f, MAP_HEIGHT)};
+}
+
+float SyntheticWorld::randomFloat(float min, float max) {
+    // 整数随机数换算为浮点数，足够生成测试数据
+    constexpr int STEPS = 1 << 16;
+    return min + (max - min) * static_cast<float>(random_.randomInt(0, STEPS)) / static_cast<float>(STEPS);
+}
+
+void SyntheticWorld::addVisuals(entt::entity entity, glm::vec2 size) {
+    registry_.emplace<engine::component::SpriteComponent>(entity,
+        engine::component::Sprite("unit"_hs, engine::utils::Rect(glm::vec2(0.0f), size)));
+    registry_.emplace<engine::component::RenderComponent>(entity);
+
+    // 一个循环播放的动画，帧数与帧间隔随机 (各实体的换帧时刻错开)
+    const int frame_count = random_.randomInt(4, 8);
+    engine::memory::Vector<engine::component::AnimationFrame> frames;
+    frames.reserve(frame_count);
+    for (int i = 0; i < frame_count; ++i) {
+        frames.emplace_back(engine::utils::Rect(glm::vec2(size.x * static_cast<float>(i), 0.0f), size), randomFloat(80.0f, 150.0f));
+    }
+    engine::memory::HashMap<entt::id_type, engine::component::Animation> animations;
+    animations.emplace("idle"_hs, engine::component::Animation(std::move(frames)));
+    registry_.emplace<engine::component::AnimationComponent>(entity, std::move(animations), "idle"_hs);
+}
+
+} // namespace bench
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "engine/core/timing_wheel.h"
+#include "engine/render/camera.h"
+#include "engine/utils/random.h"
+#include "game/data/game_stats.h"
+#include "game/data/waypoint_node.h"
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <entt/entity/registry.hpp>
+#include <entt/signal/dispatcher.hpp>
+
+namespace bench {
+
+/**
+ * @brief 合成世界的规模 (各类实体的数量)
+ */
+struct Scale {
+    int players_{};         ///< @brief 玩家单位 (近战/远程/治疗)
+    int enemies_{};         ///< @brief 敌人 (沿路径移动)
+    int projectiles_{};     ///< @brief 飞行中的投射物
+    int tiles_{};           ///< @brief 静态瓦片 (只参与排序/渲染相关系统)
+
+    /// @brief 以敌人数量为基准，按实际关卡中的大致比例生成规模
+    static Scale fromEnemyCount(int enemies) {
+        return {std::max(1, enemies / 4), enemies, std::max(1, enemies / 2), enemies * 2};
+    }
+
+    [[nodiscard]] int total() const { return players_ + enemies_ + projectiles_ + tiles_; }
+};
+
+/**
+ * @brief 基准测试用的合成世界。
+ *
+ * 用固定种子在注册表中生成玩家、敌人、投射物与瓦片，组件与真实关卡相同，
+ * 注册表上下文中也放入系统需要的数据 (游戏统计、随机数生成器)。
+ * 每个被测系统使用一个新的世界，系统之间互不影响。
+ */
+class SyntheticWorld final {
+public:
+    static constexpr float MAP_WIDTH = 1280.0f;         ///< @brief 地图宽度 (与关卡大小相同)
+    static constexpr float MAP_HEIGHT = 720.0f;         ///< @brief 地图高度
+    static constexpr int WAYPOINT_COUNT = 32;           ///< @brief 路径节点数量 (首尾相连的环路，敌人不会到达终点)
+
+    entt::registry registry_;
+    entt::dispatcher dispatcher_;
+    engine::core::TimingWheel timing_wheel_;
+    engine::render::Camera camera_;                     ///< @brief 只覆盖地图的一部分，动画系统会同时处理屏幕内外的实体
+    engine::utils::Random random_;
+    game::data::GameStats game_stats_;
+    std::unordered_map<int, game::data::WaypointNode> waypoint_nodes_;
+
+    std::vector<entt::entity> players_;
+    std::vector<entt::entity> enemies_;
+    std::vector<entt::entity> projectiles_;
+
+    /**
+     * @brief 构造函数，生成指定规模的世界
+     * @param scale 规模
+     * @param seed 随机数种子 (相同种子生成相同的世界)
+     */
+    SyntheticWorld(const Scale& scale, std::uint32_t seed);
+
+    // 删除复制/移动操作
+    SyntheticWorld(const SyntheticWorld&) = delete;
+    SyntheticWorld& operator=(const SyntheticWorld&) = delete;
+    SyntheticWorld(SyntheticWorld&&) = delete;
+    SyntheticWorld& operator=(SyntheticWorld&&) = delete;
+
+    /// @brief 随机选择一个敌人或玩家单位
+    entt::entity randomUnit();
+    /// @brief 生成一个带有常见组件、已标记死亡的实体 (用于测试删除)
+    entt::entity createDeadUnit();
+
+private:
+    void createWaypoints();
+    void createPlayers(int count);
+    void createEnemies(int count);
+    void createProjectiles(int count);
+    void createTiles(int count);
+
+    glm::vec2 randomPosition();
+    float randomFloat(float min, float max);
+    void addVisuals(entt::entity entity, glm::vec2 size);   ///< @brief 精灵、渲染与动画组件
+};
+
+} // namespace bench
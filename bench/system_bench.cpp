@@ -0,0 +1,347 @@
+#include "system_bench.h"
+#include "engine/component/transform_component.h"
+#include "engine/system/animation_system.h"
+#include "engine/system/movement_system.h"
+#include "engine/system/render_system.h"
+#include "engine/system/ysort_system.h"
+#include "game/component/blocked_by_component.h"
+#include "game/component/blocker_component.h"
+#include "game/component/projectile_component.h"
+#include "game/component/target_component.h"
+#include "game/defs/events.h"
+#include "game/defs/tags.h"
+#include "game/factory/blueprint_manager.h"
+#include "game/factory/entity_factory.h"
+#include "game/system/block_system.h"
+#include "game/system/combat_resolve_system.h"
+#include "game/system/followpath_system.h"
+#include "game/system/projectile_system.h"
+#include "game/system/remove_dead_system.h"
+#include "game/system/set_target_system.h"
+#include "game/system/timer_system.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <entt/core/hashed_string.hpp>
+#include <spdlog/spdlog.h>
+
+using namespace entt::literals;
+
+namespace bench {
+
+SystemBench::SystemBench(const BenchOptions& options, game::factory::BlueprintManager& blueprint_manager)
+    : options_(options), blueprint_manager_(blueprint_manager) {}
+
+void SystemBench::runAll() {
+    for (auto enemies : options_.scales_) {
+        const auto scale = Scale::fromEnemyCount(enemies);
+        spdlog::info("scale: {} players, {} enemies, {} projectiles, {} tiles",
+                     scale.players_, scale.enemies_, scale.projectiles_, scale.tiles_);
+        benchSetTarget(scale);
+        benchBlock(scale);
+        benchFollowPath(scale);
+        benchTimer(scale);
+        benchMovement(scale);
+        benchAnimation(scale);
+        benchYSort(scale);
+        benchProjectile(scale);
+        benchCombatResolve(scale);
+        benchCombatFocus(scale);
+        benchCombatSplash(scale);
+        benchRemoveDead(scale);
+        benchSpawnBurst(scale);
+        benchGroupLayout(scale);
+    }
+}
+
+// --- 各系统的测试 ---
+
+void SystemBench::benchSetTarget(const Scale& scale) {
+    if (!isSelected("SetTargetSystem")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    game::system::SetTargetSystem system(world.registry_, world.waypoint_nodes_);
+    // 每次都从“没有目标”开始，测试完整的索敌过程 (合成世界的路径是环路，没有终点，“先后”只按实体ID比较)
+    measure("SetTargetSystem", scale,
+        [&] { world.registry_.clear<game::component::TargetComponent>(); },
+        [&] { system.update(); });
+}
+
+void SystemBench::benchBlock(const Scale& scale) {
+    if (!isSelected("BlockSystem")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    game::system::BlockSystem system;
+    measure("BlockSystem", scale,
+        [&] {
+            world.registry_.clear<game::component::BlockedByComponent>();
+            for (auto&& [entity, blocker] : world.registry_.view<game::component::BlockerComponent>().each()) {
+                blocker.current_count_ = 0;
+            }
+            world.dispatcher_.clear();
+        },
+        [&] { system.update(world.registry_, world.dispatcher_); });
+}
+
+void SystemBench::benchFollowPath(const Scale& scale) {
+    if (!isSelected("FollowPathSystem")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    game::system::FollowPathSystem system;
+    measure("FollowPathSystem", scale,
+        [&] { world.dispatcher_.clear(); },
+        [&] { system.update(world.registry_, world.dispatcher_, world.waypoint_nodes_); });
+}
+
+void SystemBench::benchTimer(const Scale& scale) {
+    if (!isSelected("TimerSystem")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    game::system::TimerSystem system(world.registry_, world.dispatcher_, world.timing_wheel_);
+    // 移除“可攻击”标签相当于发起了攻击，计时器重新开始冷却 (与游戏中相同)
+    measure("TimerSystem", scale,
+        [&] {
+            world.registry_.clear<game::defs::AttackReadyTag>();
+            world.dispatcher_.clear();
+        },
+        [&] { system.update(options_.delta_time_); });
+}
+
+void SystemBench::benchMovement(const Scale& scale) {
+    if (!isSelected("MovementSystem")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    engine::system::MovementSystem system;
+    measure("MovementSystem", scale,
+        [] {},
+        [&] { system.update(world.registry_, options_.delta_time_); });
+}
+
+void SystemBench::benchAnimation(const Scale& scale) {
+    if (!isSelected("AnimationSystem")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    engine::system::AnimationSystem system(world.registry_, world.dispatcher_);
+    measure("AnimationSystem", scale,
+        [&] { world.dispatcher_.clear(); },
+        [&] { system.update(options_.delta_time_, world.camera_); });
+}
+
+void SystemBench::benchYSort(const Scale& scale) {
+    if (!isSelected("YSortSystem")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    engine::system::YSortSystem system;
+    measure("YSortSystem", scale,
+        [] {},
+        [&] { system.update(world.registry_); });
+}
+
+void SystemBench::benchProjectile(const Scale& scale) {
+    if (!isSelected("ProjectileSystem")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    game::factory::EntityFactory entity_factory(world.registry_, blueprint_manager_);
+    game::system::ProjectileSystem system(world.registry_, world.dispatcher_, entity_factory);
+    // 命中的投射物不删除，重新从起点飞行 (投射物数量保持不变)
+    measure("ProjectileSystem", scale,
+        [&] {
+            auto view = world.registry_.view<game::component::ProjectileComponent, game::defs::DeadTag>();
+            for (auto entity : view) {
+                auto& projectile = view.get<game::component::ProjectileComponent>(entity);
+                projectile.current_flight_time_ = 0.0f;
+                projectile.previous_position_ = projectile.start_position_;
+            }
+            world.registry_.clear<game::defs::DeadTag>();
+            world.dispatcher_.clear();
+        },
+        [&] { system.update(options_.delta_time_); });
+}
+
+void SystemBench::benchCombatResolve(const Scale& scale) {
+    if (!isSelected("CombatResolveSystem")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    game::system::CombatResolveSystem system(world.registry_, world.dispatcher_);
+    // 每帧的攻击事件数量约为敌人数量，治疗事件约为玩家单位数量的十分之一
+    const int attack_count = scale.enemies_;
+    const int heal_count = std::max(1, scale.players_ / 10);
+    measure("CombatResolveSystem", scale,
+        [&] {
+            world.dispatcher_.clear();
+            for (int i = 0; i < attack_count; ++i) {
+                world.dispatcher_.enqueue(game::defs::AttackEvent{world.randomUnit(), world.randomUnit(), 30.0f});
+            }
+            for (int i = 0; i < heal_count; ++i) {
+                world.dispatcher_.enqueue(game::defs::HealEvent{world.randomUnit(), world.randomUnit(), 20.0f});
+            }
+        },
+        [&] {
+            world.dispatcher_.update<game::defs::AttackEvent>();
+            world.dispatcher_.update<game::defs::HealEvent>();
+            system.update();
+        });
+}
+
+void SystemBench::benchCombatFocus(const Scale& scale) {
+    if (!isSelected("CombatFocus")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    game::system::CombatResolveSystem system(world.registry_, world.dispatcher_);
+    // 激烈的战斗：每个单位都在攻击，集中攻击少数目标 (约每50个敌人中的1个)，同时治疗也集中在少数玩家单位上
+    const int attack_count = scale.enemies_ + scale.players_;
+    const int target_count = std::max(1, scale.enemies_ / 50);
+    const int heal_count = std::max(1, scale.players_ / 4);
+    measure("CombatFocus", scale,
+        [&] {
+            world.dispatcher_.clear();
+            for (int i = 0; i < attack_count; ++i) {
+                const auto target = world.enemies_[world.random_.randomInt(0, target_count - 1)];
+                world.dispatcher_.enqueue(game::defs::AttackEvent{world.randomUnit(), target, 30.0f});
+            }
+            for (int i = 0; i < heal_count; ++i) {
+                const auto target = world.players_[world.random_.randomInt(0, std::min(target_count, scale.players_) - 1)];
+                world.dispatcher_.enqueue(game::defs::HealEvent{world.randomUnit(), target, 20.0f});
+            }
+        },
+        [&] {
+            world.dispatcher_.update<game::defs::AttackEvent>();
+            world.dispatcher_.update<game::defs::HealEvent>();
+            system.update();
+        });
+}
+
+void SystemBench::benchCombatSplash(const Scale& scale) {
+    if (!isSelected("CombatSplash")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    game::system::CombatResolveSystem system(world.registry_, world.dispatcher_);
+    // 每帧约四分之一敌人数量的溅射命中，落点在随机敌人的位置 (范围内通常有多个敌人)
+    const int splash_count = std::max(1, scale.enemies_ / 4);
+    // 溅射参数与 projectile_data.json 中的 fireball 一致
+    constexpr float SPLASH_RADIUS = 96.0f;
+    constexpr float SPLASH_FALLOFF = 0.5f;
+    measure("CombatSplash", scale,
+        [&] {
+            world.dispatcher_.clear();
+            for (int i = 0; i < splash_count; ++i) {
+                const auto target = world.enemies_[world.random_.randomInt(0, scale.enemies_ - 1)];
+                const auto& position = world.registry_.get<engine::component::TransformComponent>(target).position_;
+                world.dispatcher_.enqueue(game::defs::AttackEvent{entt::null, target, 30.0f});
+                world.dispatcher_.enqueue(game::defs::AreaEffectEvent{entt::null, target, position, SPLASH_RADIUS, SPLASH_FALLOFF, 30.0f, false, false});
+            }
+        },
+        [&] {
+            world.dispatcher_.update<game::defs::AttackEvent>();
+            world.dispatcher_.update<game::defs::AreaEffectEvent>();
+            system.update();
+        });
+}
+
+void SystemBench::benchRemoveDead(const Scale& scale) {
+    if (!isSelected("RemoveDeadSystem")) return;
+    SyntheticWorld world(scale, options_.seed_);
+    game::system::RemoveDeadSystem system;
+    // 每帧删除约十分之一敌人数量的实体
+    const int dead_count = std::max(1, scale.enemies_ / 10);
+    measure("RemoveDeadSystem", scale,
+        [&] {
+            for (int i = 0; i < dead_count; ++i) {
+                world.createDeadUnit();
+            }
+        },
+        [&] { system.update(world.registry_); });
+}
+
+void SystemBench::benchSpawnBurst(const Scale& scale) {
+    if (!isSelected("SpawnBurst") || !loadEnemyBlueprints()) return;
+    SyntheticWorld world(scale, options_.seed_);
+    game::factory::EntityFactory entity_factory(world.registry_, blueprint_manager_);
+    // 每次生成一波同类型的敌人 (与波次开始时一样先预留容量)，准备步骤删除上一次生成的敌人
+    constexpr std::size_t BURST_SIZE = 500;
+    std::vector<entt::entity> entities(BURST_SIZE, entt::null);
+    std::vector<glm::vec2> positions(BURST_SIZE);
+    std::vector<int> waypoints(BURST_SIZE, 0);
+    for (std::size_t i = 0; i < BURST_SIZE; ++i) {
+        positions[i] = {static_cast<float>(i % 50) * 16.0f, static_cast<float>(i / 50) * 16.0f};
+    }
+    measure("SpawnBurst", scale,
+        [&] {
+            if (world.registry_.valid(entities.front())) {
+                world.registry_.destroy(entities.begin(), entities.end());
+            }
+            entity_factory.reserveEnemies(BURST_SIZE);
+        },
+        [&] { entity_factory.spawnEnemyBatch("slime"_hs, entities, positions, waypoints); });
+}
+
+void SystemBench::benchGroupLayout(const Scale& scale) {
+    if (!isSelected("GroupLayout")) return;
+    // 三个系统在同一个世界中运行，各自的组同时存在 (与游戏中相同)。
+    // 渲染系统需要渲染器才能完整更新，这里只计时每帧的动态网格同步 (遍历动态渲染实体并计算包围盒)。
+    // 视图布局的对照结果：把这三个系统的 .cpp 恢复为改用拥有组之前的版本后重新编译运行，用 --label 区分结果文件。
+    SyntheticWorld world(scale, options_.seed_);
+    engine::system::MovementSystem movement_system;
+    game::system::FollowPathSystem follow_path_system;
+    engine::system::RenderSystem render_system(world.registry_);
+    measure("GroupLayout/MovementSystem", scale,
+        [] {},
+        [&] { movement_system.update(world.registry_, options_.delta_time_); });
+    measure("GroupLayout/FollowPathSystem", scale,
+        [&] { world.dispatcher_.clear(); },
+        [&] { follow_path_system.update(world.registry_, world.dispatcher_, world.waypoint_nodes_); });
+    // 准备步骤先移动一帧，使部分实体跨越格子 (与游戏中每帧的工作量相近)
+    measure("GroupLayout/RenderSystem", scale,
+        [&] { movement_system.update(world.registry_, options_.delta_time_); },
+        [&] { render_system.updateDynamicGrid(); });
+}
+
+// --- 辅助函数 ---
+
+bool SystemBench::loadEnemyBlueprints() {
+    if (enemy_blueprints_tried_) return enemy_blueprints_loaded_;
+    enemy_blueprints_tried_ = true;
+    try {
+        enemy_blueprints_loaded_ = blueprint_manager_.loadEnemyClassBlueprints("assets/data/enemy_data.json");
+    } catch (const std::exception& e) {
+        spdlog::error("load enemy blueprints failed: {}", e.what());
+    }
+    if (!enemy_blueprints_loaded_) {
+        spdlog::warn("enemy blueprints not loaded, SpawnBurst skipped (run from the project root)");
+    }
+    return enemy_blueprints_loaded_;
+}
+
+bool SystemBench::isSelected(std::string_view name) const {
+    return options_.filter_.empty() || name.find(options_.filter_) != std::string_view::npos;
+}
+
+template <typename Prepare, typename Step>
+void SystemBench::measure(std::string_view name, const Scale& scale, Prepare&& prepare, Step&& step) {
+    using Clock = std::chrono::steady_clock;
+    // 系统中逐个实体的 info 日志会严重影响计时，计时期间只保留警告以上的日志
+    const auto log_level = spdlog::get_level();
+    spdlog::set_level(std::max(log_level, spdlog::level::warn));
+
+    for (int i = 0; i < options_.warmup_; ++i) {
+        prepare();
+        step();
+    }
+    std::vector<double> samples;
+    samples.reserve(options_.iterations_);
+    for (int i = 0; i < options_.iterations_; ++i) {
+        prepare();
+        const auto start = Clock::now();
+        step();
+        samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+    }
+    spdlog::set_level(log_level);
+    if (samples.empty()) return;
+
+    std::sort(samples.begin(), samples.end());
+    const auto count = samples.size();
+    BenchResult result;
+    result.system_ = name;
+    result.scale_ = scale;
+    result.iterations_ = static_cast<int>(count);
+    result.mean_us_ = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(count);
+    result.median_us_ = samples[count / 2];
+    result.p95_us_ = samples[std::min(count - 1, static_cast<std::size_t>(std::ceil(0.95 * static_cast<double>(count))) - 1)];
+    result.min_us_ = samples.front();
+    result.max_us_ = samples.back();
+    spdlog::info("  {:<20} mean {:>10.2f} us, median {:>10.2f} us, p95 {:>10.2f} us",
+                 result.system_, result.mean_us_, result.median_us_, result.p95_us_);
+    results_.push_back(std::move(result));
+}
+
+} // namespace bench
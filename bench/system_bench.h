@@ -0,0 +1,95 @@
+#pragma once
+
+#include "synthetic_world.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace game::factory {
+    class BlueprintManager;
+}
+
+namespace bench {
+
+/// @brief 基准测试参数 (见 main.cpp 中的命令行参数)
+struct BenchOptions {
+    std::vector<int> scales_{250, 1000, 4000};  ///< @brief 各轮测试的敌人数量 (其它实体按比例生成，见 Scale::fromEnemyCount)
+    int iterations_{200};                       ///< @brief 每个系统计时的迭代次数
+    int warmup_{10};                            ///< @brief 计时前的预热次数
+    std::uint32_t seed_{12345};                 ///< @brief 生成世界的随机数种子
+    float delta_time_{1.0f / 60.0f};            ///< @brief 每次迭代的帧时长 (秒)
+    std::string filter_;                        ///< @brief 只运行名称中包含此字符串的系统 (为空时全部运行)
+};
+
+/// @brief 一个系统在一个规模下的测试结果 (时间单位：微秒)
+struct BenchResult {
+    std::string system_;
+    Scale scale_;
+    int iterations_{};
+    double mean_us_{};
+    double median_us_{};
+    double p95_us_{};
+    double min_us_{};
+    double max_us_{};
+};
+
+/**
+ * @brief ECS系统的微基准测试。
+ *
+ * 每个系统在每个规模下使用一个新生成的合成世界，单独计时 update (或事件分发)。
+ * 每次迭代前执行一个不计时的准备步骤，把世界恢复到可比较的状态
+ * (例如清除上一次迭代设置的目标、阻挡关系，补充待删除的实体)，使每次迭代的工作量相近。
+ */
+class SystemBench final {
+    const BenchOptions& options_;
+    game::factory::BlueprintManager& blueprint_manager_;    ///< @brief 投射物系统与批量生成需要实体工厂 (敌人蓝图在首次需要时载入)
+    bool enemy_blueprints_tried_{false};                    ///< @brief 是否已尝试载入敌人蓝图
+    bool enemy_blueprints_loaded_{false};                   ///< @brief 敌人蓝图是否载入成功
+    std::vector<BenchResult> results_;
+
+public:
+    SystemBench(const BenchOptions& options, game::factory::BlueprintManager& blueprint_manager);
+
+    // 删除复制/移动操作
+    SystemBench(const SystemBench&) = delete;
+    SystemBench& operator=(const SystemBench&) = delete;
+    SystemBench(SystemBench&&) = delete;
+    SystemBench& operator=(SystemBench&&) = delete;
+
+    void runAll();      ///< @brief 按规模依次运行所有系统的测试
+
+    [[nodiscard]] const std::vector<BenchResult>& getResults() const { return results_; }
+
+private:
+    // --- 各系统的测试 ---
+    void benchSetTarget(const Scale& scale);
+    void benchBlock(const Scale& scale);
+    void benchFollowPath(const Scale& scale);
+    void benchTimer(const Scale& scale);
+    void benchMovement(const Scale& scale);
+    void benchAnimation(const Scale& scale);
+    void benchYSort(const Scale& scale);
+    void benchProjectile(const Scale& scale);
+    void benchCombatResolve(const Scale& scale);
+    void benchCombatFocus(const Scale& scale);      ///< @brief 战斗结算：大量攻击集中在少数目标上
+    void benchCombatSplash(const Scale& scale);     ///< @brief 战斗结算：大量溅射命中 (网格查询展开范围效果)
+    void benchRemoveDead(const Scale& scale);
+    void benchSpawnBurst(const Scale& scale);       ///< @brief 批量生成一波敌人 (预制体 + 范围插入)
+    void benchGroupLayout(const Scale& scale);      ///< @brief 移动、寻路与渲染网格同步在同一个世界中运行 (各系统的组同时存在)
+
+    [[nodiscard]] bool isSelected(std::string_view name) const;
+    [[nodiscard]] bool loadEnemyBlueprints();       ///< @brief 载入敌人蓝图 (只尝试一次)，失败时返回 false
+
+    /**
+     * @brief 计时并记录结果
+     * @param name 系统名称
+     * @param scale 规模
+     * @param prepare 每次迭代前的准备步骤 (不计时)
+     * @param step 被计时的步骤
+     */
+    template <typename Prepare, typename Step>
+    void measure(std::string_view name, const Scale& scale, Prepare&& prepare, Step&& step);
+};
+
+} // namespace bench
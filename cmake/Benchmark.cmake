@@ -0,0 +1,34 @@
+# ============================================
+# 基准测试模块
+# ============================================
+# 功能：配置ECS系统的微基准测试程序（不创建窗口，结果输出为JSON）
+
+# ============================================
+# 配置基准测试目标
+# 用法：setup_benchmark_target(目标名称 引擎与游戏库目标)
+# 说明：bench/ 目录下的源文件链接主程序所用的引擎与游戏库，不重复编译 src/ 下的源文件
+# ============================================
+function(setup_benchmark_target BENCH_TARGET CORE_TARGET)
+    file(GLOB_RECURSE BENCH_SOURCES CONFIGURE_DEPENDS "${CMAKE_SOURCE_DIR}/bench/*.cpp")
+    file(GLOB_RECURSE BENCH_HEADERS CONFIGURE_DEPENDS "${CMAKE_SOURCE_DIR}/bench/*.h")
+
+    source_group(TREE "${CMAKE_SOURCE_DIR}/bench" PREFIX "bench" FILES ${BENCH_SOURCES} ${BENCH_HEADERS})
+
+    add_executable(${BENCH_TARGET} ${BENCH_SOURCES} ${BENCH_HEADERS})
+
+    target_include_directories(${BENCH_TARGET} PRIVATE bench)
+
+    # 依赖库与 src/ 包含路径由引擎与游戏库传递
+    target_link_libraries(${BENCH_TARGET} PRIVATE ${CORE_TARGET})
+
+    # 写入结果文件的版本信息
+    target_compile_definitions(${BENCH_TARGET} PRIVATE
+        MONSTERWAR_VERSION="${PROJECT_VERSION}"
+        MONSTERWAR_BUILD_TYPE="$<CONFIG>"
+    )
+
+    setup_compiler_options(${BENCH_TARGET})
+    setup_windows_dll_copy(${BENCH_TARGET})
+
+    message(STATUS "  基准测试目标: ${BENCH_TARGET}")
+endfunction()
@@ -1,4 +1,5 @@
 #include "audio_player.h"
+#include "voice_manager.h"
 #include "../resource/resource_manager.h"
 #include <SDL3_mixer/SDL_mixer.h> 
 #include <spdlog/spdlog.h>
@@ -8,11 +9,16 @@
 namespace engine::audio {
 AudioPlayer::~AudioPlayer() = default;
 
-AudioPlayer::AudioPlayer(engine::resource::ResourceManager* resource_manager)
+AudioPlayer::AudioPlayer(engine::resource::ResourceManager* resource_manager, const VoiceSettings& voice_settings)
     : resource_manager_(resource_manager) {
     if (!resource_manager_) {
         throw std::runtime_error("AudioPlayer build failed: the provided ResourceManager pointer is null.");
     }
+    voice_manager_ = std::make_unique<VoiceManager>(resource_manager_, voice_settings);
+}
+
+void AudioPlayer::update() {
+    voice_manager_->update();
 }
 
 int AudioPlayer::playSound(entt::id_type sound_id, int channel) {
@@ -49,8 +55,8 @@ int AudioPlayer::playSound(entt::hashed_string hashed_path, int channel) {
 
 bool AudioPlayer::playMusic(entt::id_type music_id, int loops, int fade_in_ms) {
     if (music_id == current_music_id_) return true;      // 如果当前音乐已经在播放，则不重复播放
-    current_music_id_ = music_id;
     Mix_Music* music = resource_manager_->getMusic(music_id); // 通过 ResourceManager 获取资源
+    holdMusic(music ? music_id : entt::null);
     if (!music) {
         spdlog::error("AudioPlayer: failed to get music id = {} for play.", music_id);
         return false;
@@ -75,8 +81,8 @@ bool AudioPlayer::playMusic(entt::id_type music_id, int loops, int fade_in_ms) {
 
 bool AudioPlayer::playMusic(entt::hashed_string hashed_path, int loops, int fade_in_ms) {
     if (hashed_path.value() == current_music_id_) return true;      // 如果当前音乐已经在播放，则不重复播放
-    current_music_id_ = hashed_path;
     Mix_Music* music = resource_manager_->getMusic(hashed_path, hashed_path.data()); // 通过 ResourceManager 获取资源
+    holdMusic(music ? hashed_path.value() : entt::null);
     if (!music) {
         spdlog::error("AudioPlayer: not get music id: {}, path: {} for play.", hashed_path.value(), hashed_path.data());
         return false;
@@ -141,4 +147,15 @@ float AudioPlayer::getSoundVolume(int channel) {
     return static_cast<float>(Mix_Volume(channel, -1)) / static_cast<float>(MIX_MAX_VOLUME);
 }
 
+void AudioPlayer::holdMusic(entt::id_type music_id) {
+    // 正在播放的音乐必须常驻 (Mix_FreeMusic 会中断播放)，换曲时归还上一首的引用
+    if (current_music_id_ != entt::null) {
+        resource_manager_->releaseResource(engine::resource::ResourceType::MUSIC, current_music_id_);
+    }
+    current_music_id_ = music_id;
+    if (current_music_id_ != entt::null) {
+        resource_manager_->acquireResource(engine::resource::ResourceType::MUSIC, current_music_id_);
+    }
+}
+
 } // namespace engine::audio
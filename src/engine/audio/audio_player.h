@@ -1,7 +1,9 @@
 #pragma once
 
 #include <string_view>
+#include <memory>
 #include <entt/entity/fwd.hpp>
+#include <entt/entity/entity.hpp>
 
 namespace engine::resource {
     class ResourceManager;
@@ -11,6 +13,8 @@ struct Mix_Chunk;
 struct Mix_Music;
 
 namespace engine::audio {
+class VoiceManager;
+struct VoiceSettings;
 
 /**
  * @brief 用于控制音频播放的单例类。
@@ -21,13 +25,15 @@ namespace engine::audio {
 class AudioPlayer final{
 private:
     engine::resource::ResourceManager* resource_manager_;   ///< @brief 指向 ResourceManager 的非拥有指针，用于加载和管理音频资源。
-    entt::id_type current_music_id_;         ///< @brief 当前正在播放的音乐路径，用于避免重复播放同一音乐。
+    entt::id_type current_music_id_{entt::null};    ///< @brief 当前正在播放的音乐路径，用于避免重复播放同一音乐。
+    std::unique_ptr<VoiceManager> voice_manager_;   ///< @brief 发声管理器，负责游戏内音效的合并、限流与距离衰减
 
 public:
     /**
      * @brief 构造函数，使用 ResourceManager 初始化。
+     * @param voice_settings 发声管理的设置（通道数、发声上限等）。
      */
-    explicit AudioPlayer(engine::resource::ResourceManager* resource_manager);
+    AudioPlayer(engine::resource::ResourceManager* resource_manager, const VoiceSettings& voice_settings);
     ~AudioPlayer();
 
     // 删除复制/移动操作
@@ -36,6 +42,11 @@ public:
     AudioPlayer(AudioPlayer&&) = delete;
     AudioPlayer& operator=(AudioPlayer&&) = delete;
 
+    /// @brief 每帧调用一次（在事件分发之后），处理本帧累积的音效请求
+    void update();
+
+    VoiceManager& getVoiceManager() const { return *voice_manager_; }   ///< @brief 获取发声管理器
+
     // --- 播放控制方法 --- 
     /**
      * @brief 播放音效（chunk）。
@@ -118,6 +129,9 @@ public:
      */
     float getSoundVolume(int channel = -1);
 
+private:
+    void holdMusic(entt::id_type music_id);     ///< @brief 持有当前音乐的引用计数，避免其被资源管理器淘汰
+
 };
 
 } // namespace engine::audio
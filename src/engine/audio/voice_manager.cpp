@@ -0,0 +1,196 @@
+#include "voice_manager.h"
+#include "../resource/resource_manager.h"
+#include "../render/camera.h"
+#include <SDL3_mixer/SDL_mixer.h>
+#include <SDL3/SDL_timer.h>
+#include <spdlog/spdlog.h>
+#include <glm/common.hpp>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace engine::audio {
+
+VoiceManager::VoiceManager(engine::resource::ResourceManager* resource_manager, const VoiceSettings& settings)
+    : resource_manager_(resource_manager), settings_(settings) {
+    if (!resource_manager_) {
+        throw std::runtime_error("VoiceManager build failed: the provided ResourceManager pointer is null.");
+    }
+    settings_.channel_count_ = std::max(1, settings_.channel_count_);
+    settings_.direct_channel_count_ = std::max(1, settings_.direct_channel_count_);
+    settings_.max_voices_per_sound_ = std::max(1, settings_.max_voices_per_sound_);
+    // SDL_mixer 默认只有 8 个通道，大规模战斗时很容易耗尽
+    const int total_channels = settings_.channel_count_ + settings_.direct_channel_count_;
+    int allocated = Mix_AllocateChannels(total_channels);
+    if (allocated != total_channels) {
+        spdlog::warn("VoiceManager: requested {} mixer channels, got {}.", total_channels, allocated);
+    }
+    // 前 channel_count_ 个通道由本管理器独占 (Mix_PlayChannel(-1) 不会选中保留通道)，
+    // 这样直接播放的音效不会被抢占，也不会继承本管理器设置的距离效果
+    settings_.channel_count_ = std::max(0, Mix_ReserveChannels(settings_.channel_count_));
+    channels_.resize(static_cast<size_t>(settings_.channel_count_));
+    spdlog::trace("VoiceManager build successfully, channels: {}", settings_.channel_count_);
+}
+
+void VoiceManager::request(entt::id_type sound_id, const engine::render::Camera& camera, std::optional<glm::vec2> world_position) {
+    ++frame_stats_.requested_;
+    float gain = world_position ? computeGain(camera, *world_position) : 1.0f;
+    if (gain <= 0.0f) {
+        ++frame_stats_.culled_;
+        return;
+    }
+
+    // 同一帧内的相同音效只保留最响的一个
+    auto it = std::find_if(pending_.begin(), pending_.end(), [sound_id](const PendingVoice& voice) {
+        return voice.sound_id_ == sound_id;
+    });
+    if (it != pending_.end()) {
+        it->gain_ = std::max(it->gain_, gain);
+        ++frame_stats_.coalesced_;
+        return;
+    }
+    pending_.push_back({sound_id, gain, getPolicy(sound_id).priority_});
+}
+
+void VoiceManager::update() {
+    refreshChannels();
+
+    // 高优先级、音量大的请求先处理，确保通道紧张时它们先拿到通道
+    std::sort(pending_.begin(), pending_.end(), [](const PendingVoice& a, const PendingVoice& b) {
+        if (a.priority_ != b.priority_) return a.priority_ > b.priority_;
+        return a.gain_ > b.gain_;
+    });
+
+    const auto now_ms = SDL_GetTicks();
+    const auto window_ms = static_cast<uint64_t>(std::max(0.0f, settings_.coalesce_window_ms_));
+    for (const auto& voice : pending_) {
+        // 合并窗口内刚开始播放过的音效，听感上与重复触发无异
+        if (auto it = last_start_ms_.find(voice.sound_id_); it != last_start_ms_.end() && now_ms - it->second < window_ms) {
+            ++frame_stats_.coalesced_;
+            continue;
+        }
+        if (countVoices(voice.sound_id_) >= getMaxVoices(voice.sound_id_)) {
+            ++frame_stats_.capped_;
+            continue;
+        }
+        int channel = findFreeChannel();
+        if (channel == -1) {
+            channel = findVictimChannel(voice);
+            if (channel == -1) {
+                ++frame_stats_.rejected_;
+                continue;
+            }
+            Mix_HaltChannel(channel);
+            channels_[static_cast<size_t>(channel)].reset();
+            ++frame_stats_.stolen_;
+        }
+        if (play(voice, channel, now_ms)) {
+            ++frame_stats_.played_;
+        }
+    }
+    pending_.clear();
+
+    frame_stats_.active_voices_ = static_cast<int>(std::count_if(channels_.begin(), channels_.end(), [](const auto& slot) {
+        return slot.has_value();
+    }));
+    last_stats_ = frame_stats_;
+    frame_stats_ = {};
+}
+
+void VoiceManager::setSoundPolicy(entt::id_type sound_id, const VoicePolicy& policy) {
+    policies_[sound_id] = policy;
+}
+
+float VoiceManager::computeGain(const engine::render::Camera& camera, const glm::vec2& world_position) const {
+    // 声源在视口内时不衰减，离开视口后按到视口边缘的距离线性衰减
+    const auto& view_min = camera.getPosition();
+    const auto view_max = view_min + camera.getViewportSize();
+    const auto closest = glm::clamp(world_position, view_min, view_max);
+    const auto offset = world_position - closest;
+    const float distance_sq = offset.x * offset.x + offset.y * offset.y;
+    if (distance_sq <= 0.0f) return 1.0f;
+    if (settings_.falloff_distance_ <= 0.0f) return 0.0f;
+    return 1.0f - std::min(1.0f, std::sqrt(distance_sq) / settings_.falloff_distance_);
+}
+
+const VoicePolicy& VoiceManager::getPolicy(entt::id_type sound_id) const {
+    static const VoicePolicy default_policy{};
+    auto it = policies_.find(sound_id);
+    return it != policies_.end() ? it->second : default_policy;
+}
+
+int VoiceManager::getMaxVoices(entt::id_type sound_id) const {
+    const auto& policy = getPolicy(sound_id);
+    return policy.max_voices_ > 0 ? policy.max_voices_ : settings_.max_voices_per_sound_;
+}
+
+void VoiceManager::refreshChannels() {
+    for (size_t i = 0; i < channels_.size(); ++i) {
+        if (channels_[i] && !Mix_Playing(static_cast<int>(i))) {
+            channels_[i].reset();
+        }
+    }
+}
+
+int VoiceManager::countVoices(entt::id_type sound_id) const {
+    return static_cast<int>(std::count_if(channels_.begin(), channels_.end(), [sound_id](const auto& slot) {
+        return slot && slot->sound_id_ == sound_id;
+    }));
+}
+
+int VoiceManager::findFreeChannel() const {
+    for (size_t i = 0; i < channels_.size(); ++i) {
+        if (!channels_[i]) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+int VoiceManager::findVictimChannel(const PendingVoice& voice) const {
+    // 只抢占本管理器发起的发声：优先级更低，或同优先级但更轻、更早开始的
+    int victim = -1;
+    for (size_t i = 0; i < channels_.size(); ++i) {
+        const auto& slot = channels_[i];
+        if (!slot) continue;
+        if (slot->priority_ > voice.priority_) continue;
+        if (slot->priority_ == voice.priority_ && slot->gain_ >= voice.gain_) continue;
+        if (victim == -1) {
+            victim = static_cast<int>(i);
+            continue;
+        }
+        const auto& current = *channels_[static_cast<size_t>(victim)];
+        if (slot->priority_ != current.priority_) {
+            if (slot->priority_ < current.priority_) victim = static_cast<int>(i);
+        } else if (slot->gain_ != current.gain_) {
+            if (slot->gain_ < current.gain_) victim = static_cast<int>(i);
+        } else if (slot->start_ms_ < current.start_ms_) {
+            victim = static_cast<int>(i);
+        }
+    }
+    return victim;
+}
+
+bool VoiceManager::play(const PendingVoice& voice, int channel, uint64_t now_ms) {
+    Mix_Chunk* chunk = resource_manager_->getSound(voice.sound_id_);
+    if (!chunk) {
+        spdlog::error("VoiceManager: failed to get sound id = {} for play.", voice.sound_id_);
+        return false;
+    }
+
+    // 距离效果: 0 为最近(不衰减，同时会移除效果)，255 为最远
+    const auto distance = static_cast<uint8_t>(std::round((1.0f - glm::clamp(voice.gain_, 0.0f, 1.0f)) * 255.0f));
+    if (!Mix_SetDistance(channel, distance)) {
+        spdlog::warn("VoiceManager: failed to set distance on channel {}, {}", channel, SDL_GetError());
+    }
+
+    int played_channel = Mix_PlayChannel(channel, chunk, 0);
+    if (played_channel == -1) {
+        spdlog::error("VoiceManager: failed to play sound {}, {}", voice.sound_id_, SDL_GetError());
+        return false;
+    }
+    channels_[static_cast<size_t>(played_channel)] = ActiveVoice{voice.sound_id_, voice.gain_, voice.priority_, now_ms};
+    last_start_ms_[voice.sound_id_] = now_ms;
+    spdlog::trace("VoiceManager: play sound id = {} on channel {}, gain {:.2f}.", voice.sound_id_, played_channel, voice.gain_);
+    return true;
+}
+
+} // namespace engine::audio
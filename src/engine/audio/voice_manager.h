@@ -0,0 +1,120 @@
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <unordered_map>
+#include <cstdint>
+#include <glm/vec2.hpp>
+#include <entt/core/fwd.hpp>
+
+namespace engine::resource {
+    class ResourceManager;
+}
+
+namespace engine::render {
+    class Camera;
+}
+
+namespace engine::audio {
+
+/// @brief 单个音效的发声策略
+struct VoicePolicy {
+    int max_voices_{0};         ///< @brief 同一音效允许同时发声的数量上限，0 表示使用默认值
+    int priority_{0};           ///< @brief 优先级，通道不足时可以抢占优先级更低的发声
+};
+
+/// @brief 发声管理的全局设置
+struct VoiceSettings {
+    int channel_count_{24};             ///< @brief 由发声管理器独占的通道数
+    int direct_channel_count_{8};       ///< @brief 留给直接播放(如UI音效)的通道数
+    int max_voices_per_sound_{4};       ///< @brief 同一音效默认的同时发声上限
+    float coalesce_window_ms_{40.0f};   ///< @brief 合并窗口 (毫秒)，窗口内同一音效的重复请求会被合并
+    float falloff_distance_{400.0f};    ///< @brief 衰减距离，声源离开屏幕超过该距离时音量衰减为0并被剔除
+};
+
+/// @brief 每帧的发声统计
+struct VoiceStats {
+    int requested_{0};      ///< @brief 本帧收到的请求数
+    int coalesced_{0};      ///< @brief 被合并的请求数 (同帧或合并窗口内的重复请求)
+    int culled_{0};         ///< @brief 因距离过远被剔除的请求数
+    int capped_{0};         ///< @brief 因超出单音效发声上限被丢弃的请求数
+    int stolen_{0};         ///< @brief 抢占其他发声的次数
+    int rejected_{0};       ///< @brief 通道不足且无法抢占而被丢弃的请求数
+    int played_{0};         ///< @brief 实际播放的数量
+    int active_voices_{0};  ///< @brief 帧末正在发声的数量
+};
+
+/**
+ * @brief 发声管理器，位于事件与 SDL_mixer 之间，决定哪些音效请求真正被播放。
+ *
+ * 请求先在一帧内累积，由 update() 统一处理：
+ * 1. 同一帧内相同音效只保留最响的一个，且合并窗口内已开始播放的音效不再重复触发；
+ * 2. 根据声源与相机视口的距离计算衰减，过远的直接剔除；
+ * 3. 每个音效有同时发声上限；
+ * 4. 通道耗尽时抢占优先级(及音量)最低的发声。
+ *
+ * @note 只管理经由 request() 发出的音效，AudioPlayer::playSound 的直接播放（如UI音效）不受影响。
+ */
+class VoiceManager final {
+    /// @brief 一帧内待处理的请求
+    struct PendingVoice {
+        entt::id_type sound_id_;
+        float gain_;                ///< @brief 距离衰减后的增益 (0~1)
+        int priority_;
+    };
+
+    /// @brief 正在某个通道上发声的记录
+    struct ActiveVoice {
+        entt::id_type sound_id_;
+        float gain_;
+        int priority_;
+        uint64_t start_ms_;
+    };
+
+    engine::resource::ResourceManager* resource_manager_;   ///< @brief 非拥有指针，用于获取音效资源
+    VoiceSettings settings_;
+    std::unordered_map<entt::id_type, VoicePolicy> policies_;   ///< @brief 音效ID -> 发声策略
+
+    std::vector<PendingVoice> pending_;                         ///< @brief 本帧待处理的请求 (同一音效只保留一个)
+    std::vector<std::optional<ActiveVoice>> channels_;          ///< @brief 通道号 -> 该通道上由本管理器发起的发声
+    std::unordered_map<entt::id_type, uint64_t> last_start_ms_; ///< @brief 音效ID -> 最近一次开始播放的时间
+
+    VoiceStats frame_stats_;        ///< @brief 正在累计的本帧统计
+    VoiceStats last_stats_;         ///< @brief 上一帧的完整统计 (供调试UI显示)
+
+public:
+    VoiceManager(engine::resource::ResourceManager* resource_manager, const VoiceSettings& settings);
+
+    // 删除复制/移动操作
+    VoiceManager(const VoiceManager&) = delete;
+    VoiceManager& operator=(const VoiceManager&) = delete;
+    VoiceManager(VoiceManager&&) = delete;
+    VoiceManager& operator=(VoiceManager&&) = delete;
+
+    /**
+     * @brief 请求播放音效，实际播放推迟到本帧的 update()。
+     * @param sound_id 音效ID。
+     * @param camera 用于计算距离衰减的相机。
+     * @param world_position 声源的世界坐标，空值表示全局音效（不衰减）。
+     */
+    void request(entt::id_type sound_id, const engine::render::Camera& camera, std::optional<glm::vec2> world_position = std::nullopt);
+
+    /// @brief 处理本帧累积的请求，每帧调用一次（在事件分发之后）
+    void update();
+
+    void setSoundPolicy(entt::id_type sound_id, const VoicePolicy& policy);     ///< @brief 设置某个音效的发声策略
+    const VoiceSettings& getSettings() const { return settings_; }              ///< @brief 获取全局设置
+    const VoiceStats& getStats() const { return last_stats_; }                  ///< @brief 获取上一帧的发声统计
+
+private:
+    float computeGain(const engine::render::Camera& camera, const glm::vec2& world_position) const;    ///< @brief 根据声源到视口的距离计算增益
+    const VoicePolicy& getPolicy(entt::id_type sound_id) const;
+    int getMaxVoices(entt::id_type sound_id) const;
+    void refreshChannels();                                 ///< @brief 回收已经播放结束的通道
+    int countVoices(entt::id_type sound_id) const;          ///< @brief 统计某个音效正在发声的数量
+    int findFreeChannel() const;                            ///< @brief 查找空闲通道，没有时返回 -1
+    int findVictimChannel(const PendingVoice& voice) const; ///< @brief 查找可以被抢占的通道，没有时返回 -1
+    bool play(const PendingVoice& voice, int channel, uint64_t now_ms);
+};
+
+} // namespace engine::audio
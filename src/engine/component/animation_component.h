@@ -1,10 +1,10 @@
 #pragma once
 
 #include "../../engine/utils/math.h"
+#include "../memory/pmr.h"
 #include <entt/core/hashed_string.hpp>
 #include <entt/entity/entity.hpp>
-#include <unordered_map>
-#include <vector>
+#include <algorithm>
 
 namespace engine::component {
 
@@ -16,6 +16,7 @@ namespace engine::component {
 struct AnimationFrame {
     engine::utils::Rect src_rect_{};        ///< @brief 帧源矩形
     float duration_ms_{100.0f};             ///< @brief 帧间隔（毫秒）
+    AnimationFrame() = default;     ///< @brief 空的构造函数 (读取快照时使用)
     AnimationFrame(engine::utils::Rect src_rect, float duration_ms = 100.0f)
      : src_rect_(std::move(src_rect)), duration_ms_(duration_ms) {}
 };
@@ -24,13 +25,17 @@ struct AnimationFrame {
  * @brief 动画数据结构
  * 
  * 包含动画名称、帧列表、总时长、当前播放时间、是否循环等属性。
+ * @note 容器使用构造时传入的内存资源 (通常是场景内存)，见 engine::memory::pmr.h
  */
 struct Animation {
-    std::vector<AnimationFrame> frames_;    ///< @brief 动画帧
-    std::unordered_map<int, entt::id_type> events_; ///< @brief 动画事件，键为帧索引，值为事件ID
+    engine::memory::Vector<AnimationFrame> frames_;             ///< @brief 动画帧
+    engine::memory::HashMap<int, entt::id_type> events_;        ///< @brief 动画事件，键为帧索引，值为事件ID
     float total_duration_ms_{};             ///< @brief 动画总时长（毫秒）
+    float min_frame_ms_{};                  ///< @brief 最短的帧间隔（毫秒），用于判断能否跳跃推进
     bool loop_{true};                       ///< @brief 是否循环
 
+    Animation() = default;          ///< @brief 空的构造函数 (读取快照时使用)
+
     /**
      * @brief 构造函数
      * @param name 动画名称
@@ -38,8 +43,8 @@ struct Animation {
      * @param events 动画事件，默认为空
      * @param loop 是否循环，默认true
      */
-    Animation(std::vector<AnimationFrame> frames, 
-              std::unordered_map<int, entt::id_type> events = {},
+    Animation(engine::memory::Vector<AnimationFrame> frames, 
+              engine::memory::HashMap<int, entt::id_type> events = {},
               bool loop = true) : 
               frames_(std::move(frames)), 
               events_(std::move(events)),
@@ -49,6 +54,17 @@ struct Animation {
         for (const auto& frame : frames_) {
             total_duration_ms_ += frame.duration_ms_;
         }
+        if (!frames_.empty()) {
+            min_frame_ms_ = std::min_element(frames_.begin(), frames_.end(), [](const auto& a, const auto& b) {
+                return a.duration_ms_ < b.duration_ms_;
+            })->duration_ms_;
+        }
+    }
+
+    /// @brief 读写快照 (见 engine::serialization::BinaryOutputArchive)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(frames_, events_, total_duration_ms_, min_frame_ms_, loop_);
     }
 };
 
@@ -58,12 +74,19 @@ struct Animation {
  * 包含动画名称、帧列表、总时长、当前播放时间、是否循环等属性。
  */
 struct AnimationComponent {
-    std::unordered_map<entt::id_type, Animation> animations_;   ///< @brief 动画集合
+    engine::memory::HashMap<entt::id_type, Animation> animations_;   ///< @brief 动画集合
     entt::id_type current_animation_id_{entt::null};            ///< @brief 当前播放的动画名称
     size_t current_frame_index_{};                              ///< @brief 当前播放的帧索引
     float current_time_ms_{};                                   ///< @brief 当前播放时间（毫秒）
     float speed_{1.0f};                                         ///< @brief 播放速度
 
+    // --- 动画LOD (屏幕外的实体只在有事件可发送时才推进，见 AnimationSystem) ---
+    double lod_synced_ms_{};        ///< @brief 上次推进时动画系统的时钟（毫秒）
+    double lod_wake_ms_{};          ///< @brief 下一个可观察时刻（事件帧或播放完成）的时钟（毫秒）
+    float lod_max_step_ms_{};       ///< @brief 可以跳过推进的最大单帧时长（毫秒），超过时退回逐帧推进
+
+    AnimationComponent() = default;     ///< @brief 空的构造函数 (读取快照时使用)
+
     /**
      * @brief 构造函数
      * @param animations 动画集合
@@ -72,7 +95,7 @@ struct AnimationComponent {
      * @param current_time_ms 当前播放时间（毫秒）
      * @param speed 播放速度
      */
-    AnimationComponent(std::unordered_map<entt::id_type, Animation> animations,
+    AnimationComponent(engine::memory::HashMap<entt::id_type, Animation> animations,
                        entt::id_type current_animation_id,
                        size_t current_frame_index = 0,
                        float current_time_ms = 0.0f,
@@ -82,6 +105,12 @@ struct AnimationComponent {
                        current_frame_index_(current_frame_index),
                        current_time_ms_(current_time_ms),
                        speed_(speed) {}
+
+    /// @brief 读写快照 (LOD时钟由 AnimationSystem 在组件构造时重置)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(animations_, current_animation_id_, current_frame_index_, current_time_ms_, speed_, lod_max_step_ms_);
+    }
 };
 
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #pragma once
 
+#include "../memory/pmr.h"
 #include <entt/entity/fwd.hpp>
-#include <unordered_map>
 
 namespace engine::component {
 
@@ -9,7 +9,13 @@ namespace engine::component {
  * @brief 音频组件，包含音效集合。
  */
 struct AudioComponent {
-    std::unordered_map<entt::id_type, entt::id_type> sounds_;   ///< @brief 音效集合，名称(哈希) -> 音效ID
+    engine::memory::HashMap<entt::id_type, entt::id_type> sounds_;  ///< @brief 音效集合，名称(哈希) -> 音效ID
+
+    /// @brief 读写快照 (见 engine::serialization::BinaryOutputArchive)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(sounds_);
+    }
 };
 
 } // namespace engine::component
\ No newline at end of file
@@ -11,6 +11,12 @@ namespace engine::component {
 struct NameComponent {
     entt::id_type name_id_{entt::null};   ///< @brief 名称ID
     std::string name_;                    ///< @brief 名称
+
+    /// @brief 读写快照 (见 engine::serialization::BinaryOutputArchive)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(name_id_, name_);
+    }
 };
 
 }
\ No newline at end of file
@@ -13,6 +13,8 @@ struct ParallaxComponent {
     glm::bvec2 repeat_{true};           ///< @brief 是否重复
     bool is_visible_{true};             ///< @brief 是否可见
 
+    ParallaxComponent() = default;     ///< @brief 空的构造函数 (读取快照时使用)
+
     /**
      * @brief 构造函数
      * @param scroll_factor
@@ -44,6 +44,12 @@ struct Sprite{
      */
     Sprite(entt::id_type texture_id, engine::utils::Rect source_rect, bool is_flipped = false)
         : texture_id_(texture_id), src_rect_(std::move(source_rect)), is_flipped_(is_flipped) {}
+
+    /// @brief 读写快照 (见 engine::serialization::BinaryOutputArchive)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(texture_id_, texture_path_, src_rect_, is_flipped_);
+    }
 };
 
 /**
@@ -57,6 +63,8 @@ struct SpriteComponent {
     glm::vec2 offset_{0.0f};       ///< @brief 偏移
     bool is_visible_{true};        ///< @brief 是否可见
 
+    SpriteComponent() = default;    ///< @brief 空的构造函数 (读取快照时使用)
+
     /**
      * @brief 构造函数
      * @param sprite 精灵
@@ -73,6 +81,12 @@ struct SpriteComponent {
                 size_ = glm::vec2(sprite_.src_rect_.size.x, sprite_.src_rect_.size.y);
             }
         }
+
+    /// @brief 读写快照 (见 engine::serialization::BinaryOutputArchive)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(sprite_, size_, offset_, is_visible_);
+    }
 };
 
 }
\ No newline at end of file
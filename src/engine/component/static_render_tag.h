@@ -0,0 +1,12 @@
+#pragma once
+
+namespace engine::component {
+
+/**
+ * @brief 静态渲染标签，标记创建后不再移动的可渲染实体 (如地图瓦片、装饰物)。
+ *
+ * 带有此标签的实体由 RenderSystem 放入静态空间索引，只在增删时重建，不再逐帧更新位置。
+ */
+struct StaticRenderTag {};
+
+}   // namespace engine::component
@@ -2,6 +2,7 @@
 
 #include "animation_component.h"
 #include "sprite_component.h"
+#include "../memory/pmr.h"
 #include <entt/entity/entity.hpp>
 #include <glm/vec2.hpp>
 #include <vector>
@@ -53,7 +54,9 @@ struct TileInfo {
 struct TileLayerComponent {
     glm::ivec2 tile_size_;              ///< @brief 瓦片大小
     glm::ivec2 map_size_;               ///< @brief 地图大小
-    std::vector<entt::entity> tiles_;   ///< @brief 瓦片实体列表，每个瓦片对应一个实体，按顺序排列
+    engine::memory::Vector<entt::entity> tiles_;    ///< @brief 瓦片实体列表，每个瓦片对应一个实体，按顺序排列
+
+    TileLayerComponent() = default;     ///< @brief 空的构造函数 (读取快照时使用)
 
     /**
      * @brief 构造函数
@@ -63,10 +66,16 @@ struct TileLayerComponent {
      */
     TileLayerComponent(glm::ivec2 tile_size, 
                        glm::ivec2 map_size, 
-                       std::vector<entt::entity> tiles) : 
+                       engine::memory::Vector<entt::entity> tiles) : 
                        tile_size_(std::move(tile_size)), 
                        map_size_(std::move(map_size)),
                        tiles_(std::move(tiles)) {}
+
+    /// @brief 读写快照 (见 engine::serialization::BinaryOutputArchive)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(tile_size_, map_size_, tiles_);
+    }
 };
 
 }
\ No newline at end of file
@@ -13,6 +13,8 @@ struct TransformComponent {
     glm::vec2 scale_{1.0f};         ///< @brief 缩放
     float rotation_{};              ///< @brief 旋转
 
+    TransformComponent() = default;    ///< @brief 空的构造函数 (读取快照时使用)
+
     /**
      * @brief 构造函数
      * @param position 位置
@@ -75,11 +75,50 @@ void Config::fromJson(const nlohmann::json& j) {
             spdlog::warn("target_fps cannot be negative. Set to 0 (unlimited).");
             target_fps_ = 0;
         }
+        preload_threads_ = perf_config.value("preload_threads", preload_threads_);
+        precise_frame_pacing_ = perf_config.value("precise_frame_pacing", precise_frame_pacing_);
+        frame_time_csv_ = perf_config.value("frame_time_csv", frame_time_csv_);
+        threaded_simulation_ = perf_config.value("threaded_simulation", threaded_simulation_);
+        frame_arena_kb_ = perf_config.value("frame_arena_kb", frame_arena_kb_);
+        if (frame_arena_kb_ < 0) {
+            spdlog::warn("frame_arena_kb cannot be negative. Set to 0 (minimum block size).");
+            frame_arena_kb_ = 0;
+        }
+    }
+    if (j.contains("deterministic")) {
+        const auto& deterministic_config = j["deterministic"];
+        deterministic_ = deterministic_config.value("enabled", deterministic_);
+        deterministic_seed_ = deterministic_config.value("seed", deterministic_seed_);
+        deterministic_fps_ = deterministic_config.value("fps", deterministic_fps_);
+        if (deterministic_fps_ <= 0) {
+            spdlog::warn("deterministic fps must be positive. Set to 60.");
+            deterministic_fps_ = 60;
+        }
+        replay_path_ = deterministic_config.value("replay_path", replay_path_);
+    }
+    if (j.contains("resource_budget")) {
+        const auto& budget_config = j["resource_budget"];
+        texture_budget_mb_ = budget_config.value("texture_mb", texture_budget_mb_);
+        sound_budget_mb_ = budget_config.value("sound_mb", sound_budget_mb_);
+        sound_pcm_cache_mb_ = budget_config.value("sound_pcm_cache_mb", sound_pcm_cache_mb_);
+        music_budget_mb_ = budget_config.value("music_mb", music_budget_mb_);
+        font_budget_mb_ = budget_config.value("font_mb", font_budget_mb_);
     }
     if (j.contains("audio")) {
         const auto& audio_config = j["audio"];
         music_volume_ = audio_config.value("music_volume", music_volume_);
         sound_volume_ = audio_config.value("sound_volume", sound_volume_);
+        sound_channels_ = audio_config.value("sound_channels", sound_channels_);
+        direct_sound_channels_ = audio_config.value("direct_sound_channels", direct_sound_channels_);
+        max_voices_per_sound_ = audio_config.value("max_voices_per_sound", max_voices_per_sound_);
+        sound_coalesce_ms_ = audio_config.value("sound_coalesce_ms", sound_coalesce_ms_);
+        sound_falloff_distance_ = audio_config.value("sound_falloff_distance", sound_falloff_distance_);
+        if (audio_config.contains("sound_policies") && audio_config["sound_policies"].is_object()) {
+            sound_policies_.clear();
+            for (const auto& [name, policy_json] : audio_config["sound_policies"].items()) {
+                sound_policies_[name] = SoundPolicy{policy_json.value("max_voices", 0), policy_json.value("priority", 0)};
+            }
+        }
     }
 
     // 从 JSON 加载 input_mappings
@@ -100,6 +139,10 @@ void Config::fromJson(const nlohmann::json& j) {
 }
 
 nlohmann::ordered_json Config::toJson() const {
+    auto sound_policies = nlohmann::ordered_json::object();
+    for (const auto& [name, policy] : sound_policies_) {
+        sound_policies[name] = {{"max_voices", policy.max_voices_}, {"priority", policy.priority_}};
+    }
     return nlohmann::ordered_json{
         {"window", {
             {"title", window_title_},
@@ -113,11 +156,35 @@ nlohmann::ordered_json Config::toJson() const {
             {"vsync", vsync_enabled_}
         }},
         {"performance", {
-            {"target_fps", target_fps_}
+            {"target_fps", target_fps_},
+            {"preload_threads", preload_threads_},
+            {"precise_frame_pacing", precise_frame_pacing_},
+            {"frame_time_csv", frame_time_csv_},
+            {"threaded_simulation", threaded_simulation_},
+            {"frame_arena_kb", frame_arena_kb_}
+        }},
+        {"deterministic", {
+            {"enabled", deterministic_},
+            {"seed", deterministic_seed_},
+            {"fps", deterministic_fps_},
+            {"replay_path", replay_path_}
+        }},
+        {"resource_budget", {
+            {"texture_mb", texture_budget_mb_},
+            {"sound_mb", sound_budget_mb_},
+            {"sound_pcm_cache_mb", sound_pcm_cache_mb_},
+            {"music_mb", music_budget_mb_},
+            {"font_mb", font_budget_mb_}
         }},
         {"audio", {
             {"music_volume", music_volume_},
-            {"sound_volume", sound_volume_}
+            {"sound_volume", sound_volume_},
+            {"sound_channels", sound_channels_},
+            {"direct_sound_channels", direct_sound_channels_},
+            {"max_voices_per_sound", max_voices_per_sound_},
+            {"sound_coalesce_ms", sound_coalesce_ms_},
+            {"sound_falloff_distance", sound_falloff_distance_},
+            {"sound_policies", sound_policies}
         }},
         {"input_mappings", input_mappings_}
     };
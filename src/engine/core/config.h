@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -30,10 +31,40 @@ public:
 
     // 性能设置
     int target_fps_ = 144;                  ///< @brief 目标 FPS 设置，0 表示不限制
+    int preload_threads_ = -1;              ///< @brief 资源预加载工作线程数，-1 表示自动（硬件线程数-1），0 表示在主线程串行加载
+    bool precise_frame_pacing_ = true;      ///< @brief 帧率限制是否在睡眠后自旋等待剩余时间（更稳定，但多占用少量CPU）
+    std::string frame_time_csv_;            ///< @brief 退出时导出帧时长直方图的CSV路径，为空表示不导出
+    bool threaded_simulation_ = false;      ///< @brief 是否在工作线程中运行模拟并录制渲染命令，主线程提交上一帧（画面延迟一帧）
+    int frame_arena_kb_ = 256;              ///< @brief 帧分配器的初始容量 (KB)，不足时自动增长
+
+    // 确定性模式 (固定步长 + 固定随机数种子)，开启时每局都会录制录像，用于复现对局与性能对比
+    bool deterministic_ = false;                            ///< @brief 是否开启确定性模式
+    std::uint32_t deterministic_seed_ = 12345;              ///< @brief 每局使用的随机数种子
+    int deterministic_fps_ = 60;                            ///< @brief 每秒模拟的帧数 (固定步长 = 1 / fps，不影响实际帧率)
+    std::string replay_path_ = "assets/replay/last.replay"; ///< @brief 录像文件路径 (录制时写入，回放时读取)
+
+    // 资源内存预算 (单位：MB，0 表示不限制)，超出时按LRU淘汰未被场景引用的资源
+    int texture_budget_mb_ = 0;
+    int sound_budget_mb_ = 0;
+    int sound_pcm_cache_mb_ = 0;            ///< @brief 音效解码(PCM)缓存的预算，音效本身以压缩数据计入 sound_budget_mb_
+    int music_budget_mb_ = 0;
+    int font_budget_mb_ = 0;
 
     // 音频设置
     float music_volume_ = 0.5f;
     float sound_volume_ = 0.5f;
+    int sound_channels_ = 24;               ///< @brief 由发声管理器独占的混音通道数
+    int direct_sound_channels_ = 8;         ///< @brief 留给直接播放(如UI音效)的混音通道数
+    int max_voices_per_sound_ = 4;          ///< @brief 同一音效默认的同时发声上限
+    float sound_coalesce_ms_ = 40.0f;       ///< @brief 合并窗口 (毫秒)，窗口内同一音效的重复请求会被合并
+    float sound_falloff_distance_ = 400.0f; ///< @brief 声源离开屏幕后的衰减距离 (像素)，超出则不播放
+
+    /// @brief 单个音效的发声策略 (键为音效名称)，0 表示使用默认值
+    struct SoundPolicy {
+        int max_voices_ = 0;
+        int priority_ = 0;
+    };
+    std::unordered_map<std::string, SoundPolicy> sound_policies_;
 
     // 存储动作名称到 SDL Scancode 名称列表的映射
     std::unordered_map<std::string, std::vector<std::string>> input_mappings_ = {
@@ -45,6 +76,8 @@ public:
         {"jump", {"J", "Space"}},
         {"attack", {"K", "MouseLeft"}},
         {"pause", {"P", "Escape"}},
+        {"quick_save", {"F5"}},
+        {"quick_load", {"F9"}},
         // 可以继续添加更多默认动作
     };
 
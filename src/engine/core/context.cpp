@@ -7,6 +7,7 @@
 #include "../render/text_renderer.h"
 #include "../resource/resource_manager.h"
 #include "../audio/audio_player.h"
+#include "../memory/frame_arena.h"
 #include <spdlog/spdlog.h>
 #include <entt/signal/dispatcher.hpp>
 
@@ -20,7 +21,10 @@ Context::Context(entt::dispatcher& dispatcher,
                  engine::resource::ResourceManager& resource_manager,
                  engine::audio::AudioPlayer& audio_player,
                  engine::core::GameState& game_state,
-                 engine::core::Time& time)     
+                 engine::core::Time& time,
+                 engine::memory::FrameArena& frame_arena,
+                 engine::core::SaveService& save_service,
+                 engine::core::ReplayManager& replay_manager)
     : dispatcher_(dispatcher),
       input_manager_(input_manager),
       renderer_(renderer),
@@ -29,7 +33,10 @@ Context::Context(entt::dispatcher& dispatcher,
       resource_manager_(resource_manager),
       audio_player_(audio_player),
       game_state_(game_state),
-      time_(time)
+      time_(time),
+      frame_arena_(frame_arena),
+      save_service_(save_service),
+      replay_manager_(replay_manager)
 {
     spdlog::trace("context created and initialized.");
 }
@@ -21,9 +21,15 @@ namespace engine::audio {
     class AudioPlayer;
 }
 
+namespace engine::memory {
+    class FrameArena;
+}
+
 namespace engine::core {
     class GameState;
     class Time;
+    class SaveService;
+    class ReplayManager;
 
 /**
  * @brief 持有对核心引擎模块引用的上下文对象。
@@ -42,6 +48,9 @@ private:
     engine::audio::AudioPlayer& audio_player_;              ///< @brief 音频播放器
     engine::core::GameState& game_state_;                   ///< @brief 游戏状态
     engine::core::Time& time_;                              ///< @brief 时间
+    engine::memory::FrameArena& frame_arena_;               ///< @brief 帧分配器
+    engine::core::SaveService& save_service_;               ///< @brief 后台存档服务
+    engine::core::ReplayManager& replay_manager_;           ///< @brief 确定性模式与对局录像/回放
 
 public:
     /**
@@ -53,6 +62,9 @@ public:
      * @param resource_manager 对 ResourceManager 实例的引用。
      * @param physics_engine 对 PhysicsEngine 实例的引用。
      * @param time 对 Time 实例的引用。
+     * @param frame_arena 对 FrameArena 实例的引用。
+     * @param save_service 对 SaveService 实例的引用。
+     * @param replay_manager 对 ReplayManager 实例的引用。
      */
     Context(entt::dispatcher& dispatcher,
             engine::input::InputManager& input_manager,
@@ -62,7 +74,10 @@ public:
             engine::resource::ResourceManager& resource_manager,
             engine::audio::AudioPlayer& audio_player,
             engine::core::GameState& game_state,
-            engine::core::Time& time);
+            engine::core::Time& time,
+            engine::memory::FrameArena& frame_arena,
+            engine::core::SaveService& save_service,
+            engine::core::ReplayManager& replay_manager);
 
     // 禁止拷贝和移动，Context 对象通常是唯一的或按需创建/传递
     Context(const Context&) = delete;
@@ -80,6 +95,9 @@ public:
     engine::audio::AudioPlayer& getAudioPlayer() const { return audio_player_; }                 ///< @brief 获取音频播放器
     engine::core::GameState& getGameState() const { return game_state_; }                         ///< @brief 获取游戏状态
     engine::core::Time& getTime() const { return time_; }                                         ///< @brief 获取时间
+    engine::memory::FrameArena& getFrameArena() const { return frame_arena_; }                     ///< @brief 获取帧分配器 (只在本帧内有效)
+    engine::core::SaveService& getSaveService() const { return save_service_; }                   ///< @brief 获取后台存档服务
+    engine::core::ReplayManager& getReplayManager() const { return replay_manager_; }             ///< @brief 获取录像管理器
 };
 
 } // namespace engine::core
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include "ecs_telemetry.h"
+#include "../resource/resource_manager.h"
+#include <spdlog/spdlog.h>
+#include <entt/entity/registry.hpp>
+#include <algorithm>
+#include <fstream>
+
+namespace engine::core {
+
+void EcsTelemetry::sample(entt::registry& registry, const entt::dispatcher& dispatcher, const engine::resource::ResourceManager& resource_manager) {
+    ++frame_count_;
+    // 堆内存需要遍历每个组件，只在间隔帧重新估算，其余帧沿用上次的结果
+    const bool sample_heap = frame_count_ % HEAP_SAMPLE_INTERVAL == 1;
+
+    summary_ = {};
+    const auto& entities = registry.storage<entt::entity>();
+    summary_.live_entities_ = entities.free_list();
+    summary_.free_entities_ = entities.size() - entities.free_list();
+
+    storages_.clear();
+    for (auto [id, storage] : registry.storage()) {
+        const auto& info = storage.info();
+        auto it = tracked_storages_.find(info.hash());
+        if (it == tracked_storages_.end()) {
+            // 未登记的组件只知道名称，组件数组的大小未知
+            it = tracked_storages_.emplace(info.hash(), TrackedStorage{shortTypeName(info.name())}).first;
+        }
+        auto& tracked = it->second;
+        if (sample_heap && tracked.heap_bytes_fn_) {
+            tracked.heap_bytes_ = tracked.heap_bytes_fn_(storage);
+        }
+
+        StorageStats stats;
+        stats.name_ = tracked.name_;
+        stats.size_ = storage.size();
+        stats.capacity_ = storage.capacity();
+        // 稀疏数组 (按页分配) + 紧密数组 + 组件数组 (按容量估算)
+        stats.storage_bytes_ = storage.extent() * sizeof(entt::entity) + stats.capacity_ * (sizeof(entt::entity) + tracked.element_size_);
+        stats.heap_bytes_ = stats.size_ > 0 ? tracked.heap_bytes_ : 0;
+        summary_.storage_bytes_ += stats.storage_bytes_;
+        summary_.heap_bytes_ += stats.heap_bytes_;
+        storages_.push_back(stats);
+    }
+    summary_.storage_count_ = storages_.size();
+    sortStorages();
+
+    event_queues_.clear();
+    for (const auto& event : tracked_events_) {
+        event_queues_.push_back({event.name_, event.queue_size_fn_(dispatcher)});
+    }
+    summary_.queued_events_ = dispatcher.size();
+
+    using engine::resource::ResourceType;
+    summary_.texture_bytes_ = resource_manager.getResidencyStats(ResourceType::TEXTURE).resident_bytes_;
+    summary_.sound_bytes_ = resource_manager.getResidencyStats(ResourceType::SOUND).resident_bytes_ +
+                            resource_manager.getSoundCacheStats().resident_bytes_;
+
+    pushHistory();
+}
+
+void EcsTelemetry::setSortOrder(SortKey key, bool ascending) {
+    sort_key_ = key;
+    sort_ascending_ = ascending;
+    sortStorages();
+}
+
+bool EcsTelemetry::writeCsv(std::string_view filepath) const {
+    std::ofstream file{std::string(filepath)};
+    if (!file.is_open()) {
+        spdlog::error("EcsTelemetry: unable to open '{}' for writing.", filepath);
+        return false;
+    }
+    file << "kind,name,size,capacity,storage_bytes,heap_bytes\n";
+    file << "entity,live," << summary_.live_entities_ << ',' << summary_.live_entities_ + summary_.free_entities_ << ",,\n";
+    for (const auto& storage : storages_) {
+        file << "component," << storage.name_ << ',' << storage.size_ << ',' << storage.capacity_ << ','
+             << storage.storage_bytes_ << ',' << storage.heap_bytes_ << '\n';
+    }
+    for (const auto& queue : event_queues_) {
+        file << "event," << queue.name_ << ',' << queue.size_ << ",,,\n";
+    }
+    file << "resource,texture,,," << summary_.texture_bytes_ << ",\n";
+    file << "resource,sound,,," << summary_.sound_bytes_ << ",\n";
+    spdlog::info("EcsTelemetry: {} storages written to '{}'.", storages_.size(), filepath);
+    return true;
+}
+
+bool EcsTelemetry::writeHistoryCsv(std::string_view filepath) const {
+    std::ofstream file{std::string(filepath)};
+    if (!file.is_open()) {
+        spdlog::error("EcsTelemetry: unable to open '{}' for writing.", filepath);
+        return false;
+    }
+    file << "frame,entities,storage_kb,heap_kb,texture_mb,sound_mb,queued_events\n";
+    // 缓冲区未写满时从0开始，写满后从最旧的位置开始
+    const std::size_t first = history_count_ < HISTORY_SIZE ? 0 : history_offset_;
+    for (std::size_t i = 0; i < history_count_; ++i) {
+        const std::size_t index = (first + i) % HISTORY_SIZE;
+        file << history_frames_[index];
+        for (const auto& metric : history_) {
+            file << ',' << metric[index];
+        }
+        file << '\n';
+    }
+    spdlog::info("EcsTelemetry: {} frames written to '{}'.", history_count_, filepath);
+    return true;
+}
+
+std::string EcsTelemetry::shortTypeName(std::string_view name) {
+    // 模板参数中也可能含有命名空间，只去掉第一个 '<' 之前的部分
+    const auto template_begin = name.find('<');
+    const auto separator = name.substr(0, template_begin).rfind("::");
+    if (separator != std::string_view::npos) {
+        name.remove_prefix(separator + 2);
+    }
+    return std::string(name);
+}
+
+void EcsTelemetry::sortStorages() {
+    const auto key = [this](const StorageStats& stats) -> std::size_t {
+        switch (sort_key_) {
+            case SortKey::SIZE: return stats.size_;
+            case SortKey::CAPACITY: return stats.capacity_;
+            case SortKey::STORAGE_BYTES: return stats.storage_bytes_;
+            case SortKey::HEAP_BYTES: return stats.heap_bytes_;
+            default: return 0;
+        }
+    };
+    std::sort(storages_.begin(), storages_.end(), [&](const StorageStats& a, const StorageStats& b) {
+        if (sort_key_ == SortKey::NAME) {
+            return sort_ascending_ ? a.name_ < b.name_ : a.name_ > b.name_;
+        }
+        // 数值相同时按名称排列，避免每帧顺序跳动
+        const auto key_a = key(a);
+        const auto key_b = key(b);
+        if (key_a != key_b) return sort_ascending_ ? key_a < key_b : key_a > key_b;
+        return a.name_ < b.name_;
+    });
+}
+
+void EcsTelemetry::pushHistory() {
+    constexpr float KB = 1024.0f;
+    constexpr float MB = 1024.0f * 1024.0f;
+    const auto set = [this](Metric metric, float value) {
+        history_[static_cast<std::size_t>(metric)][history_offset_] = value;
+    };
+    set(Metric::ENTITIES, static_cast<float>(summary_.live_entities_));
+    set(Metric::STORAGE_KB, static_cast<float>(summary_.storage_bytes_) / KB);
+    set(Metric::HEAP_KB, static_cast<float>(summary_.heap_bytes_) / KB);
+    set(Metric::TEXTURE_MB, static_cast<float>(summary_.texture_bytes_) / MB);
+    set(Metric::SOUND_MB, static_cast<float>(summary_.sound_bytes_) / MB);
+    set(Metric::QUEUED_EVENTS, static_cast<float>(summary_.queued_events_));
+    history_frames_[history_offset_] = frame_count_;
+    history_offset_ = (history_offset_ + 1) % HISTORY_SIZE;
+    history_count_ = std::min(history_count_ + 1, HISTORY_SIZE);
+}
+
+} // namespace engine::core
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "../serialization/heap_size_archive.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <entt/core/type_info.hpp>
+#include <entt/core/type_traits.hpp>
+#include <entt/entity/fwd.hpp>
+#include <entt/entity/storage.hpp>
+#include <entt/signal/dispatcher.hpp>
+
+namespace engine::resource {
+    class ResourceManager;
+}
+
+namespace engine::core {
+
+/**
+ * @brief ECS 运行统计：每帧采样注册表、事件队列与资源驻留的规模，用于调试UI与导出CSV。
+ *
+ * 每帧记录：
+ * - 存活实体数与已回收 (可复用) 的实体数；
+ * - 注册表中每个组件存储 (含标签) 的数量、容量与估算内存 (稀疏数组 + 紧密数组 + 组件数组)；
+ * - 含字符串或容器的组件在堆上占用的字节数 (见 HeapSizeArchive，需遍历所有组件，因此每隔若干帧才重新估算)；
+ * - ResourceManager 中驻留的纹理与音效字节数；
+ * - 事件分发器中各类事件的排队数量。
+ * 组件与事件类型需预先登记 (引擎不依赖游戏层的类型)，未登记的组件存储仍会统计数量和容量，但内存只计算实体数组。
+ * 最近 HISTORY_SIZE 帧的汇总数据保存在环形缓冲区中，供 ImGui::PlotLines 绘制曲线。
+ */
+class EcsTelemetry final {
+public:
+    static constexpr std::size_t HISTORY_SIZE = 240;            ///< @brief 曲线保存的帧数
+    static constexpr std::uint64_t HEAP_SAMPLE_INTERVAL = 30;   ///< @brief 堆内存的估算间隔 (帧)
+
+    /// @brief 汇总曲线的类型
+    enum class Metric {
+        ENTITIES,           ///< @brief 存活实体数
+        STORAGE_KB,         ///< @brief 组件存储内存 (KB)
+        HEAP_KB,            ///< @brief 组件堆内存 (KB)
+        TEXTURE_MB,         ///< @brief 纹理驻留 (MB)
+        SOUND_MB,           ///< @brief 音效驻留，含解码缓存 (MB)
+        QUEUED_EVENTS,      ///< @brief 排队中的事件数
+        COUNT
+    };
+
+    /// @brief 存储表的排序列
+    enum class SortKey {
+        NAME,
+        SIZE,
+        CAPACITY,
+        STORAGE_BYTES,
+        HEAP_BYTES,
+    };
+
+    /// @brief 单个组件存储的统计
+    struct StorageStats {
+        std::string_view name_;         ///< @brief 组件类型名 (不含命名空间)
+        std::size_t size_{0};           ///< @brief 组件数量
+        std::size_t capacity_{0};       ///< @brief 紧密数组容量
+        std::size_t storage_bytes_{0};  ///< @brief 存储本身的估算内存
+        std::size_t heap_bytes_{0};     ///< @brief 组件持有的堆内存 (最近一次估算)
+    };
+
+    /// @brief 单类事件的排队统计
+    struct EventQueueStats {
+        std::string_view name_;
+        std::size_t size_{0};
+    };
+
+    /// @brief 一帧的汇总
+    struct Summary {
+        std::size_t live_entities_{0};      ///< @brief 存活实体数
+        std::size_t free_entities_{0};      ///< @brief 已回收、等待复用的实体数
+        std::size_t storage_count_{0};      ///< @brief 组件存储数量
+        std::size_t storage_bytes_{0};      ///< @brief 全部组件存储的估算内存
+        std::size_t heap_bytes_{0};         ///< @brief 全部组件的堆内存
+        std::size_t texture_bytes_{0};      ///< @brief 纹理驻留字节数
+        std::size_t sound_bytes_{0};        ///< @brief 音效驻留字节数 (压缩数据 + 解码后的PCM)
+        std::size_t queued_events_{0};      ///< @brief 排队中的事件总数
+    };
+
+private:
+    using HeapBytesFn = std::size_t (*)(const entt::sparse_set&);
+    using QueueSizeFn = std::size_t (*)(const entt::dispatcher&);
+
+    /// @brief 已登记 (或采样时遇到) 的组件类型
+    struct TrackedStorage {
+        std::string name_;
+        std::size_t element_size_{0};       ///< @brief 单个组件的大小，空类型 (标签) 为0
+        HeapBytesFn heap_bytes_fn_{nullptr};///< @brief 估算堆内存的函数，组件不含容器时为空
+        std::size_t heap_bytes_{0};         ///< @brief 最近一次估算的堆内存
+    };
+
+    /// @brief 已登记的事件类型
+    struct TrackedEvent {
+        std::string name_;
+        QueueSizeFn queue_size_fn_{nullptr};
+    };
+
+    std::unordered_map<entt::id_type, TrackedStorage> tracked_storages_;   ///< @brief 类型哈希 -> 组件信息 (元素地址稳定，名称可被引用)
+    std::vector<TrackedEvent> tracked_events_;
+
+    // --- 最近一帧的数据 (容器在帧间复用) ---
+    Summary summary_;
+    std::vector<StorageStats> storages_;
+    std::vector<EventQueueStats> event_queues_;
+    SortKey sort_key_{SortKey::STORAGE_BYTES};
+    bool sort_ascending_{false};
+
+    // --- 汇总曲线 (环形缓冲区) ---
+    std::array<std::array<float, HISTORY_SIZE>, static_cast<std::size_t>(Metric::COUNT)> history_{};
+    std::array<std::uint64_t, HISTORY_SIZE> history_frames_{};
+    std::size_t history_offset_{0};     ///< @brief 下一次写入的位置 (即最旧的数据)
+    std::size_t history_count_{0};
+    std::uint64_t frame_count_{0};      ///< @brief 已采样的帧数
+
+public:
+    EcsTelemetry() = default;
+
+    // 删除复制/移动操作
+    EcsTelemetry(const EcsTelemetry&) = delete;
+    EcsTelemetry& operator=(const EcsTelemetry&) = delete;
+    EcsTelemetry(EcsTelemetry&&) = delete;
+    EcsTelemetry& operator=(EcsTelemetry&&) = delete;
+
+    /// @brief 登记一个组件类型 (用于计算组件数组内存与堆内存)
+    template <typename Component>
+    void trackComponent();
+
+    /// @brief 登记列表中的全部组件类型，如 trackComponents(game::defs::SnapshotComponents{})
+    template <typename... Components>
+    void trackComponents(entt::type_list<Components...>) {
+        (trackComponent<Components>(), ...);
+    }
+
+    /// @brief 登记事件类型 (用于统计各类事件的排队数量)
+    template <typename... Events>
+    void trackEvents() {
+        (trackEvent<Events>(), ...);
+    }
+
+    /**
+     * @brief 采样一帧 (在场景更新结束、事件分发之前调用，此时事件队列中是本帧排队的事件)
+     * @param registry 注册表 (组件存储的遍历需要非const版本)
+     * @param dispatcher 事件分发器
+     * @param resource_manager 资源管理器
+     */
+    void sample(entt::registry& registry, const entt::dispatcher& dispatcher, const engine::resource::ResourceManager& resource_manager);
+
+    /// @brief 设置存储表的排序方式 (立即重新排序，之后每帧采样后保持该顺序)
+    void setSortOrder(SortKey key, bool ascending);
+
+    [[nodiscard]] const Summary& getSummary() const { return summary_; }
+    [[nodiscard]] const std::vector<StorageStats>& getStorages() const { return storages_; }
+    [[nodiscard]] const std::vector<EventQueueStats>& getEventQueues() const { return event_queues_; }
+    [[nodiscard]] std::uint64_t getFrameCount() const { return frame_count_; }
+
+    /// @brief 某项汇总的曲线数据 (长度 HISTORY_SIZE，从 getHistoryOffset() 开始为最旧的数据)
+    [[nodiscard]] const float* getHistory(Metric metric) const { return history_[static_cast<std::size_t>(metric)].data(); }
+    [[nodiscard]] std::size_t getHistoryOffset() const { return history_offset_; }
+    [[nodiscard]] std::size_t getHistoryCount() const { return history_count_; }
+
+    /**
+     * @brief 将最近一帧的存储表与事件队列导出为 CSV (列：类型, 名称, 数量, 容量, 内存(字节), 堆内存(字节))
+     * @param filepath 文件路径
+     * @return 成功返回 true
+     */
+    [[nodiscard]] bool writeCsv(std::string_view filepath) const;
+
+    /**
+     * @brief 将曲线中的各帧汇总导出为 CSV (按时间顺序，每行一帧)
+     * @param filepath 文件路径
+     * @return 成功返回 true
+     */
+    [[nodiscard]] bool writeHistoryCsv(std::string_view filepath) const;
+
+private:
+    template <typename Event>
+    void trackEvent();
+
+    /// @brief 估算某类组件在堆上占用的字节数 (遍历存储中的全部组件)
+    template <typename Component>
+    static std::size_t heapBytesOf(const entt::sparse_set& base);
+
+    /// @brief 从 entt 的类型名中去掉命名空间 (如 "engine::component::TransformComponent" -> "TransformComponent")
+    [[nodiscard]] static std::string shortTypeName(std::string_view name);
+
+    void sortStorages();
+    void pushHistory();
+};
+
+template <typename Component>
+void EcsTelemetry::trackComponent() {
+    TrackedStorage tracked;
+    tracked.name_ = shortTypeName(entt::type_name<Component>::value());
+    if constexpr (!std::is_empty_v<Component>) {
+        tracked.element_size_ = sizeof(Component);
+        // 可平凡复制的组件不持有堆内存，无需遍历
+        if constexpr (!std::is_trivially_copyable_v<Component> ||
+                      engine::serialization::detail::has_serialize<Component, engine::serialization::HeapSizeArchive>) {
+            tracked.heap_bytes_fn_ = &EcsTelemetry::heapBytesOf<Component>;
+        }
+    }
+    tracked_storages_.insert_or_assign(entt::type_hash<Component>::value(), std::move(tracked));
+}
+
+template <typename Event>
+void EcsTelemetry::trackEvent() {
+    tracked_events_.push_back({shortTypeName(entt::type_name<Event>::value()),
+                               [](const entt::dispatcher& dispatcher) { return dispatcher.size<Event>(); }});
+}
+
+template <typename Component>
+std::size_t EcsTelemetry::heapBytesOf(const entt::sparse_set& base) {
+    const auto& storage = static_cast<const entt::storage_for_t<Component>&>(base);
+    engine::serialization::HeapSizeArchive archive;
+    for (const auto& component : storage) {
+        archive(component);
+    }
+    return archive.getBytes();
+}
+
+} // namespace engine::core
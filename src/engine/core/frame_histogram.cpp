@@ -0,0 +1,76 @@
+#include "frame_histogram.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+namespace engine::core {
+
+void FrameHistogram::record(uint64_t value_us) {
+    ++counts_[bucketIndex(value_us)];
+    ++total_count_;
+    min_us_ = std::min(min_us_, value_us);
+    max_us_ = std::max(max_us_, value_us);
+    sum_us_ += static_cast<double>(value_us);
+}
+
+void FrameHistogram::reset() {
+    counts_.fill(0);
+    total_count_ = 0;
+    min_us_ = UINT64_MAX;
+    max_us_ = 0;
+    sum_us_ = 0.0;
+}
+
+uint64_t FrameHistogram::getPercentile(double percentile) const {
+    if (total_count_ == 0) return 0;
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    // 第一个累计数量达到目标的桶即为所求 (至少为1，保证 p0 返回最小值所在的桶)
+    const auto target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(total_count_))));
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        cumulative += counts_[i];
+        if (cumulative >= target) {
+            return std::min(bucketUpperBound(i), max_us_);
+        }
+    }
+    return max_us_;
+}
+
+bool FrameHistogram::writeCsv(std::string_view filepath) const {
+    std::ofstream file{std::string(filepath)};
+    if (!file.is_open()) {
+        spdlog::error("FrameHistogram: unable to open '{}' for writing.", filepath);
+        return false;
+    }
+    file << "value_us,count,percentile\n";
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        if (counts_[i] == 0) continue;
+        cumulative += counts_[i];
+        file << bucketUpperBound(i) << ',' << counts_[i] << ','
+             << 100.0 * static_cast<double>(cumulative) / static_cast<double>(total_count_) << '\n';
+    }
+    spdlog::info("FrameHistogram: {} samples written to '{}'.", total_count_, filepath);
+    return true;
+}
+
+size_t FrameHistogram::bucketIndex(uint64_t value_us) {
+    if (value_us < SUB_BUCKET_COUNT) return static_cast<size_t>(value_us);
+    // 右移到 [64, 128) 区间，移位数决定所在的段，移位后的值决定段内的桶
+    const int shift = std::bit_width(value_us) - SUB_BUCKET_BITS;
+    const auto index = SUB_BUCKET_COUNT + static_cast<uint64_t>(shift - 1) * SUB_BUCKET_HALF + ((value_us >> shift) - SUB_BUCKET_HALF);
+    return static_cast<size_t>(std::min<uint64_t>(index, BUCKET_COUNT - 1));
+}
+
+uint64_t FrameHistogram::bucketUpperBound(size_t index) {
+    if (index < SUB_BUCKET_COUNT) return index;
+    const uint64_t offset = index - SUB_BUCKET_COUNT;
+    const uint64_t shift = offset / SUB_BUCKET_HALF + 1;
+    const uint64_t mantissa = offset % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+} // namespace engine::core
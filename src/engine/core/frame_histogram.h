@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace engine::core {
+
+/**
+ * @brief 帧时间直方图 (HDR风格，对数-线性分桶)，以微秒为单位记录。
+ *
+ * 小于 128us 的值每微秒一个桶；更大的值按 2 的幂分段，每段 64 个等宽的桶，
+ * 因此任意值的相对误差都不超过 1/64 (约1.6%)，而桶的数量固定，记录是 O(1) 且不分配内存。
+ * 最大可记录约 16.7 秒，更大的值计入最后一个桶。
+ */
+class FrameHistogram final {
+    static constexpr int SUB_BUCKET_BITS = 7;
+    static constexpr uint64_t SUB_BUCKET_COUNT = 1ull << SUB_BUCKET_BITS;       ///< @brief 线性区的桶数 (128)
+    static constexpr uint64_t SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;           ///< @brief 每段的桶数 (64)
+    static constexpr int MAX_VALUE_BITS = 24;                                   ///< @brief 最大可记录值 2^24 us
+    static constexpr size_t BUCKET_COUNT = SUB_BUCKET_COUNT + (MAX_VALUE_BITS - SUB_BUCKET_BITS) * SUB_BUCKET_HALF;
+
+    std::array<uint64_t, BUCKET_COUNT> counts_{};
+    uint64_t total_count_{0};
+    uint64_t min_us_{UINT64_MAX};
+    uint64_t max_us_{0};
+    double sum_us_{0.0};
+
+public:
+    FrameHistogram() = default;
+
+    void record(uint64_t value_us);                     ///< @brief 记录一个值 (微秒)
+    void reset();                                       ///< @brief 清空所有记录
+
+    /**
+     * @brief 获取百分位数对应的值
+     * @param percentile 百分位 (0~100)，如 99.0 表示 p99。
+     * @return 该百分位所在桶的上界 (微秒)，没有记录时返回0。
+     */
+    [[nodiscard]] uint64_t getPercentile(double percentile) const;
+
+    [[nodiscard]] uint64_t getCount() const { return total_count_; }
+    [[nodiscard]] uint64_t getMin() const { return total_count_ > 0 ? min_us_ : 0; }
+    [[nodiscard]] uint64_t getMax() const { return max_us_; }
+    [[nodiscard]] double getMean() const { return total_count_ > 0 ? sum_us_ / static_cast<double>(total_count_) : 0.0; }
+
+    /**
+     * @brief 将非空的桶导出为 CSV (列：桶上界(us), 数量, 累计百分位)
+     * @param filepath 文件路径
+     * @return 成功返回 true
+     */
+    [[nodiscard]] bool writeCsv(std::string_view filepath) const;
+
+private:
+    [[nodiscard]] static size_t bucketIndex(uint64_t value_us);
+    [[nodiscard]] static uint64_t bucketUpperBound(size_t index);
+};
+
+} // namespace engine::core
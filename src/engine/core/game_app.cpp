@@ -3,17 +3,26 @@
 #include "context.h"
 #include "config.h"
 #include "game_state.h"
+#include "main_thread_queue.h"
+#include "simulation_thread.h"
+#include "save_service.h"
+#include "replay_manager.h"
 #include "../resource/resource_manager.h"
 #include "../audio/audio_player.h"
+#include "../audio/voice_manager.h"
 #include "../render/renderer.h"
 #include "../render/camera.h"
 #include "../render/text_renderer.h"
 #include "../input/input_manager.h"
+#include "../memory/frame_arena.h"
 #include "../scene/scene_manager.h"
 #include "../utils/events.h"
 #include <SDL3/SDL.h>
+#include <algorithm>
+#include <thread>
 #include <spdlog/spdlog.h>
 #include <entt/signal/dispatcher.hpp>
+#include <entt/core/hashed_string.hpp>
 #include <imgui.h>
 #include <imgui_impl_sdl3.h>
 #include <imgui_impl_sdlrenderer3.h>
@@ -36,15 +45,39 @@ void GameApp::run() {
     }
 
     while (is_running_) {
+        // 限定帧数运行 (压力测试)：达到帧数后退出
+        if (launch_options_.max_frames_ > 0 && frame_count_ >= static_cast<std::uint64_t>(launch_options_.max_frames_)) {
+            logFrameStats();
+            break;
+        }
+        ++frame_count_;
         time_->update();
-        float delta_time = time_->getDeltaTime();
+
+        // 重置帧分配器 (此时模拟线程一定空闲)，并统计上一帧的堆分配次数
+        frame_arena_->beginFrame();
         
+        // 注册后台预加载完成的资源(纹理创建等必须在主线程进行)
+        resource_manager_->update();
+        // 把后台写完的存档作为事件加入队列
+        save_service_->update();
+
         handleEvents();
+        // 处理输入之后再取帧间时间差 (回放录像时，时间缩放在处理输入时恢复)
+        float delta_time = time_->getDeltaTime();
+        if (simulation_thread_) {
+            runThreadedFrame(delta_time);
+            continue;
+        }
         update(delta_time);
         render();
+        // 录制或回放本帧界面派发的事件 (在界面绘制之后、事件分发之前)
+        replay_manager_->flushEvents(*dispatcher_);
 
         // 分发事件(分发消息队列中事件)
         dispatcher_->update();
+
+        // 统一处理本帧累积的音效请求
+        audio_player_->update();
         
         // spdlog::info("delta_time: {}", delta_time);
     }
@@ -58,6 +91,12 @@ void GameApp::registerSceneSetup(std::function<void(engine::core::Context&)> fun
     spdlog::trace("scene setup function registered.");
 }
 
+void GameApp::setLaunchOptions(const LaunchOptions& options)
+{
+    launch_options_ = options;
+    spdlog::info("launch options: headless {}, max frames {}", launch_options_.headless_, launch_options_.max_frames_);
+}
+
 bool GameApp::init() {
     spdlog::trace("initializing GameApp ...");
     if (!scene_setup_func_) {
@@ -69,12 +108,16 @@ bool GameApp::init() {
     if (!initSDL())  return false;
     if (!initGameState()) return false;
     if (!initTime()) return false;
+    if (!initMainThreadQueue()) return false;
+    if (!initFrameArena()) return false;
+    if (!initSaveService()) return false;
     if (!initResourceManager()) return false;
     if (!initAudioPlayer()) return false;
     if (!initRenderer()) return false;
     if (!initCamera()) return false;
     if (!initTextRenderer()) return false;
     if (!initInputManager()) return false;
+    if (!initReplayManager()) return false;
 
     if (!initContext()) return false;
     if (!initSceneManager()) return false;
@@ -86,6 +129,9 @@ bool GameApp::init() {
     // 注册退出事件 (回调函数可以无参数，代表不使用事件结构体中的数据)
     dispatcher_->sink<utils::QuitEvent>().connect<&GameApp::onQuitEvent>(this);
 
+    // 初始场景就绪后再启动模拟线程
+    if (!initSimulationThread()) return false;
+
     is_running_ = true;
     spdlog::trace("GameApp initialized successfully.");
     return true;
@@ -107,14 +153,55 @@ void GameApp::render() {
 
     // 2. 具体渲染代码
     scene_manager_->render();
+    scene_manager_->renderImGui();
 
     // 3. 更新屏幕显示
     renderer_->present();
 }
 
+void GameApp::simulate(float delta_time) {
+    update(delta_time);
+
+    // 录制渲染命令 (不涉及SDL调用)
+    renderer_->clearScreen();
+    scene_manager_->render();
+
+    dispatcher_->update();
+    audio_player_->update();
+}
+
+void GameApp::runThreadedFrame(float delta_time) {
+    // 1. 工作线程开始模拟本帧，渲染命令录制到后台列表
+    renderer_->beginRecording();
+    simulation_thread_->kick([this, delta_time] { simulate(delta_time); });
+
+    // 2. 同时提交上一帧录制的命令，然后等待模拟完成 (期间执行工作线程转交的纹理创建等调用)
+    renderer_->submitRecorded();
+    simulation_thread_->wait();
+
+    // 3. ImGui 直接使用SDL渲染器，只能在模拟完成后于主线程中绘制 (此时仍在录制，期间销毁的纹理会被延迟)
+    scene_manager_->renderImGui();
+    renderer_->present();
+    renderer_->endRecording();
+
+    // 4. 录制或回放界面派发的事件 (在下一帧模拟时分发)
+    replay_manager_->flushEvents(*dispatcher_);
+}
+
 void GameApp::close() {
     spdlog::trace("closing GameApp ...");
 
+    // 按配置导出本次运行的帧时长分布
+    if (time_ && config_ && !config_->frame_time_csv_.empty()) {
+        (void)time_->getFrameHistogram().writeCsv(config_->frame_time_csv_);
+    }
+
+    // 先停止模拟线程，再执行最后录制的命令 (其中可能有延迟销毁的纹理)
+    if (simulation_thread_) {
+        simulation_thread_.reset();
+        renderer_->submitRecorded();
+    }
+
     // --- ImGui 步骤4 清理 ---
     ImGui_ImplSDLRenderer3_Shutdown();
     ImGui_ImplSDL3_Shutdown();
@@ -125,6 +212,8 @@ void GameApp::close() {
 
     // 先关闭场景管理器，确保所有场景都被清理
     scene_manager_->close();
+    // 等待后台存档写完
+    save_service_.reset();
 
     // 为了确保正确的销毁顺序，有些智能指针对象也需要手动管理
     resource_manager_.reset();
@@ -141,6 +230,16 @@ void GameApp::close() {
     is_running_ = false;
 }
 
+void GameApp::logFrameStats() const {
+    const auto& histogram = time_->getFrameHistogram();
+    spdlog::info("{} frames: mean {:.2f} ms, p50 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms",
+                 histogram.getCount(),
+                 histogram.getMean() / 1000.0,
+                 static_cast<double>(histogram.getPercentile(50.0)) / 1000.0,
+                 static_cast<double>(histogram.getPercentile(99.0)) / 1000.0,
+                 static_cast<double>(histogram.getMax()) / 1000.0);
+}
+
 bool GameApp::initDispatcher()
 {
     try {
@@ -167,6 +266,11 @@ bool GameApp::initConfig()
 
 bool GameApp::initSDL()
 {
+    // 无窗口运行：窗口与音频设备都不会真正输出 (渲染到内存中的窗口表面)
+    if (launch_options_.headless_) {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    }
     if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) {
         spdlog::error("SDL initialization failed! SDL error: {}", SDL_GetError());
         return false;
@@ -191,11 +295,12 @@ bool GameApp::initSDL()
     SDL_SetRenderDrawBlendMode(sdl_renderer_, SDL_BLENDMODE_BLEND);
 
     // 设置 VSync (注意: VSync 开启时，驱动程序会尝试将帧率限制到显示器刷新率，有可能会覆盖我们手动设置的 target_fps)
-    int vsync_mode = config_->vsync_enabled_ ? SDL_RENDERER_VSYNC_ADAPTIVE : SDL_RENDERER_VSYNC_DISABLED;
+    const bool vsync_enabled = config_->vsync_enabled_ && !launch_options_.headless_;
+    int vsync_mode = vsync_enabled ? SDL_RENDERER_VSYNC_ADAPTIVE : SDL_RENDERER_VSYNC_DISABLED;
     if (!SDL_SetRenderVSync(sdl_renderer_, vsync_mode)) {
         spdlog::warn("SDL_SetRenderVSync failed! SDL error: {}", SDL_GetError());
     }
-    spdlog::trace("VSync set: {}", config_->vsync_enabled_ ? "Enabled" : "Disabled");
+    spdlog::trace("VSync set: {}", vsync_enabled ? "Enabled" : "Disabled");
 
     // 设置逻辑分辨率 (窗口大小 * 逻辑缩放比例)
     int logical_width = static_cast<int>(static_cast<float>(config_->window_width_) * config_->window_logical_scale_);
@@ -224,11 +329,46 @@ bool GameApp::initTime() {
         spdlog::error("initialize time manager failed: {}", e.what());
         return false;
     }
-    time_->setTargetFps(config_->target_fps_);
+    // 无窗口运行时不限制帧率，测量的是每帧的实际耗时
+    time_->setTargetFps(launch_options_.headless_ ? 0 : config_->target_fps_);
+    time_->setPrecisePacing(config_->precise_frame_pacing_);
     spdlog::trace("time manager initialized successfully.");
     return true;
 }
 
+bool GameApp::initMainThreadQueue() {
+    try {
+        main_thread_queue_ = std::make_unique<MainThreadQueue>();
+    } catch (const std::exception& e) {
+        spdlog::error("initialize main thread queue failed: {}", e.what());
+        return false;
+    }
+    spdlog::trace("main thread queue initialized successfully.");
+    return true;
+}
+
+bool GameApp::initFrameArena() {
+    try {
+        frame_arena_ = std::make_unique<engine::memory::FrameArena>(static_cast<std::size_t>(config_->frame_arena_kb_) * 1024);
+    } catch (const std::exception& e) {
+        spdlog::error("initialize frame arena failed: {}", e.what());
+        return false;
+    }
+    spdlog::trace("frame arena initialized successfully.");
+    return true;
+}
+
+bool GameApp::initSaveService() {
+    try {
+        save_service_ = std::make_unique<SaveService>(*dispatcher_);
+    } catch (const std::exception& e) {
+        spdlog::error("initialize save service failed: {}", e.what());
+        return false;
+    }
+    spdlog::trace("save service initialized successfully.");
+    return true;
+}
+
 bool GameApp::initResourceManager() {
     try {
         resource_manager_ = std::make_unique<engine::resource::ResourceManager>(sdl_renderer_);
@@ -236,17 +376,40 @@ bool GameApp::initResourceManager() {
         spdlog::error("initialize resource manager failed: {}", e.what());
         return false;
     }
+    resource_manager_->setMainThreadQueue(main_thread_queue_.get());
     spdlog::trace("resource manager initialized successfully.");
-    resource_manager_->loadResources("assets/data/resource_mapping.json");  // 载入默认资源映射文件
+    // 设置各类资源的内存预算
+    constexpr size_t MB = 1024 * 1024;
+    resource_manager_->setBudget(engine::resource::ResourceType::TEXTURE, static_cast<size_t>(std::max(0, config_->texture_budget_mb_)) * MB);
+    resource_manager_->setBudget(engine::resource::ResourceType::SOUND, static_cast<size_t>(std::max(0, config_->sound_budget_mb_)) * MB);
+    resource_manager_->setSoundCacheBudget(static_cast<size_t>(std::max(0, config_->sound_pcm_cache_mb_)) * MB);
+    resource_manager_->setBudget(engine::resource::ResourceType::MUSIC, static_cast<size_t>(std::max(0, config_->music_budget_mb_)) * MB);
+    resource_manager_->setBudget(engine::resource::ResourceType::FONT, static_cast<size_t>(std::max(0, config_->font_budget_mb_)) * MB);
+    // 载入默认资源映射文件 (解码在后台线程并行进行，场景使用到某个资源时会等待其就绪)
+    int preload_threads = config_->preload_threads_;
+    if (preload_threads < 0) {
+        preload_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    }
+    resource_manager_->loadResources("assets/data/resource_mapping.json", preload_threads);
     return true;
 }
 
 bool GameApp::initAudioPlayer()
 {
     try {
-        audio_player_ = std::make_unique<engine::audio::AudioPlayer>(resource_manager_.get());
+        engine::audio::VoiceSettings voice_settings;
+        voice_settings.channel_count_ = config_->sound_channels_;
+        voice_settings.direct_channel_count_ = config_->direct_sound_channels_;
+        voice_settings.max_voices_per_sound_ = config_->max_voices_per_sound_;
+        voice_settings.coalesce_window_ms_ = config_->sound_coalesce_ms_;
+        voice_settings.falloff_distance_ = config_->sound_falloff_distance_;
+        audio_player_ = std::make_unique<engine::audio::AudioPlayer>(resource_manager_.get(), voice_settings);
         audio_player_->setMusicVolume(config_->music_volume_);      // 设置背景音乐音量
         audio_player_->setSoundVolume(config_->sound_volume_);      // 设置音效音量
+        // 音效名称与资源映射中的键一致，哈希后即为音效ID
+        for (const auto& [name, policy] : config_->sound_policies_) {
+            audio_player_->getVoiceManager().setSoundPolicy(entt::hashed_string(name.c_str()), {policy.max_voices_, policy.priority_});
+        }
     } catch (const std::exception& e) {
         spdlog::error("initialize audio player failed: {}", e.what());
         return false;
@@ -257,7 +420,7 @@ bool GameApp::initAudioPlayer()
 
 bool GameApp::initRenderer() {
     try {
-        renderer_ = std::make_unique<engine::render::Renderer>(sdl_renderer_, resource_manager_.get());
+        renderer_ = std::make_unique<engine::render::Renderer>(sdl_renderer_, resource_manager_.get(), main_thread_queue_.get());
     } catch (const std::exception& e) {
         spdlog::error("initialize renderer failed: {}", e.what());
         return false;
@@ -280,7 +443,7 @@ bool GameApp::initCamera() {
 bool GameApp::initTextRenderer()
 {
     try {
-        text_renderer_ = std::make_unique<engine::render::TextRenderer>(sdl_renderer_, resource_manager_.get());
+        text_renderer_ = std::make_unique<engine::render::TextRenderer>(renderer_.get(), resource_manager_.get());
     } catch (const std::exception& e) {
         spdlog::error("initialize text renderer failed: {}", e.what());
         return false;
@@ -301,6 +464,24 @@ bool GameApp::initInputManager()
     return true;
 }
 
+bool GameApp::initReplayManager()
+{
+    try {
+        replay_manager_ = std::make_unique<engine::core::ReplayManager>(*time_,
+                                                                        *game_state_,
+                                                                        config_->deterministic_,
+                                                                        config_->deterministic_seed_,
+                                                                        config_->deterministic_fps_,
+                                                                        config_->replay_path_);
+    } catch (const std::exception& e) {
+        spdlog::error("initialize replay manager failed: {}", e.what());
+        return false;
+    }
+    input_manager_->setReplayManager(replay_manager_.get());
+    spdlog::trace("replay manager initialized successfully.");
+    return true;
+}
+
 bool GameApp::initContext()
 {
     try {
@@ -312,7 +493,10 @@ bool GameApp::initContext()
                                                            *resource_manager_, 
                                                            *audio_player_,
                                                            *game_state_,
-                                                           *time_);
+                                                           *time_,
+                                                           *frame_arena_,
+                                                           *save_service_,
+                                                           *replay_manager_);
     } catch (const std::exception& e) {
         spdlog::error("initialize context failed: {}", e.what());
         return false;
@@ -386,6 +570,19 @@ bool GameApp::initImGui()
     return true;
 }
 
+bool GameApp::initSimulationThread()
+{
+    if (!config_->threaded_simulation_) return true;
+    try {
+        simulation_thread_ = std::make_unique<SimulationThread>(*main_thread_queue_);
+    } catch (const std::exception& e) {
+        spdlog::error("initialize simulation thread failed: {}", e.what());
+        return false;
+    }
+    spdlog::info("simulation runs on a worker thread, rendering lags one frame behind.");
+    return true;
+}
+
 void GameApp::onQuitEvent()
 {
     spdlog::trace("GameApp received quit event from event dispatcher.");
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <functional>
 #include <entt/signal/fwd.hpp>
@@ -30,20 +31,42 @@ namespace engine::audio {
 class AudioPlayer;
 }
 
+namespace engine::memory {
+class FrameArena;
+}
+
 namespace engine::core {        // 命名空间的最佳实践：与文件路径一致
 class Time;
 class Config;
 class Context;
 class GameState;
+class MainThreadQueue;
+class SimulationThread;
+class SaveService;
+class ReplayManager;
+
+/**
+ * @brief 启动选项 (来自命令行，优先于配置文件)
+ */
+struct LaunchOptions {
+    bool headless_ = false;         ///< @brief 无窗口运行：使用 offscreen 视频驱动与 dummy 音频驱动，不限制帧率 (压力测试、自动化测试)
+    int max_frames_ = 0;            ///< @brief 运行指定帧数后退出并输出帧时长统计，0 表示不限制
+};
 
 /**
  * @brief 主游戏应用程序类，初始化SDL，管理游戏循环。
+ *
+ * 开启 performance.threaded_simulation 后，每帧的模拟 (场景更新、渲染命令录制、事件分发、音效) 在工作线程中运行，
+ * 主线程同时提交上一帧录制的渲染命令，等待工作线程完成后绘制 ImGui 并呈现。
+ * SDL 渲染调用始终留在主线程，画面比模拟晚一帧。
  */
 class GameApp final {   // final 表示该类不能被继承
 private:
     SDL_Window* window_ = nullptr;
     SDL_Renderer* sdl_renderer_ = nullptr;
     bool is_running_ = false;
+    LaunchOptions launch_options_;
+    std::uint64_t frame_count_ = 0;     ///< @brief 已运行的帧数
 
     /// @brief 游戏场景设置函数，用于在运行游戏前设置初始场景 (GameApp不再决定初始场景是什么)
     std::function<void(engine::core::Context&)> scene_setup_func_;
@@ -51,6 +74,8 @@ private:
     // 引擎组件
     std::unique_ptr<entt::dispatcher> dispatcher_; // 事件总线
     std::unique_ptr<engine::core::Time> time_;
+    std::unique_ptr<engine::memory::FrameArena> frame_arena_;               ///< @brief 帧分配器，每帧开始时重置
+    std::unique_ptr<engine::core::SaveService> save_service_;               ///< @brief 后台存档服务
     std::unique_ptr<engine::resource::ResourceManager> resource_manager_;
     std::unique_ptr<engine::render::Renderer> renderer_;
     std::unique_ptr<engine::render::Camera> camera_;
@@ -61,6 +86,9 @@ private:
     std::unique_ptr<engine::scene::SceneManager> scene_manager_;
     std::unique_ptr<engine::audio::AudioPlayer> audio_player_;
     std::unique_ptr<engine::core::GameState> game_state_;
+    std::unique_ptr<engine::core::ReplayManager> replay_manager_;           ///< @brief 确定性模式与对局录像/回放
+    std::unique_ptr<engine::core::MainThreadQueue> main_thread_queue_;      ///< @brief 工作线程转交到主线程的调用
+    std::unique_ptr<engine::core::SimulationThread> simulation_thread_;     ///< @brief 模拟工作线程 (未开启时为空)
 
 public:
     GameApp();
@@ -78,6 +106,12 @@ public:
      */
     void registerSceneSetup(std::function<void(engine::core::Context&)> func);
 
+    /**
+     * @brief 设置启动选项，需要在 run() 之前调用。
+     * @param options 启动选项
+     */
+    void setLaunchOptions(const LaunchOptions& options);
+
     // 禁止拷贝和移动
     GameApp(const GameApp&) = delete;
     GameApp& operator=(const GameApp&) = delete;
@@ -89,7 +123,10 @@ private:
     void handleEvents();
     void update(float delta_time);
     void render();
+    void simulate(float delta_time);        ///< @brief 在工作线程中运行的一帧：更新、录制渲染命令、分发事件、处理音效
+    void runThreadedFrame(float delta_time);///< @brief (主线程) 交出本帧模拟，提交上一帧渲染命令，然后绘制 ImGui 并呈现
     void close();
+    void logFrameStats() const;             ///< @brief 输出帧时长统计 (限定帧数运行结束时)
 
     // 各模块的初始化/创建函数，在init()中调用
     [[nodiscard]] bool initDispatcher();
@@ -97,15 +134,20 @@ private:
     [[nodiscard]] bool initSDL();
     [[nodiscard]] bool initGameState();
     [[nodiscard]] bool initTime();
+    [[nodiscard]] bool initMainThreadQueue();
+    [[nodiscard]] bool initFrameArena();
+    [[nodiscard]] bool initSaveService();
     [[nodiscard]] bool initResourceManager();
     [[nodiscard]] bool initAudioPlayer();
     [[nodiscard]] bool initRenderer();
     [[nodiscard]] bool initTextRenderer();
     [[nodiscard]] bool initCamera();
     [[nodiscard]] bool initInputManager();
+    [[nodiscard]] bool initReplayManager();
     [[nodiscard]] bool initContext();
     [[nodiscard]] bool initSceneManager();
     [[nodiscard]] bool initImGui();
+    [[nodiscard]] bool initSimulationThread();
     
     // 事件处理函数
     void onQuitEvent();
@@ -0,0 +1,39 @@
+#include "main_thread_queue.h"
+
+namespace engine::core {
+
+MainThreadQueue::MainThreadQueue() : main_thread_id_(std::this_thread::get_id()) {}
+
+void MainThreadQueue::waitUntil(const std::function<bool()>& done) {
+    std::vector<std::function<void()>> pending;
+    std::unique_lock lock(mutex_);
+    while (true) {
+        if (!tasks_.empty()) {
+            // 执行任务时不持有锁，任务期间其它线程可以继续投递
+            pending.swap(tasks_);
+            lock.unlock();
+            for (auto& task : pending) task();
+            pending.clear();
+            lock.lock();
+            continue;
+        }
+        if (done()) return;
+        cv_.wait(lock);
+    }
+}
+
+void MainThreadQueue::notify() {
+    // 加锁后再通知，避免在 waitUntil() 检查条件与进入等待之间丢失通知
+    std::lock_guard lock(mutex_);
+    cv_.notify_all();
+}
+
+void MainThreadQueue::post(std::function<void()> task) {
+    {
+        std::lock_guard lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    cv_.notify_all();
+}
+
+} // namespace engine::core
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace engine::core {
+
+/**
+ * @brief 主线程任务队列。
+ *
+ * SDL 的渲染器与 SDL_ttf 只能在创建它们的主线程中使用。模拟在工作线程中运行时，
+ * 纹理/字体的创建与销毁等少量调用需要转交到主线程执行：工作线程调用 invoke() 后阻塞，
+ * 主线程在 waitUntil() 中等待工作线程期间执行这些任务。
+ * 在主线程中调用 invoke() 会直接执行，因此单线程模式下没有额外开销。
+ */
+class MainThreadQueue final {
+    std::thread::id main_thread_id_;                ///< @brief 构造时所在的线程即为主线程
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<std::function<void()>> tasks_;      ///< @brief 等待主线程执行的任务
+
+public:
+    MainThreadQueue();
+
+    [[nodiscard]] bool isMainThread() const { return std::this_thread::get_id() == main_thread_id_; }
+
+    /**
+     * @brief 在主线程中执行函数并返回结果。
+     * @note 在其它线程中调用时会阻塞，直到主线程在 waitUntil() 中执行完该任务；函数抛出的异常会在调用线程中重新抛出。
+     */
+    template <typename F>
+    auto invoke(F&& func) -> std::invoke_result_t<F&> {
+        using Result = std::invoke_result_t<F&>;
+        if (isMainThread()) {
+            return func();
+        }
+        std::packaged_task<Result()> task(std::forward<F>(func));
+        auto future = task.get_future();
+        post([&task] { task(); });      // task 在 future 就绪前一直有效
+        return future.get();
+    }
+
+    /**
+     * @brief (主线程) 执行转交来的任务，直到 done() 返回 true。
+     * @note done() 在持有队列锁时调用；使其变为 true 的一方随后必须调用 notify()。
+     */
+    void waitUntil(const std::function<bool()>& done);
+
+    void notify();          ///< @brief 唤醒 waitUntil() 重新检查条件
+
+    // 删除复制/移动操作
+    MainThreadQueue(const MainThreadQueue&) = delete;
+    MainThreadQueue& operator=(const MainThreadQueue&) = delete;
+    MainThreadQueue(MainThreadQueue&&) = delete;
+    MainThreadQueue& operator=(MainThreadQueue&&) = delete;
+
+private:
+    void post(std::function<void()> task);
+};
+
+/// @brief 有队列时转交到主线程执行，否则直接执行 (供可能在工作线程中调用的资源管理代码使用)
+template <typename F>
+auto invokeOnMainThread(MainThreadQueue* queue, F&& func) -> std::invoke_result_t<F&> {
+    if (queue) {
+        return queue->invoke(std::forward<F>(func));
+    }
+    return func();
+}
+
+} // namespace engine::core
@@ -0,0 +1,230 @@
+#include "replay_manager.h"
+#include "time.h"
+#include "game_state.h"
+#include "save_service.h"
+#include "../input/input_manager.h"
+#include "../serialization/binary_archive.h"
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <SDL3/SDL_timer.h>
+#include <spdlog/spdlog.h>
+
+namespace engine::core {
+
+namespace {
+
+/// @brief 录像文件头：魔数 + 版本号 (格式变化时递增版本号)
+constexpr std::array<char, 4> REPLAY_MAGIC{'M', 'W', 'R', 'P'};
+constexpr std::uint32_t REPLAY_VERSION = 1;
+
+} // namespace
+
+ReplayManager::ReplayManager(Time& time, GameState& game_state, bool deterministic, std::uint32_t seed, int fixed_fps, std::string replay_path)
+    : time_(time),
+      game_state_(game_state),
+      deterministic_(deterministic),
+      seed_(seed),
+      fixed_delta_time_(1.0 / static_cast<double>(std::max(1, fixed_fps))),
+      replay_path_(std::move(replay_path)) {
+    if (deterministic_) {
+        time_.setFixedDeltaTime(fixed_delta_time_);
+        spdlog::info("ReplayManager: deterministic mode enabled (seed {}, {} ticks per second)", seed_, std::max(1, fixed_fps));
+    }
+    spdlog::trace("ReplayManager build successfully.");
+}
+
+std::uint32_t ReplayManager::nextSeed() const {
+    return deterministic_ ? seed_ : std::random_device{}();
+}
+
+void ReplayManager::startRecording(std::uint32_t seed, std::vector<std::byte> header) {
+    if (!deterministic_) {
+        spdlog::warn("ReplayManager: recording requires deterministic mode, skip");
+        return;
+    }
+    stop();
+    recording_ = {};
+    recording_.seed_ = seed;
+    recording_.fixed_delta_time_ = fixed_delta_time_;
+    recording_.header_ = std::move(header);
+    mode_ = Mode::RECORDING;
+    frame_started_ = false;
+    tick_ = 0;
+    pending_events_.clear();
+    spdlog::info("ReplayManager: recording started (seed {})", seed);
+}
+
+void ReplayManager::stopRecording(SaveService& save_service, std::string path) {
+    if (mode_ != Mode::RECORDING) return;
+    recording_.end_tick_ = frame_started_ ? tick_ + 1 : 0;
+    spdlog::info("ReplayManager: recording stopped ({} ticks, {} input frames, {} events)",
+                 recording_.end_tick_, recording_.frames_.size(), recording_.events_.size());
+    // 编码与写入都在存档服务的工作线程中完成
+    save_service.submit(std::move(path), [recording = std::move(recording_)]() {
+        std::vector<std::byte> buffer;
+        engine::serialization::BinaryOutputArchive archive(buffer);
+        archive.writeBytes(REPLAY_MAGIC.data(), REPLAY_MAGIC.size());
+        archive(REPLAY_VERSION, recording);
+        return buffer;
+    });
+    recording_ = {};
+    pending_events_.clear();
+    mode_ = Mode::IDLE;
+}
+
+bool ReplayManager::loadReplay(const std::string& path) {
+    std::ifstream file(std::filesystem::path(path), std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        spdlog::error("ReplayManager: not open replay file: {}", path);
+        return false;
+    }
+    std::vector<std::byte> buffer(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    file.close();
+
+    // 先读到临时对象，读取失败时保留原有数据
+    Recording recording;
+    try {
+        engine::serialization::BinaryInputArchive archive(buffer);
+        std::array<char, REPLAY_MAGIC.size()> magic{};
+        std::uint32_t version = 0;
+        archive.readBytes(magic.data(), magic.size());
+        archive(version);
+        if (magic != REPLAY_MAGIC || version != REPLAY_VERSION) {
+            spdlog::error("ReplayManager: unsupported replay file: {}", path);
+            return false;
+        }
+        archive(recording);
+    } catch (const std::exception& e) {
+        spdlog::error("ReplayManager: load replay file {} failed: {}", path, e.what());
+        return false;
+    }
+    stop();
+    recording_ = std::move(recording);
+    replay_loaded_ = true;
+    spdlog::info("ReplayManager: replay loaded: {} ({} ticks)", path, recording_.end_tick_);
+    return true;
+}
+
+void ReplayManager::startReplay() {
+    if (!replay_loaded_) {
+        spdlog::warn("ReplayManager: no replay loaded, skip");
+        return;
+    }
+    replay_loaded_ = false;
+    mode_ = Mode::REPLAYING;
+    frame_started_ = false;
+    tick_ = 0;
+    next_frame_ = 0;
+    next_event_ = 0;
+    // 按录制时的步长推进 (即使未开启确定性模式)
+    time_.setFixedDeltaTime(recording_.fixed_delta_time_);
+    replay_start_ns_ = SDL_GetTicksNS();
+    spdlog::info("ReplayManager: replay started (seed {}, {} ticks)", recording_.seed_, recording_.end_tick_);
+}
+
+void ReplayManager::stop() {
+    replay_loaded_ = false;
+    if (mode_ == Mode::REPLAYING) {
+        finishReplay();
+    } else if (mode_ == Mode::RECORDING) {
+        spdlog::info("ReplayManager: recording discarded");
+        recording_ = {};
+        pending_events_.clear();
+        mode_ = Mode::IDLE;
+    }
+}
+
+void ReplayManager::processInput(std::unordered_map<entt::id_type, engine::input::ActionState>& action_states,
+                                 glm::vec2& mouse_position,
+                                 glm::vec2& logical_mouse_position) {
+    if (mode_ == Mode::IDLE) return;
+    tick_ = frame_started_ ? tick_ + 1 : 0;
+    frame_started_ = true;
+
+    if (mode_ == Mode::RECORDING) {
+        InputFrame frame{tick_, {}, mouse_position, logical_mouse_position, time_.getTimeScale(), game_state_.getCurrentState()};
+        for (const auto& [action_name_id, state] : action_states) {
+            if (state != engine::input::ActionState::INACTIVE) {
+                frame.active_actions_.emplace_back(action_name_id, state);
+            }
+        }
+        // 哈希表的遍历顺序与插入历史有关，排序后录像内容才稳定
+        std::sort(frame.active_actions_.begin(), frame.active_actions_.end());
+        const bool unchanged = !recording_.frames_.empty() &&
+                               frame.active_actions_.empty() &&
+                               frame.mouse_position_ == last_frame_.mouse_position_ &&
+                               frame.logical_mouse_position_ == last_frame_.logical_mouse_position_ &&
+                               frame.time_scale_ == last_frame_.time_scale_ &&
+                               frame.state_ == last_frame_.state_;
+        if (!unchanged) {
+            last_frame_ = frame;
+            recording_.frames_.push_back(std::move(frame));
+        }
+        return;
+    }
+
+    // --- 回放 ---
+    if (tick_ >= recording_.end_tick_) {
+        finishReplay();
+        return;
+    }
+    // 未记录的帧：所有动作未激活，其余数据与上一帧相同
+    for (auto& [action_name_id, state] : action_states) {
+        state = engine::input::ActionState::INACTIVE;
+    }
+    if (next_frame_ < recording_.frames_.size() && recording_.frames_[next_frame_].tick_ == tick_) {
+        const auto& frame = recording_.frames_[next_frame_++];
+        for (const auto& [action_name_id, state] : frame.active_actions_) {
+            action_states[action_name_id] = state;
+        }
+        mouse_position = frame.mouse_position_;
+        logical_mouse_position = frame.logical_mouse_position_;
+        time_.setTimeScale(frame.time_scale_);
+        if (game_state_.getCurrentState() != frame.state_) {
+            game_state_.setState(frame.state_);
+        }
+    }
+}
+
+void ReplayManager::flushEvents(entt::dispatcher& dispatcher) {
+    // 开始后的第一帧输入之前派发的事件不属于这一局
+    if (!frame_started_) {
+        pending_events_.clear();
+        return;
+    }
+    if (mode_ == Mode::RECORDING) {
+        for (auto& event : pending_events_) {
+            event.tick_ = tick_;
+            recording_.events_.push_back(std::move(event));
+        }
+        pending_events_.clear();
+    } else if (mode_ == Mode::REPLAYING) {
+        while (next_event_ < recording_.events_.size() && recording_.events_[next_event_].tick_ <= tick_) {
+            const auto& event = recording_.events_[next_event_++];
+            if (auto it = event_types_.find(event.type_); it != event_types_.end()) {
+                it->second(dispatcher, event.payload_);
+            } else {
+                spdlog::warn("ReplayManager: unregistered event type {} at tick {}", event.type_, event.tick_);
+            }
+        }
+    }
+}
+
+void ReplayManager::finishReplay() {
+    const double elapsed_ms = static_cast<double>(SDL_GetTicksNS() - replay_start_ns_) / 1000000.0;
+    const auto ticks = frame_started_ ? tick_ + 1 : 0;
+    spdlog::info("ReplayManager: replay finished: {} / {} ticks in {:.1f} ms ({:.3f} ms per tick)",
+                 std::min(ticks, recording_.end_tick_), recording_.end_tick_, elapsed_ms,
+                 ticks > 0 ? elapsed_ms / static_cast<double>(ticks) : 0.0);
+    mode_ = Mode::IDLE;
+    recording_ = {};
+    // 恢复配置中的步长
+    time_.setFixedDeltaTime(deterministic_ ? fixed_delta_time_ : 0.0);
+}
+
+} // namespace engine::core
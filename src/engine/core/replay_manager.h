@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <entt/core/type_info.hpp>
+#include <entt/signal/dispatcher.hpp>
+
+namespace engine::input {
+    enum class ActionState;
+}
+
+namespace engine::core {
+class Time;
+class GameState;
+class SaveService;
+enum class State;
+
+/**
+ * @brief 确定性模式与对局录像/回放。
+ *
+ * 确定性模式下模拟按固定步长推进，场景使用固定种子的随机数生成器 (engine::utils::Random)，
+ * 因此只要输入相同，对局就完全相同。录像记录的就是这些输入：
+ * - 每帧 InputManager 的动作状态与鼠标位置 (在 InputManager::update 中、触发动作回调之前)，以及时间缩放与游戏状态；
+ * - 界面 (ImGui) 直接派发的游戏事件及其帧号，界面事件类型需先用 registerEvent() 注册。
+ *
+ * 录像只包含一局 (一个关卡场景的生命周期)，以及游戏层提供的初始数据 (header)。
+ * 回放时 InputManager 忽略实际的键盘鼠标输入，界面事件由录像在同一帧的同一位置重新加入事件队列。
+ * 回放结束后输出总帧数与耗时，可用于比较不同版本的性能。
+ *
+ * @note 录制与回放需使用相同的 performance.threaded_simulation 设置 (两种模式下界面事件的分发帧不同)。
+ */
+class ReplayManager final {
+public:
+    enum class Mode {
+        IDLE,           ///< @brief 未录制也未回放
+        RECORDING,      ///< @brief 录制中
+        REPLAYING       ///< @brief 回放中
+    };
+
+private:
+    /// @brief 一帧的输入。所有动作都未激活且其余数据与上一帧相同时不记录这一帧
+    struct InputFrame {
+        std::uint64_t tick_{0};
+        std::vector<std::pair<entt::id_type, engine::input::ActionState>> active_actions_;  ///< @brief 激活中的动作 (按ID排序)
+        glm::vec2 mouse_position_{};
+        glm::vec2 logical_mouse_position_{};
+        float time_scale_{1.0f};
+        State state_{};
+
+        template <typename Archive>
+        void serialize(Archive& archive) {
+            archive(tick_, active_actions_, mouse_position_, logical_mouse_position_, time_scale_, state_);
+        }
+    };
+
+    /// @brief 界面派发的事件 (事件类型ID + 事件的字节)
+    struct RecordedEvent {
+        std::uint64_t tick_{0};
+        entt::id_type type_{0};
+        std::vector<std::byte> payload_;
+
+        template <typename Archive>
+        void serialize(Archive& archive) {
+            archive(tick_, type_, payload_);
+        }
+    };
+
+    /// @brief 一局的录像
+    struct Recording {
+        std::uint32_t seed_{0};                 ///< @brief 场景随机数种子
+        double fixed_delta_time_{0.0};          ///< @brief 每帧时长 (秒)
+        std::uint64_t end_tick_{0};             ///< @brief 总帧数
+        std::vector<std::byte> header_;         ///< @brief 对局的初始数据 (由游戏层编码)
+        std::vector<InputFrame> frames_;
+        std::vector<RecordedEvent> events_;
+
+        template <typename Archive>
+        void serialize(Archive& archive) {
+            archive(seed_, fixed_delta_time_, end_tick_, header_, frames_, events_);
+        }
+    };
+
+    using EnqueueFunc = void (*)(entt::dispatcher&, const std::vector<std::byte>&);
+
+    Time& time_;
+    GameState& game_state_;
+    const bool deterministic_;                  ///< @brief 是否开启确定性模式 (开启时每局都会录制)
+    const std::uint32_t seed_;                  ///< @brief 确定性模式下每局使用的随机数种子
+    const double fixed_delta_time_;             ///< @brief 确定性模式下的每帧时长 (秒)
+    const std::string replay_path_;             ///< @brief 录像文件路径
+
+    Mode mode_{Mode::IDLE};
+    Recording recording_;                       ///< @brief 正在录制或回放的录像
+    bool replay_loaded_{false};                 ///< @brief 是否已载入录像、等待下一局开始时回放
+    bool frame_started_{false};                 ///< @brief 开始后是否已经处理过一帧输入
+    std::uint64_t tick_{0};                     ///< @brief 当前帧号 (从开始录制/回放时计数)
+    std::size_t next_frame_{0};                 ///< @brief 回放：下一个输入帧
+    std::size_t next_event_{0};                 ///< @brief 回放：下一个界面事件
+    InputFrame last_frame_;                     ///< @brief 录制：上一个记录的输入帧 (用于跳过没有变化的帧)
+    std::vector<RecordedEvent> pending_events_; ///< @brief 录制：本帧界面派发、尚未确定帧号的事件
+    std::uint64_t replay_start_ns_{0};          ///< @brief 回放开始时间 (用于统计耗时)
+
+    std::unordered_map<entt::id_type, EnqueueFunc> event_types_;    ///< @brief 已注册的界面事件类型
+
+public:
+    /**
+     * @brief 构造函数
+     * @param time 时间 (确定性模式下设置固定步长)
+     * @param game_state 游戏状态 (录制暂停等由界面直接修改的状态)
+     * @param deterministic 是否开启确定性模式
+     * @param seed 确定性模式下的随机数种子
+     * @param fixed_fps 确定性模式下每秒模拟的帧数 (不影响实际帧率)
+     * @param replay_path 录像文件路径
+     */
+    ReplayManager(Time& time, GameState& game_state, bool deterministic, std::uint32_t seed, int fixed_fps, std::string replay_path);
+
+    // 删除复制/移动操作
+    ReplayManager(const ReplayManager&) = delete;
+    ReplayManager& operator=(const ReplayManager&) = delete;
+    ReplayManager(ReplayManager&&) = delete;
+    ReplayManager& operator=(ReplayManager&&) = delete;
+
+    /**
+     * @brief 注册一种可录制的界面事件 (事件需可平凡复制、可默认构造)
+     * @tparam Event 事件类型
+     */
+    template <typename Event>
+    void registerEvent() {
+        static_assert(std::is_trivially_copyable_v<Event>, "ReplayManager: recorded events must be trivially copyable");
+        event_types_[entt::type_hash<Event>::value()] = [](entt::dispatcher& dispatcher, const std::vector<std::byte>& payload) {
+            Event event{};
+            std::memcpy(&event, payload.data(), sizeof(Event));
+            dispatcher.enqueue(event);
+        };
+    }
+
+    /**
+     * @brief 录制一个界面派发的事件 (未在录制时什么也不做)。调用者仍需自行把事件加入事件队列。
+     * @tparam Event 事件类型 (需先注册)
+     */
+    template <typename Event>
+    void recordEvent(const Event& event) {
+        if (mode_ != Mode::RECORDING) return;
+        RecordedEvent recorded{0, entt::type_hash<Event>::value(), std::vector<std::byte>(sizeof(Event))};
+        std::memcpy(recorded.payload_.data(), &event, sizeof(Event));
+        pending_events_.push_back(std::move(recorded));
+    }
+
+    // --- 对局的开始与结束 (由游戏层的关卡场景调用) ---
+    [[nodiscard]] std::uint32_t nextSeed() const;                       ///< @brief 新对局使用的随机数种子
+    void startRecording(std::uint32_t seed, std::vector<std::byte> header);    ///< @brief 开始录制 (仅确定性模式)
+    void stopRecording(SaveService& save_service, std::string path);    ///< @brief 停止录制，在后台写入录像文件
+
+    [[nodiscard]] bool loadReplay(const std::string& path);             ///< @brief 载入录像，下一局开始时回放
+    void startReplay();                                                 ///< @brief 开始回放已载入的录像
+    void stop();                                                        ///< @brief 停止录制或回放 (不保存)，并丢弃已载入的录像
+
+    // --- 每帧调用 ---
+    /**
+     * @brief (InputManager) 录制或覆盖本帧的输入，在处理完 SDL 事件、触发动作回调之前调用
+     * @param action_states 动作状态
+     * @param mouse_position 鼠标位置 (屏幕坐标)
+     * @param logical_mouse_position 鼠标位置 (逻辑坐标)
+     */
+    void processInput(std::unordered_map<entt::id_type, engine::input::ActionState>& action_states,
+                      glm::vec2& mouse_position,
+                      glm::vec2& logical_mouse_position);
+
+    /**
+     * @brief (GameApp) 在界面绘制之后调用：录制时为本帧的界面事件标记帧号，回放时把本帧的界面事件加入事件队列
+     * @param dispatcher 事件分发器
+     */
+    void flushEvents(entt::dispatcher& dispatcher);
+
+    // --- getters ---
+    [[nodiscard]] Mode getMode() const { return mode_; }
+    [[nodiscard]] bool isRecording() const { return mode_ == Mode::RECORDING; }
+    [[nodiscard]] bool isReplaying() const { return mode_ == Mode::REPLAYING; }
+    [[nodiscard]] bool hasLoadedReplay() const { return replay_loaded_; }
+    [[nodiscard]] bool isDeterministic() const { return deterministic_; }
+    [[nodiscard]] const std::string& getReplayPath() const { return replay_path_; }
+    [[nodiscard]] std::uint64_t getTick() const { return tick_; }
+    [[nodiscard]] std::uint64_t getEndTick() const { return recording_.end_tick_; }
+    [[nodiscard]] std::uint32_t getReplaySeed() const { return recording_.seed_; }
+    [[nodiscard]] const std::vector<std::byte>& getReplayHeader() const { return recording_.header_; }
+
+private:
+    void finishReplay();        ///< @brief 回放完毕，输出耗时统计
+};
+
+} // namespace engine::core
@@ -0,0 +1,170 @@
+#include "save_service.h"
+#include "../utils/events.h"
+#include <algorithm>
+#include <cstdio>
+#include <system_error>
+#include <utility>
+#include <spdlog/spdlog.h>
+#include <entt/signal/dispatcher.hpp>
+
+#ifdef _WIN32
+#include <io.h>         // _commit, _fileno
+#else
+#include <fcntl.h>      // open
+#include <unistd.h>     // fsync, close
+#endif
+
+namespace engine::core {
+
+namespace {
+
+/// @brief 把文件内容刷新到磁盘 (不只是操作系统缓存)
+bool syncFile(std::FILE* file) {
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+/// @brief 刷新目录项，确保重命名本身也已落盘 (Windows 上重命名由文件系统日志保证)
+void syncDirectory([[maybe_unused]] const std::filesystem::path& directory) {
+#ifndef _WIN32
+    const auto path = directory.empty() ? std::filesystem::path(".") : directory;
+    if (int fd = open(path.c_str(), O_RDONLY); fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+#endif
+}
+
+} // namespace
+
+SaveService::SaveService(entt::dispatcher& dispatcher)
+    : dispatcher_(dispatcher), worker_(&SaveService::workerLoop, this) {
+    spdlog::trace("SaveService build successfully.");
+}
+
+SaveService::~SaveService() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) worker_.join();
+    spdlog::trace("SaveService destroyed.");
+}
+
+void SaveService::submit(std::string path, EncodeFunc encode) {
+    {
+        std::lock_guard lock(mutex_);
+        // 同一文件的写入还在排队时，只保留最新的数据
+        auto it = std::find_if(jobs_.begin(), jobs_.end(), [&path](const Job& job) { return job.path_ == path; });
+        if (it != jobs_.end()) {
+            it->encode_ = std::move(encode);
+            spdlog::debug("SaveService: superseded queued save {}", path);
+            return;
+        }
+        jobs_.push_back({std::move(path), std::move(encode), Clock::now()});
+    }
+    cv_.notify_all();
+}
+
+void SaveService::update() {
+    std::vector<Result> results;
+    {
+        std::lock_guard lock(mutex_);
+        if (results_.empty()) return;
+        results.swap(results_);
+    }
+    for (auto& result : results) {
+        if (result.success_) {
+            spdlog::info("SaveService: saved {} ({} bytes, {:.2f} ms)", result.path_, result.bytes_, result.latency_ms_);
+        } else {
+            spdlog::error("SaveService: failed to save {}: {}", result.path_, result.error_);
+        }
+        dispatcher_.enqueue(engine::utils::SaveCompletedEvent{std::move(result.path_), result.success_, std::move(result.error_)});
+    }
+}
+
+void SaveService::flush() {
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this] { return jobs_.empty() && in_flight_ == 0; });
+}
+
+bool SaveService::isBusy() {
+    std::lock_guard lock(mutex_);
+    return !jobs_.empty() || in_flight_ > 0;
+}
+
+bool SaveService::writeFileAtomic(const std::filesystem::path& path, std::span<const std::byte> data, std::string& error) {
+    std::error_code ec;
+    const auto directory = path.parent_path();
+    if (!directory.empty()) {
+        std::filesystem::create_directories(directory, ec);
+        if (ec) {
+            error = "create directory " + directory.string() + ": " + ec.message();
+            return false;
+        }
+    }
+
+    auto temp_path = path;
+    temp_path += ".tmp";
+    std::FILE* file = std::fopen(temp_path.string().c_str(), "wb");
+    if (!file) {
+        error = "open " + temp_path.string() + " for writing";
+        return false;
+    }
+    const bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    const bool synced = written && std::fflush(file) == 0 && syncFile(file);
+    const bool closed = std::fclose(file) == 0;
+    if (!written || !synced || !closed) {
+        error = "write " + temp_path.string();
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+
+    // 重命名是原子的：目标文件始终是完整的旧存档或新存档
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        error = "rename " + temp_path.string() + ": " + ec.message();
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+    syncDirectory(directory);
+    return true;
+}
+
+void SaveService::workerLoop() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+            if (jobs_.empty()) return;          // 只有队列写完才退出
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+            ++in_flight_;
+        }
+
+        Result result;
+        result.path_ = job.path_;
+        try {
+            const auto data = job.encode_();
+            result.bytes_ = data.size();
+            result.success_ = writeFileAtomic(job.path_, data, result.error_);
+        } catch (const std::exception& e) {
+            result.error_ = e.what();
+        }
+        result.latency_ms_ = std::chrono::duration<double, std::milli>(Clock::now() - job.submit_time_).count();
+
+        {
+            std::lock_guard lock(mutex_);
+            results_.push_back(std::move(result));
+            --in_flight_;
+        }
+        cv_.notify_all();       // 唤醒 flush()
+    }
+}
+
+} // namespace engine::core
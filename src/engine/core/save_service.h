@@ -0,0 +1,93 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include <entt/signal/fwd.hpp>
+
+namespace engine::core {
+
+/**
+ * @brief 后台存档服务，存档的编码与写入都在工作线程中完成，调用线程只需把数据复制一份提交。
+ *
+ * 每个文件先写入同目录下的临时文件，刷新到磁盘 (fsync) 后再原子地重命名为目标文件，
+ * 因此写入过程中崩溃或断电时，目标文件要么是旧的存档，要么是完整的新存档。
+ * 同一路径的写入尚未开始时再次提交，只保留最新的一次。
+ * 写入完成后由 update() 在主线程中把 engine::utils::SaveCompletedEvent 加入事件队列。
+ */
+class SaveService final {
+public:
+    using Clock = std::chrono::steady_clock;
+    /// @brief 编码函数，在工作线程中调用，只能访问自己捕获的数据
+    using EncodeFunc = std::function<std::vector<std::byte>()>;
+
+private:
+    struct Job {
+        std::string path_;
+        EncodeFunc encode_;
+        Clock::time_point submit_time_;
+    };
+
+    struct Result {
+        std::string path_;
+        bool success_{false};
+        std::string error_;
+        std::size_t bytes_{0};
+        double latency_ms_{};       ///< @brief 从提交到写入完成的时长 (毫秒)
+    };
+
+    entt::dispatcher& dispatcher_;
+
+    // --- 受 mutex_ 保护 ---
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Job> jobs_;              ///< @brief 等待写入的任务
+    std::vector<Result> results_;       ///< @brief 已完成、等待主线程分发的结果
+    std::size_t in_flight_{0};          ///< @brief 正在写入的任务数
+    bool stopping_{false};
+
+    std::thread worker_;                ///< @brief 写入线程 (最后声明，确保其它成员先于线程构造、晚于线程析构)
+
+public:
+    explicit SaveService(entt::dispatcher& dispatcher);
+    ~SaveService();                     ///< @brief 写完队列中剩余的存档后退出 (存档不能丢弃)
+
+    // 删除复制/移动操作
+    SaveService(const SaveService&) = delete;
+    SaveService& operator=(const SaveService&) = delete;
+    SaveService(SaveService&&) = delete;
+    SaveService& operator=(SaveService&&) = delete;
+
+    /**
+     * @brief 提交一次存档
+     * @param path 目标文件路径 (父目录不存在时自动创建)
+     * @param encode 编码函数，在工作线程中调用
+     */
+    void submit(std::string path, EncodeFunc encode);
+
+    void update();                      ///< @brief (主线程) 把已完成的结果作为事件加入事件队列，每帧调用
+    void flush();                       ///< @brief 阻塞等待队列中的存档全部写完 (读档前调用，避免读到旧文件)
+    [[nodiscard]] bool isBusy();        ///< @brief 是否还有未写完的存档
+
+    /**
+     * @brief 原子地写入文件：写入临时文件、刷新到磁盘后重命名为目标文件
+     * @param path 目标文件路径
+     * @param data 文件内容
+     * @param error 失败时写入错误信息
+     * @return 是否成功
+     */
+    [[nodiscard]] static bool writeFileAtomic(const std::filesystem::path& path, std::span<const std::byte> data, std::string& error);
+
+private:
+    void workerLoop();
+};
+
+} // namespace engine::core
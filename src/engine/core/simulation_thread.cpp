@@ -0,0 +1,65 @@
+#include "simulation_thread.h"
+#include "main_thread_queue.h"
+#include <spdlog/spdlog.h>
+#include <utility>
+
+namespace engine::core {
+
+SimulationThread::SimulationThread(MainThreadQueue& main_queue)
+    : main_queue_(main_queue), thread_(&SimulationThread::run, this) {
+    spdlog::trace("SimulationThread started.");
+}
+
+SimulationThread::~SimulationThread() {
+    if (isBusy()) {
+        spdlog::warn("SimulationThread destroyed while a job is running, waiting for it.");
+        main_queue_.waitUntil([this] { return !isBusy(); });
+    }
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) thread_.join();
+    spdlog::trace("SimulationThread stopped.");
+}
+
+void SimulationThread::kick(std::function<void()> job) {
+    {
+        std::lock_guard lock(mutex_);
+        job_ = std::move(job);
+        busy_.store(true, std::memory_order_release);
+    }
+    cv_.notify_one();
+}
+
+void SimulationThread::wait() {
+    main_queue_.waitUntil([this] { return !isBusy(); });
+    if (error_) {
+        std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+}
+
+void SimulationThread::run() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || job_; });
+            if (stop_) return;
+            job = std::move(job_);
+            job_ = nullptr;
+        }
+
+        try {
+            job();
+        } catch (...) {
+            error_ = std::current_exception();
+        }
+
+        busy_.store(false, std::memory_order_release);
+        main_queue_.notify();
+    }
+}
+
+} // namespace engine::core
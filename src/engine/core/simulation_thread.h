@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace engine::core {
+class MainThreadQueue;
+
+/**
+ * @brief 常驻的模拟工作线程，每帧执行一次由主线程交给它的任务。
+ *
+ * 主线程调用 kick() 交出本帧的模拟任务，随后可以并行地做自己的工作，
+ * 最后调用 wait() 等待任务完成；等待期间会执行工作线程转交到主线程的调用 (见 MainThreadQueue)。
+ * 任务中抛出的异常会在 wait() 中重新抛出。
+ */
+class SimulationThread final {
+    MainThreadQueue& main_queue_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::function<void()> job_;             ///< @brief 本帧的任务
+    std::atomic<bool> busy_{false};         ///< @brief 任务已交出但尚未完成
+    bool stop_{false};
+    std::exception_ptr error_;              ///< @brief 任务中抛出的异常
+
+    std::thread thread_;                    ///< @brief 最后声明，保证线程启动时其它成员都已构造
+
+public:
+    explicit SimulationThread(MainThreadQueue& main_queue);
+    ~SimulationThread();                    ///< @brief 停止并回收线程 (必须在任务完成后销毁)
+
+    void kick(std::function<void()> job);   ///< @brief (主线程) 交出本帧的任务，上一个任务必须已经 wait() 完成
+    void wait();                            ///< @brief (主线程) 等待任务完成，期间执行转交到主线程的调用
+
+    [[nodiscard]] bool isBusy() const { return busy_.load(std::memory_order_acquire); }
+
+    // 删除复制/移动操作
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+    SimulationThread(SimulationThread&&) = delete;
+    SimulationThread& operator=(SimulationThread&&) = delete;
+
+private:
+    void run();                             ///< @brief 工作线程主循环
+};
+
+} // namespace engine::core
@@ -1,6 +1,9 @@
 #include "time.h"
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL_timer.h>    // 用于 SDL_GetTicksNS()
+#include <algorithm>
+#include <cmath>
+#include <thread>
 
 namespace engine::core {
 
@@ -21,6 +24,11 @@ void Time::update() {
     }
 
     last_time_ = SDL_GetTicksNS(); // 记录离开 update 时的时间戳
+    frame_histogram_.record(static_cast<Uint64>(delta_time_ * 1000000.0));
+    // 固定步长时，直方图仍记录实际帧时长，模拟只使用固定值
+    if (fixed_delta_time_ > 0.0) {
+        delta_time_ = fixed_delta_time_;
+    }
 }
 
 void Time::limitFrameRate(float current_delta_time) {
@@ -28,8 +36,42 @@ void Time::limitFrameRate(float current_delta_time) {
     if (current_delta_time < target_frame_time_) {
         double time_to_wait = target_frame_time_ - current_delta_time;
         Uint64 ns_to_wait = static_cast<Uint64>(time_to_wait * 1000000000.0);
-        SDL_DelayNS(ns_to_wait);
-        delta_time_ = static_cast<double>(SDL_GetTicksNS() - last_time_) / 1000000000.0;
+        if (precise_pacing_) {
+            waitUntil(frame_start_time_ + ns_to_wait);
+        } else {
+            SDL_DelayNS(ns_to_wait);
+        }
+    }
+    delta_time_ = static_cast<double>(SDL_GetTicksNS() - last_time_) / 1000000000.0;
+}
+
+void Time::waitUntil(Uint64 deadline_ns) {
+    constexpr Uint64 SLEEP_STEP_NS = 1000000;   // 每次睡眠 1ms，睡眠越短，耗时的波动越小
+    Uint64 now = SDL_GetTicksNS();
+    // 剩余时间足够“睡一次还不会超时”时才睡眠
+    while (now < deadline_ns && static_cast<double>(deadline_ns - now) > sleep_estimate_ns_) {
+        SDL_DelayNS(SLEEP_STEP_NS);
+        const Uint64 after = SDL_GetTicksNS();
+        const double observed = static_cast<double>(after - now);
+        now = after;
+
+        // 更新睡眠耗时的均值与方差，估计值取“均值 + 标准差”
+        ++sleep_count_;
+        const double delta = observed - sleep_mean_ns_;
+        sleep_mean_ns_ += delta / static_cast<double>(sleep_count_);
+        sleep_m2_ += delta * (observed - sleep_mean_ns_);
+        const double stddev = std::sqrt(sleep_m2_ / static_cast<double>(sleep_count_ - 1));
+        sleep_estimate_ns_ = sleep_mean_ns_ + stddev;
+
+        // 定期“遗忘”旧样本，使估计值能跟上系统负载的变化
+        if (sleep_count_ >= 10000) {
+            sleep_count_ = 100;
+            sleep_m2_ = stddev * stddev * static_cast<double>(sleep_count_ - 1);
+        }
+    }
+    // 最后一段自旋等待 (让出时间片，避免完全占满CPU核心)
+    while (SDL_GetTicksNS() < deadline_ns) {
+        std::this_thread::yield();
     }
 }
 
@@ -37,6 +79,11 @@ float Time::getDeltaTime() const {
     return static_cast<float>(delta_time_ * time_scale_);
 }
 
+void Time::setFixedDeltaTime(double seconds) {
+    fixed_delta_time_ = std::max(0.0, seconds);
+    spdlog::info("Fixed delta time set to: {:.6f} s", fixed_delta_time_);
+}
+
 float Time::getUnscaledDeltaTime() const {
     return static_cast<float>(delta_time_);
 }
@@ -74,4 +121,9 @@ int Time::getTargetFps() const {
     return target_fps_;
 }
 
+void Time::setPrecisePacing(bool enabled) {
+    precise_pacing_ = enabled;
+    spdlog::info("Precise frame pacing: {}", enabled ? "on" : "off");
+}
+
 } // namespace engine::core 
\ No newline at end of file
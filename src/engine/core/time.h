@@ -1,5 +1,6 @@
 #pragma once
 
+#include "frame_histogram.h"
 #include <SDL3/SDL_stdinc.h>    // 用于 Uint64
 
 namespace engine::core {
@@ -9,6 +10,10 @@ namespace engine::core {
  *
  * 使用 SDL 的高精度性能计数器来确保时间测量的准确性。
  * 提供获取缩放和未缩放 DeltaTime 的方法，以及设置时间缩放因子的能力。
+ *
+ * 帧率限制采用“粗睡眠 + 自旋”的方式：先以 1ms 为单位睡眠，同时统计系统睡眠的实际耗时，
+ * 当剩余时间小于“平均耗时 + 标准差”的估计值时改为让出CPU的自旋等待，直到截止时间。
+ * 每帧的时长记录在直方图中，用于查看 p50/p95/p99 等统计。
  */
 class Time final{
 private:
@@ -16,10 +21,20 @@ private:
     Uint64 frame_start_time_ = 0;  ///< @brief 当前帧开始的时间戳 (用于帧率限制)
     double delta_time_ = 0.0;      ///< @brief 未缩放的帧间时间差 (秒)
     double time_scale_ = 1.0;      ///< @brief 时间缩放因子
+    double fixed_delta_time_ = 0.0;///< @brief 固定帧间时间差 (秒)，大于 0 时不再使用实际耗时 (确定性模式)
 
     // 帧率限制相关
     int target_fps_ = 0;             ///< @brief 目标 FPS (0 表示不限制)
     double target_frame_time_ = 0.0; ///< @brief 目标每帧时间 (秒)
+    bool precise_pacing_ = true;     ///< @brief 是否使用“睡眠 + 自旋”的精确帧率限制 (否则只睡眠)
+
+    // 睡眠耗时统计 (Welford 在线算法，单位纳秒)，用于估计何时从睡眠切换到自旋
+    double sleep_estimate_ns_ = 5000000.0;  ///< @brief 剩余时间小于此值时开始自旋
+    double sleep_mean_ns_ = 5000000.0;
+    double sleep_m2_ = 0.0;
+    Uint64 sleep_count_ = 1;
+
+    FrameHistogram frame_histogram_;    ///< @brief 帧时长直方图 (微秒)
 
 public:
     Time();
@@ -78,6 +93,21 @@ public:
      */
     int getTargetFps() const;
 
+    /**
+     * @brief 设置固定帧间时间差。确定性模式下每帧都按相同的时长推进模拟，对局才能被精确复现。
+     *
+     * @param seconds 每帧时长 (秒)，0 表示使用实际耗时。帧率限制不受影响。
+     */
+    void setFixedDeltaTime(double seconds);
+    double getFixedDeltaTime() const { return fixed_delta_time_; }            ///< @brief 固定帧间时间差 (0 表示未启用)
+
+    void setPrecisePacing(bool enabled);                                    ///< @brief 设置是否使用精确帧率限制
+    bool isPrecisePacing() const { return precise_pacing_; }                ///< @brief 是否使用精确帧率限制
+    double getSleepEstimate() const { return sleep_estimate_ns_ / 1000000.0; }  ///< @brief 当前的睡眠耗时估计 (毫秒)
+
+    FrameHistogram& getFrameHistogram() { return frame_histogram_; }                ///< @brief 帧时长直方图
+    const FrameHistogram& getFrameHistogram() const { return frame_histogram_; }
+
 private:
     /**
      * @brief update 中调用，用于限制帧率。如果设置了 target_fps_ > 0，且当前帧执行时间小于目标帧时间，则会调用 SDL_DelayNS() 来等待剩余时间。
@@ -85,6 +115,13 @@ private:
      * @param current_delta_time 当前帧的执行时间（秒）
      */
     void limitFrameRate(float current_delta_time);
+
+    /**
+     * @brief 精确等待到指定时间戳：先按 1ms 睡眠并学习睡眠耗时，最后一段改为自旋。
+     *
+     * @param deadline_ns 截止时间戳 (SDL_GetTicksNS)
+     */
+    void waitUntil(Uint64 deadline_ns);
 };
 
 } // namespace engine::core
\ No newline at end of file
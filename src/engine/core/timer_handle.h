@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace engine::core {
+
+/**
+ * @brief 时间轮中计时器的句柄。
+ *
+ * 句柄只是 (索引, 代数) 的组合，计时器触发或被取消后代数会递增，
+ * 因此过期的句柄可以安全地保存在组件里，查询时会被识别为无效。
+ */
+struct TimerHandle {
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index_{INVALID_INDEX};     ///< @brief 计时器在池中的索引
+    uint32_t generation_{0};            ///< @brief 创建句柄时计时器的代数
+};
+
+} // namespace engine::core
@@ -0,0 +1,177 @@
+#include "timing_wheel.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace engine::core {
+
+TimingWheel::TimingWheel(double tick_seconds)
+    : tick_seconds_(tick_seconds) {
+    if (tick_seconds_ <= 0.0) {
+        throw std::runtime_error("TimingWheel build failed: tick length must be positive.");
+    }
+    spdlog::trace("TimingWheel build successfully, tick: {} s", tick_seconds_);
+}
+
+void TimingWheel::disconnect(entt::id_type kind) {
+    callbacks_.erase(kind);
+}
+
+TimerHandle TimingWheel::schedule(float delay, entt::id_type kind, entt::entity entity) {
+    uint32_t index;
+    if (!free_list_.empty()) {
+        index = free_list_.back();
+        free_list_.pop_back();
+    } else {
+        index = static_cast<uint32_t>(timers_.size());
+        timers_.emplace_back();
+    }
+
+    // 在第 t 个刻度处理完时，时间轮走过了 (t + 1) 个刻度，
+    // 因此到期刻度取“走过的时间不少于延迟”的第一个刻度 (减去极小值避免浮点误差多等一个刻度)
+    const double ticks = std::ceil((accumulator_ + std::max(0.0f, delay)) / tick_seconds_ - 1e-6);
+    const auto offset = static_cast<uint64_t>(std::max(0.0, ticks));
+    auto& timer = timers_[index];
+    timer.expire_tick_ = current_tick_ + (offset > 0 ? offset - 1 : 0);
+    timer.kind_ = kind;
+    timer.entity_ = entity;
+    timer.active_ = true;
+    ++active_count_;
+    insert(index);
+    return TimerHandle{index, timer.generation_};
+}
+
+bool TimingWheel::reschedule(TimerHandle& handle, float delay) {
+    const auto* timer = find(handle);
+    if (!timer) return false;
+    const auto kind = timer->kind_;
+    const auto entity = timer->entity_;
+    cancel(handle);
+    handle = schedule(delay, kind, entity);
+    return true;
+}
+
+void TimingWheel::cancel(TimerHandle& handle) {
+    if (find(handle)) {
+        release(handle.index_);
+    }
+    handle = TimerHandle{};
+}
+
+void TimingWheel::advance(float delta_time) {
+    if (delta_time <= 0.0f) return;
+    accumulator_ += delta_time;
+    while (accumulator_ >= tick_seconds_) {
+        accumulator_ -= tick_seconds_;
+        tick();
+    }
+}
+
+void TimingWheel::clear() {
+    for (auto& level : levels_) {
+        for (auto& slot : level) {
+            slot.clear();
+        }
+    }
+    free_list_.clear();
+    for (uint32_t i = 0; i < timers_.size(); ++i) {
+        auto& timer = timers_[i];
+        if (timer.active_) {
+            timer.active_ = false;
+            ++timer.generation_;
+        }
+        free_list_.push_back(i);
+    }
+    active_count_ = 0;
+}
+
+bool TimingWheel::isActive(const TimerHandle& handle) const {
+    return find(handle) != nullptr;
+}
+
+float TimingWheel::remaining(const TimerHandle& handle) const {
+    const auto* timer = find(handle);
+    if (!timer) return 0.0f;
+    const double ticks = static_cast<double>(timer->expire_tick_ + 1 - current_tick_);
+    return static_cast<float>(std::max(0.0, ticks * tick_seconds_ - accumulator_));
+}
+
+double TimingWheel::getTime() const {
+    return static_cast<double>(current_tick_) * tick_seconds_ + accumulator_;
+}
+
+void TimingWheel::tick() {
+    // 第 0 层转完一圈时，把上一层对应槽中的计时器下放；逐层向上，直到某层没有转完一圈
+    const uint64_t slot = current_tick_ & SLOT_MASK;
+    if (slot == 0) {
+        for (int level = 1; level < LEVEL_COUNT; ++level) {
+            const uint64_t level_slot = (current_tick_ >> (level * LEVEL_BITS)) & SLOT_MASK;
+            cascade(level, level_slot);
+            if (level_slot != 0) break;
+        }
+    }
+
+    // 先推进刻度，回调中新调度的零延迟计时器会落到下一个刻度，而不是正在处理的槽
+    ++current_tick_;
+    expired_.clear();
+    std::swap(expired_, levels_[0][slot]);
+    for (const auto& entry : expired_) {
+        auto& timer = timers_[entry.index_];
+        if (!timer.active_ || timer.generation_ != entry.generation_) continue;
+        // 回调可能调度新的计时器导致池扩容，先复制出所需信息再释放
+        const auto kind = timer.kind_;
+        const auto entity = timer.entity_;
+        release(entry.index_);
+        if (auto it = callbacks_.find(kind); it != callbacks_.end() && it->second) {
+            it->second(entity);
+        } else {
+            spdlog::warn("TimingWheel: no callback connected for timer kind {}.", kind);
+        }
+    }
+}
+
+void TimingWheel::cascade(int level, uint64_t slot) {
+    auto entries = std::move(levels_[static_cast<size_t>(level)][slot]);
+    levels_[static_cast<size_t>(level)][slot].clear();
+    for (const auto& entry : entries) {
+        const auto& timer = timers_[entry.index_];
+        if (!timer.active_ || timer.generation_ != entry.generation_) continue;
+        insert(entry.index_);
+    }
+}
+
+void TimingWheel::insert(uint32_t index) {
+    auto& timer = timers_[index];
+    timer.expire_tick_ = std::max(timer.expire_tick_, current_tick_);
+    uint64_t delta = timer.expire_tick_ - current_tick_;
+    if (delta > MAX_DELAY_TICKS) {
+        spdlog::warn("TimingWheel: delay of {} ticks exceeds wheel range, clamped.", delta);
+        delta = MAX_DELAY_TICKS;
+        timer.expire_tick_ = current_tick_ + delta;
+    }
+
+    int level = 0;
+    while (level < LEVEL_COUNT - 1 && delta >= (1ull << ((level + 1) * LEVEL_BITS))) {
+        ++level;
+    }
+    const uint64_t slot = (timer.expire_tick_ >> (level * LEVEL_BITS)) & SLOT_MASK;
+    levels_[static_cast<size_t>(level)][slot].push_back({index, timer.generation_});
+}
+
+void TimingWheel::release(uint32_t index) {
+    auto& timer = timers_[index];
+    timer.active_ = false;
+    ++timer.generation_;
+    free_list_.push_back(index);
+    --active_count_;
+}
+
+const TimingWheel::Timer* TimingWheel::find(const TimerHandle& handle) const {
+    if (handle.index_ >= timers_.size()) return nullptr;
+    const auto& timer = timers_[handle.index_];
+    if (!timer.active_ || timer.generation_ != handle.generation_) return nullptr;
+    return &timer;
+}
+
+} // namespace engine::core
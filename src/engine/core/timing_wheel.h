@@ -0,0 +1,147 @@
+#pragma once
+
+#include "timer_handle.h"
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include <entt/entity/entity.hpp>
+#include <entt/signal/delegate.hpp>
+
+namespace engine::core {
+
+/**
+ * @brief 分层时间轮，按模拟时间调度一次性的计时器。
+ *
+ * 以固定的刻度 (默认 1 毫秒) 推进，共 4 层、每层 256 个槽：
+ * 第 0 层直接对应接下来的 256 个刻度，更远的计时器放在高层，
+ * 在低层转完一圈时再逐级“下放”(cascade) 到低层。
+ * 插入、取消都是 O(1)，每帧的开销只与到期(及下放)的计时器数量有关，与实体数量无关。
+ *
+ * 每个计时器带有一个类型 (kind) 和可选的实体，到期时调用该类型注册的回调。
+ * 取消采用惰性删除：只递增计时器的代数，槽内的旧记录在被访问时跳过。
+ *
+ * @note 时间轮只在 advance() 被调用时推进，暂停时不调用即可冻结所有计时器。
+ */
+class TimingWheel final {
+public:
+    using Callback = entt::delegate<void(entt::entity)>;
+
+private:
+    static constexpr int LEVEL_BITS = 8;
+    static constexpr int LEVEL_COUNT = 4;
+    static constexpr uint64_t SLOT_COUNT = 1ull << LEVEL_BITS;
+    static constexpr uint64_t SLOT_MASK = SLOT_COUNT - 1;
+    static constexpr uint64_t MAX_DELAY_TICKS = (1ull << (LEVEL_BITS * LEVEL_COUNT)) - 1;
+
+    /// @brief 计时器池中的一项
+    struct Timer {
+        uint64_t expire_tick_{0};               ///< @brief 到期的刻度
+        entt::id_type kind_{0};                 ///< @brief 计时器类型，用于查找回调
+        entt::entity entity_{entt::null};       ///< @brief 关联的实体 (可为空)
+        uint32_t generation_{0};                ///< @brief 代数，每次释放时递增
+        bool active_{false};
+    };
+
+    /// @brief 槽内的记录，代数不匹配说明计时器已被取消或复用
+    struct SlotEntry {
+        uint32_t index_;
+        uint32_t generation_;
+    };
+
+    using Level = std::array<std::vector<SlotEntry>, SLOT_COUNT>;
+
+    double tick_seconds_;                   ///< @brief 每个刻度的时长 (秒)
+    double accumulator_{0.0};               ///< @brief 不足一个刻度的剩余时间
+    uint64_t current_tick_{0};              ///< @brief 下一个要处理的刻度
+
+    std::array<Level, LEVEL_COUNT> levels_;
+    std::vector<Timer> timers_;             ///< @brief 计时器池
+    std::vector<uint32_t> free_list_;       ///< @brief 空闲的计时器索引
+    std::vector<SlotEntry> expired_;        ///< @brief 当前刻度到期的记录 (复用容量)
+    size_t active_count_{0};
+
+    std::unordered_map<entt::id_type, Callback> callbacks_;     ///< @brief 计时器类型 -> 到期回调
+
+public:
+    /**
+     * @brief 构造函数
+     * @param tick_seconds 刻度时长 (秒)，决定计时精度。
+     */
+    explicit TimingWheel(double tick_seconds = 0.001);
+
+    // 删除复制/移动操作
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+    TimingWheel(TimingWheel&&) = delete;
+    TimingWheel& operator=(TimingWheel&&) = delete;
+
+    /**
+     * @brief 为某种计时器类型注册到期回调，同一类型只保留一个回调。
+     * @tparam Candidate 成员函数，签名为 void(entt::entity)。
+     * @param kind 计时器类型。
+     * @param instance 回调对象。
+     */
+    template <auto Candidate, typename Type>
+    void connect(entt::id_type kind, Type* instance) {
+        callbacks_[kind].template connect<Candidate>(instance);
+    }
+
+    void disconnect(entt::id_type kind);    ///< @brief 移除某种计时器类型的回调
+
+    /**
+     * @brief 调度一个计时器。
+     * @param delay 延迟 (秒)，小于等于0时在下一个刻度触发。
+     * @param kind 计时器类型。
+     * @param entity 关联的实体，到期时传给回调。
+     * @return 计时器句柄。
+     */
+    TimerHandle schedule(float delay, entt::id_type kind, entt::entity entity = entt::null);
+
+    /**
+     * @brief 以新的延迟重新调度计时器 (类型与实体不变)。
+     * @param handle 计时器句柄，成功时被更新为新的句柄。
+     * @param delay 从现在起的新延迟 (秒)。
+     * @return 计时器仍有效并已重新调度时返回 true。
+     */
+    bool reschedule(TimerHandle& handle, float delay);
+
+    /// @brief 取消计时器并将句柄置为无效，对无效句柄调用是安全的
+    void cancel(TimerHandle& handle);
+
+    /**
+     * @brief 推进时间轮，并按到期顺序调用回调。
+     * @param delta_time 模拟时间的增量 (秒)。
+     * @note 回调中可以调度或取消计时器。
+     */
+    void advance(float delta_time);
+
+    /// @brief 清空所有计时器 (回调保留)
+    void clear();
+
+    [[nodiscard]] bool isActive(const TimerHandle& handle) const;   ///< @brief 计时器是否仍在等待触发
+    [[nodiscard]] float remaining(const TimerHandle& handle) const; ///< @brief 距离触发的剩余时间 (秒)，无效句柄返回0
+    [[nodiscard]] double getTime() const;                           ///< @brief 时间轮已推进的总时间 (秒)
+    [[nodiscard]] size_t size() const { return active_count_; }     ///< @brief 等待触发的计时器数量
+
+    /**
+     * @brief 读写快照 (见 engine::serialization::BinaryOutputArchive)。
+     *
+     * 保存全部计时器与槽，恢复后组件里保存的句柄依然有效；回调不保存，恢复时保留当前注册的回调。
+     * @note 不能在 advance() 的回调中调用。
+     */
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(tick_seconds_, accumulator_, current_tick_, levels_, timers_, free_list_, active_count_);
+    }
+
+private:
+    void tick();                                    ///< @brief 处理一个刻度
+    void cascade(int level, uint64_t slot);         ///< @brief 将高层某个槽中的计时器下放到低层
+    void insert(uint32_t index);                    ///< @brief 根据到期刻度把计时器放入合适的槽
+    void release(uint32_t index);                   ///< @brief 释放计时器并递增代数
+    [[nodiscard]] const Timer* find(const TimerHandle& handle) const;
+};
+
+} // namespace engine::core
@@ -1,5 +1,6 @@
 #include "input_manager.h"
 #include "../core/config.h"
+#include "../core/replay_manager.h"
 #include "../utils/events.h"
 #include <stdexcept>
 #include <SDL3/SDL.h>
@@ -45,10 +46,21 @@ void InputManager::update() {
     }
 
     // 2. 处理所有待处理的 SDL 事件 (这将设定 action_states_ 的值)
+    //    回放录像时动作状态来自录像，实际输入只处理退出
+    const bool replaying = replay_manager_ && replay_manager_->isReplaying();
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         ImGui_ImplSDL3_ProcessEvent(&event);    // ImGui 步骤2 处理 ImGui 事件
-        processEvent(event);
+        if (!replaying) {
+            processEvent(event);
+        } else if (event.type == SDL_EVENT_QUIT) {
+            quit();
+        }
+    }
+
+    // 录制本帧的动作状态，或用录像覆盖
+    if (replay_manager_) {
+        replay_manager_->processInput(action_states_, mouse_position_, logical_mouse_position_);
     }
 
     // 3. 触发回调
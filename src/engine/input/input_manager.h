@@ -12,6 +12,7 @@
 
 namespace engine::core {
     class Config;
+    class ReplayManager;
 }
 
 namespace engine::input {
@@ -40,6 +41,7 @@ class InputManager final {
 private:
     SDL_Renderer* sdl_renderer_;                                            ///< @brief 用于获取逻辑坐标的 SDL_Renderer 指针
     entt::dispatcher* dispatcher_;                                          ///< @brief 事件总线，事件分发器
+    engine::core::ReplayManager* replay_manager_ = nullptr;                 ///< @brief 录像管理器 (可选)，录制或回放每帧的动作状态
 
     /** @brief 核心数据结构: 存储动作名称函数列表的映射
      * 
@@ -76,6 +78,8 @@ public:
     entt::sink<entt::sigh<bool()>> onAction(entt::id_type action_name_id, ActionState action_state = ActionState::PRESSED);
 
 
+    void setReplayManager(engine::core::ReplayManager* replay_manager) { replay_manager_ = replay_manager; }  ///< @brief 设置录像管理器
+
     void update();                                    ///< @brief 更新输入状态，每轮循环最先调用
     void quit();                                      ///< @brief 退出游戏
 
@@ -6,6 +6,7 @@
 #include "../component/sprite_component.h"
 #include "../component/transform_component.h"
 #include "../component/render_component.h"
+#include "../component/static_render_tag.h"
 #include "../resource/resource_manager.h"
 #include <entt/entt.hpp>
 #include <spdlog/spdlog.h>
@@ -141,16 +142,24 @@ void BasicEntityBuilder::buildRender() {
     int layer = level_loader_.getCurrentLayer();    // 确定图层
     float depth = position_.y;                      // 确定深度（默认y坐标）
     registry_.emplace<engine::component::RenderComponent>(entity_id_, layer, depth);
+    // 地图中的瓦片和对象创建后不再移动，放入静态空间索引
+    registry_.emplace<engine::component::StaticRenderTag>(entity_id_);
 }
 
 void BasicEntityBuilder::buildAnimation() {
     spdlog::trace("build AnimationComponent");
     // 如果存在动画，其信息已经解析并保存在tile_info_中
     if (tile_info_ && tile_info_->animation_) {
-        // 创建动画map
-        std::unordered_map<entt::id_type, engine::component::Animation> animations;
+        // 创建动画map (从场景内存分配)
+        auto* resource = level_loader_.getMemoryResource();
+        engine::memory::HashMap<entt::id_type, engine::component::Animation> animations(resource);
         auto animation_id = entt::hashed_string("tile");    // 图块动画名称默认为"tile"
-        animations.emplace(animation_id, std::move(tile_info_->animation_.value()));
+        // tile_info_ 是常量指针，无法移动，复制时显式指定内存资源 (否则复制构造会回到默认的堆分配)
+        const auto& tile_animation = tile_info_->animation_.value();
+        animations.emplace(animation_id, engine::component::Animation(
+            engine::memory::Vector<engine::component::AnimationFrame>(tile_animation.frames_, resource),
+            engine::memory::HashMap<int, entt::id_type>(tile_animation.events_, resource),
+            tile_animation.loop_));
         // 通过动画map创建AnimationComponent，并添加
         registry_.emplace<engine::component::AnimationComponent>(entity_id_, std::move(animations), animation_id);
     }
@@ -21,6 +21,10 @@ namespace engine::loader {
 
 LevelLoader::~LevelLoader() = default;
 
+std::pmr::memory_resource* LevelLoader::getMemoryResource() const {
+    return scene_ ? scene_->getMemoryResource() : std::pmr::get_default_resource();
+}
+
 void LevelLoader::setEntityBuilder(std::unique_ptr<BasicEntityBuilder> builder) {
     entity_builder_ = std::move(builder);
 }
@@ -176,8 +180,8 @@ void LevelLoader::loadTileLayer(const nlohmann::json& layer_json) {
     auto layer_entity = registry.create();
     registry.emplace<engine::component::NameComponent>(layer_entity, name_id, layer_name);
 
-    // 准备瓦片实体vector (瓦片数量 = 地图宽度 * 地图高度)
-    std::vector<entt::entity> tiles;
+    // 准备瓦片实体vector (瓦片数量 = 地图宽度 * 地图高度)，从场景内存分配
+    engine::memory::Vector<entt::entity> tiles(getMemoryResource());
     tiles.reserve(map_size_.x * map_size_.y);
 
     // 获取图层数据 (瓦片 ID 列表)
@@ -204,7 +208,7 @@ void LevelLoader::loadTileLayer(const nlohmann::json& layer_json) {
     }
 
     // 最后将瓦片层组件添加到图层实体中
-    registry.emplace<engine::component::TileLayerComponent>(layer_entity, tile_size_, map_size_, tiles);
+    registry.emplace<engine::component::TileLayerComponent>(layer_entity, tile_size_, map_size_, std::move(tiles));
 
     spdlog::info("load tile layer '{}' in map file '{}' complete.", layer_name, map_path_);
 }
@@ -338,11 +342,13 @@ std::optional<engine::component::TileInfo> LevelLoader::getTileInfoByGid(int gid
 
     const auto& tileset = tileset_it->second;
     auto local_id = gid - tileset_it->first;        // 计算瓦片在图块集中的局部ID
-    std::string file_path = tileset.value("file_path", "");       // 获取图块集文件路径
-    if (file_path.empty()) {
+    // 获取图块集文件路径 (每个瓦片都会调用，直接引用json中的字符串，避免复制)
+    auto file_path_it = tileset.find("file_path");
+    if (file_path_it == tileset.end() || !file_path_it->is_string() || file_path_it->get_ref<const std::string&>().empty()) {
         spdlog::error("Tileset file '{}' is invalid, missing 'file_path' property.", tileset_it->first);
         return std::nullopt;
     }
+    const auto& file_path = file_path_it->get_ref<const std::string&>();
 
     engine::component::TileInfo tile_info;  // 初始化瓦片信息
     // 图块集分为两种情况，用一个标志进行记录区分
@@ -391,8 +397,9 @@ std::optional<engine::component::TileInfo> LevelLoader::getTileInfoByGid(int gid
             }
             // 补充动画信息 （瓦片动画为animation字段，且必须为数组，目前只考虑单一图片情况）
             if (tile_json.contains("animation") && is_single_image && tile_json["animation"].is_array()) {
-                std::vector<engine::component::AnimationFrame> animation_frames;
+                engine::memory::Vector<engine::component::AnimationFrame> animation_frames(getMemoryResource());
                 auto& animation = tile_json["animation"];
+                animation_frames.reserve(animation.size());
                 for (auto& frame : animation) {
                     // 每个瓦片动画帧json有两个信息：tileid 和 duration
                     float duration_ms = frame.value("duration", 100.0f);
@@ -5,6 +5,7 @@
 #include <string>
 #include <string_view>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <glm/vec2.hpp>
 #include <nlohmann/json.hpp>
@@ -61,6 +62,7 @@ public:
     const glm::ivec2& getMapSize() const { return map_size_; }
     const glm::ivec2& getTileSize() const { return tile_size_; }
     int getCurrentLayer() const { return current_layer_; }
+    std::pmr::memory_resource* getMemoryResource() const;     ///< @brief 场景内存 (生成的组件中的容器从这里分配)
     
 private:
     void loadImageLayer(const nlohmann::json& layer_json);    ///< @brief 加载图片图层
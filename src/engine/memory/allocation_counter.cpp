@@ -0,0 +1,45 @@
+#include "allocation_counter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<std::uint64_t> allocation_count{0};
+    std::atomic<std::uint64_t> deallocation_count{0};
+}
+
+namespace engine::memory {
+
+std::uint64_t getAllocationCount() {
+    return allocation_count.load(std::memory_order_relaxed);
+}
+
+std::uint64_t getDeallocationCount() {
+    return deallocation_count.load(std::memory_order_relaxed);
+}
+
+} // namespace engine::memory
+
+// --- 全局 operator new/delete 替换 (对齐版本保持默认实现) ---
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+    while (true) {
+        if (void* ptr = std::malloc(size)) return ptr;
+        // 与标准实现一致：有 new_handler 时调用它后重试，否则抛出 bad_alloc
+        auto handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void operator delete(void* ptr) noexcept {
+    if (!ptr) return;
+    deallocation_count.fetch_add(1, std::memory_order_relaxed);
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    ::operator delete(ptr);
+}
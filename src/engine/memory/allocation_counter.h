@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace engine::memory {
+
+/**
+ * @brief 全局堆分配计数。
+ *
+ * allocation_counter.cpp 替换了全局的 operator new/delete，每次调用都会原子地累加计数，
+ * 用于在调试UI中观察每帧的 malloc 次数。数组、nothrow 版本默认转发到这两个函数，同样会被计数。
+ */
+std::uint64_t getAllocationCount();     ///< @brief 程序启动以来 operator new 的调用次数
+std::uint64_t getDeallocationCount();   ///< @brief 程序启动以来 operator delete 的调用次数 (不含空指针)
+
+} // namespace engine::memory
@@ -0,0 +1,19 @@
+#include "frame_arena.h"
+#include "allocation_counter.h"
+#include <algorithm>
+
+namespace engine::memory {
+
+FrameArena::FrameArena(std::size_t capacity)
+    : arena_("frame", capacity), frame_start_allocations_(getAllocationCount()) {}
+
+void FrameArena::beginFrame() {
+    const auto now = getAllocationCount();
+    last_frame_allocations_ = now - frame_start_allocations_;
+    peak_frame_allocations_ = std::max(peak_frame_allocations_, last_frame_allocations_);
+    arena_.reset();
+    // reset() 合并块时的分配计入下一帧
+    frame_start_allocations_ = now;
+}
+
+} // namespace engine::memory
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "linear_arena.h"
+#include <cstdint>
+
+namespace engine::memory {
+
+/**
+ * @brief 帧分配器：只在一帧之内有效的临时数据 (调试UI的字符串、临时列表等) 从这里分配。
+ *
+ * GameApp::run 在每帧开始时调用 beginFrame()，之前分配的内存全部失效，因此不能把它分配的容器保存到下一帧
+ * (包括录制的渲染命令)。同时统计上一帧的全局堆分配次数 (见 allocation_counter.h)。
+ * @note 开启模拟线程时，只有在工作线程空闲时才会调用 beginFrame()。
+ */
+class FrameArena final {
+    LinearArena arena_;
+
+    std::uint64_t frame_start_allocations_ = 0;     ///< @brief 本帧开始时的全局分配计数
+    std::uint64_t last_frame_allocations_ = 0;      ///< @brief 上一帧的堆分配次数
+    std::uint64_t peak_frame_allocations_ = 0;      ///< @brief 单帧最大的堆分配次数
+
+public:
+    explicit FrameArena(std::size_t capacity);
+
+    void beginFrame();      ///< @brief 开始新的一帧：记录上一帧的分配次数并重置线性分配器
+
+    std::pmr::memory_resource* getResource() { return &arena_; }    ///< @brief 用于构造 pmr 容器
+    const LinearArena& getArena() const { return arena_; }
+
+    std::uint64_t getLastFrameAllocations() const { return last_frame_allocations_; }
+    std::uint64_t getPeakFrameAllocations() const { return peak_frame_allocations_; }
+    void resetPeak() { peak_frame_allocations_ = 0; }
+
+    // 删除复制/移动操作
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+    FrameArena(FrameArena&&) = delete;
+    FrameArena& operator=(FrameArena&&) = delete;
+};
+
+} // namespace engine::memory
@@ -0,0 +1,82 @@
+#include "linear_arena.h"
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <spdlog/spdlog.h>
+
+namespace engine::memory {
+
+LinearArena::LinearArena(std::string_view name, std::size_t initial_capacity)
+    : name_(name), initial_capacity_(std::max(initial_capacity, MIN_BLOCK_SIZE)) {}
+
+LinearArena::~LinearArena() {
+    freeBlocks();
+}
+
+void LinearArena::reset() {
+    // 上个周期溢出到了多个块：合并为一个能容纳全部数据的块，之后的周期只用这一块
+    if (blocks_.size() > 1) {
+        const auto total = getCapacity();
+        freeBlocks();
+        addBlock(total);
+        spdlog::debug("LinearArena '{}' grown to {} bytes.", name_, total);
+    }
+    offset_ = 0;
+    used_bytes_ = 0;
+    allocation_count_ = 0;
+}
+
+void LinearArena::release() {
+    freeBlocks();
+    offset_ = 0;
+    used_bytes_ = 0;
+    allocation_count_ = 0;
+}
+
+std::size_t LinearArena::getCapacity() const {
+    std::size_t capacity = 0;
+    for (const auto& block : blocks_) {
+        capacity += block.size_;
+    }
+    return capacity;
+}
+
+void* LinearArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    if (void* ptr = tryAllocate(bytes, alignment)) return ptr;
+
+    // 当前块放不下，申请新块 (容量翻倍，且至少能放下本次分配)
+    const std::size_t next_size = blocks_.empty() ? initial_capacity_ : blocks_.back().size_ * 2;
+    addBlock(std::max(next_size, bytes + alignment));
+    if (void* ptr = tryAllocate(bytes, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* LinearArena::tryAllocate(std::size_t bytes, std::size_t alignment) {
+    if (blocks_.empty()) return nullptr;
+    auto& block = blocks_.back();
+    void* ptr = block.data_ + offset_;
+    std::size_t space = block.size_ - offset_;
+    if (!std::align(alignment, bytes, ptr, space)) return nullptr;
+
+    offset_ = static_cast<std::size_t>(static_cast<std::byte*>(ptr) - block.data_) + bytes;
+    used_bytes_ += bytes;
+    peak_bytes_ = std::max(peak_bytes_, used_bytes_);
+    ++allocation_count_;
+    return ptr;
+}
+
+void LinearArena::addBlock(std::size_t size) {
+    size = std::max(size, MIN_BLOCK_SIZE);
+    blocks_.push_back({static_cast<std::byte*>(::operator new(size)), size});
+    offset_ = 0;
+    ++block_allocations_;
+}
+
+void LinearArena::freeBlocks() {
+    for (const auto& block : blocks_) {
+        ::operator delete(block.data_);
+    }
+    blocks_.clear();
+}
+
+} // namespace engine::memory
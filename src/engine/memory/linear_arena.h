@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::memory {
+
+/**
+ * @brief 线性 (bump) 分配器，作为 std::pmr 容器的内存资源使用。
+ *
+ * 分配只是移动块内的偏移量，单个释放无效，内存在 reset()/release() 时整体回收。
+ * 当前块放不下时向上游 (operator new) 申请一个容量翻倍的新块；reset() 时若上个周期用到了多个块，
+ * 会合并为一个足够大的块，因此分配量稳定后每个周期都不再调用 malloc。
+ * @note 非线程安全，同一时间只能由一个线程使用。
+ */
+class LinearArena final : public std::pmr::memory_resource {
+    struct Block {
+        std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    static constexpr std::size_t MIN_BLOCK_SIZE = 4096;
+
+    std::string name_;                          ///< @brief 名称 (日志与调试UI)
+    std::size_t initial_capacity_;              ///< @brief 首块容量 (首次分配时申请)
+    std::vector<Block> blocks_;                 ///< @brief 已申请的块，只有最后一块可以继续分配
+    std::size_t offset_ = 0;                    ///< @brief 最后一块中已使用的字节数
+
+    // --- 统计 ---
+    std::size_t used_bytes_ = 0;                ///< @brief 本周期分配的字节数
+    std::size_t peak_bytes_ = 0;                ///< @brief 历史最大的单周期分配字节数
+    std::size_t allocation_count_ = 0;          ///< @brief 本周期的分配次数
+    std::size_t block_allocations_ = 0;         ///< @brief 累计向上游申请块的次数
+
+public:
+    /**
+     * @brief 构造函数，不会立即申请内存
+     * @param name 名称
+     * @param initial_capacity 首块容量 (字节)
+     */
+    explicit LinearArena(std::string_view name, std::size_t initial_capacity = 64 * 1024);
+    ~LinearArena() override;
+
+    void reset();       ///< @brief 回到起点并保留内存 (之前分配的内存全部失效)
+    void release();     ///< @brief 回到起点并把内存全部归还给上游
+
+    std::string_view getName() const { return name_; }
+    std::size_t getCapacity() const;                                            ///< @brief 已申请的总容量
+    std::size_t getUsedBytes() const { return used_bytes_; }
+    std::size_t getPeakBytes() const { return peak_bytes_; }
+    std::size_t getAllocationCount() const { return allocation_count_; }
+    std::size_t getBlockCount() const { return blocks_.size(); }
+    std::size_t getBlockAllocations() const { return block_allocations_; }
+
+    // 删除复制/移动操作
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+    LinearArena(LinearArena&&) = delete;
+    LinearArena& operator=(LinearArena&&) = delete;
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void*, std::size_t, std::size_t) override {}     ///< @brief 单个释放无效
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    void* tryAllocate(std::size_t bytes, std::size_t alignment);   ///< @brief 在最后一块中分配，放不下时返回 nullptr
+    void addBlock(std::size_t size);
+    void freeBlocks();
+};
+
+} // namespace engine::memory
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <deque>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief 使用多态内存资源的容器别名。
+ *
+ * 构造时传入内存资源 (帧分配器、场景分配器等) 即可让容器从中分配；不传时使用默认的堆分配。
+ * 移动构造会保留原容器的内存资源，复制构造则回到默认资源。
+ */
+namespace engine::memory {
+
+template <typename T>
+using Vector = std::pmr::vector<T>;
+
+template <typename T>
+using Deque = std::pmr::deque<T>;
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+using HashMap = std::pmr::unordered_map<K, V, Hash, KeyEqual>;
+
+using String = std::pmr::string;
+
+} // namespace engine::memory
@@ -1,5 +1,6 @@
 #include "camera.h"
 #include "../utils/math.h"
+#include <algorithm>
 #include <spdlog/spdlog.h>
 #include <glm/common.hpp>
 
@@ -69,6 +70,15 @@ glm::vec2 Camera::screenToWorld(const glm::vec2 &screen_pos) const
     return screen_pos + position_;
 }
 
+bool Camera::isInView(const engine::utils::Rect& world_rect, float margin) const
+{
+    // 相当于 AABB碰撞检测
+    return world_rect.position.x + world_rect.size.x >= position_.x - margin &&
+           world_rect.position.x <= position_.x + viewport_size_.x + margin &&
+           world_rect.position.y + world_rect.size.y >= position_.y - margin &&
+           world_rect.position.y <= position_.y + viewport_size_.y + margin;
+}
+
 glm::vec2 Camera::getViewportSize() const {
     return viewport_size_;
 }
@@ -32,6 +32,7 @@ public:
     glm::vec2 worldToScreen(const glm::vec2& world_pos) const;              ///< @brief 世界坐标转屏幕坐标
     glm::vec2 worldToScreenWithParallax(const glm::vec2& world_pos, const glm::vec2& scroll_factor) const; ///< @brief 世界坐标转屏幕坐标，考虑视差滚动
     glm::vec2 screenToWorld(const glm::vec2& screen_pos) const;             ///< @brief 屏幕坐标转世界坐标
+    bool isInView(const engine::utils::Rect& world_rect, float margin = 0.0f) const;   ///< @brief 世界坐标下的矩形是否与视口(向外扩展margin)相交
 
     void setPosition(glm::vec2 position);                                   ///< @brief 设置相机位置
     void setLimitBounds(std::optional<engine::utils::Rect> limit_bounds);   ///< @brief 设置限制相机的移动范围
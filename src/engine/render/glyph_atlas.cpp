@@ -0,0 +1,148 @@
+#include "glyph_atlas.h"
+#include "renderer.h"
+#include "primitive_batch.h"
+#include "../core/main_thread_queue.h"
+#include "../resource/resource_manager.h"
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace engine::render {
+
+namespace {
+    constexpr int GLYPH_PADDING = 1;    ///< @brief 字形之间的间隔 (像素)，避免采样到相邻字形
+}
+
+GlyphAtlas::GlyphAtlas(Renderer& renderer, engine::resource::ResourceManager& resource_manager, entt::id_type font_id,
+                       int point_size, std::string_view font_path, std::string_view characters)
+    : renderer_(&renderer)
+{
+    glyph_index_.fill(-1);
+    TTF_Font* font = resource_manager.getFont(font_id, point_size, font_path);
+    if (!font) {
+        throw std::runtime_error("GlyphAtlas get font failed: " + std::string(font_path));
+    }
+
+    // 只保留不重复的 ASCII 字符
+    std::string unique_characters;
+    for (char character : characters) {
+        const auto code = static_cast<unsigned char>(character);
+        if (code >= GLYPH_TABLE_SIZE || unique_characters.find(character) != std::string::npos) continue;
+        unique_characters.push_back(character);
+    }
+    if (unique_characters.empty()) {
+        throw std::runtime_error("GlyphAtlas needs at least one ASCII character.");
+    }
+
+    // SDL_ttf 与纹理创建都只能在主线程中进行
+    std::vector<glm::vec2> sizes;
+    texture_ = engine::core::invokeOnMainThread(renderer.getMainThreadQueue(), [&]() -> SDL_Texture* {
+        // 1. 每个字符以白色单独光栅化 (表面宽度即步进宽度，高度为行高)
+        std::vector<SDL_Surface*> surfaces;
+        int atlas_width = 0;
+        int atlas_height = 0;
+        for (char character : unique_characters) {
+            SDL_Surface* surface = TTF_RenderText_Blended(font, &character, 1, SDL_Color{255, 255, 255, 255});
+            if (!surface) {
+                spdlog::error("GlyphAtlas render glyph '{}' failed: {}", character, SDL_GetError());
+                continue;
+            }
+            surfaces.push_back(surface);
+            atlas_width += surface->w + GLYPH_PADDING;
+            atlas_height = std::max(atlas_height, surface->h);
+        }
+
+        // 2. 排成一行拷贝到图集表面 (不混合，直接复制alpha)
+        SDL_Texture* texture = nullptr;
+        SDL_Surface* atlas = atlas_width > 0 ? SDL_CreateSurface(atlas_width, atlas_height, SDL_PIXELFORMAT_RGBA32) : nullptr;
+        if (atlas) {
+            SDL_FillSurfaceRect(atlas, nullptr, SDL_MapSurfaceRGBA(atlas, 255, 255, 255, 0));
+            int x = 0;
+            for (auto* surface : surfaces) {
+                SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+                SDL_Rect dest_rect{x, 0, surface->w, surface->h};
+                SDL_BlitSurface(surface, nullptr, atlas, &dest_rect);
+                sizes.emplace_back(static_cast<float>(surface->w), static_cast<float>(surface->h));
+                x += surface->w + GLYPH_PADDING;
+            }
+            texture = SDL_CreateTextureFromSurface(renderer.getSDLRenderer(), atlas);
+            if (texture) {
+                // 位图字体保持像素风格
+                SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+                SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+            } else {
+                spdlog::error("GlyphAtlas create texture failed: {}", SDL_GetError());
+            }
+            SDL_DestroySurface(atlas);
+        } else {
+            spdlog::error("GlyphAtlas create surface failed: {}", SDL_GetError());
+        }
+        for (auto* surface : surfaces) {
+            SDL_DestroySurface(surface);
+        }
+        line_height_ = static_cast<float>(TTF_GetFontHeight(font));
+        return texture;
+    });
+    if (!texture_ || sizes.size() != unique_characters.size()) {
+        if (texture_) renderer_->destroyTexture(texture_);
+        texture_ = nullptr;
+        throw std::runtime_error("GlyphAtlas build failed.");
+    }
+
+    // 3. 记录每个字形的纹理坐标
+    float atlas_width = 0.0f;
+    float atlas_height = 0.0f;
+    for (const auto& size : sizes) {
+        atlas_width += size.x + GLYPH_PADDING;
+        atlas_height = std::max(atlas_height, size.y);
+    }
+    float x = 0.0f;
+    glyphs_.reserve(sizes.size());
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        const auto& size = sizes[i];
+        glyph_index_[static_cast<unsigned char>(unique_characters[i])] = static_cast<std::int16_t>(glyphs_.size());
+        glyphs_.push_back({{x / atlas_width, 0.0f}, {(x + size.x) / atlas_width, size.y / atlas_height}, size});
+        x += size.x + GLYPH_PADDING;
+    }
+    spdlog::trace("GlyphAtlas built: {} glyphs, {}x{}.", glyphs_.size(), atlas_width, atlas_height);
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    // 录制时延迟到本帧的命令执行完毕后再销毁
+    if (texture_) {
+        renderer_->destroyTexture(texture_);
+    }
+}
+
+void GlyphAtlas::addText(PrimitiveBatch& batch, std::string_view text, const glm::vec2& position, float scale,
+                         const engine::utils::FColor& color) const {
+    float x = position.x;
+    for (char character : text) {
+        const auto* glyph = findGlyph(character);
+        if (!glyph) continue;
+        const glm::vec2 size = glyph->size_ * scale;
+        batch.addTexturedRect({x, position.y, size.x, size.y}, glyph->uv_min_, glyph->uv_max_, color);
+        x += size.x;
+    }
+}
+
+float GlyphAtlas::measure(std::string_view text, float scale) const {
+    float width = 0.0f;
+    for (char character : text) {
+        if (const auto* glyph = findGlyph(character)) {
+            width += glyph->size_.x;
+        }
+    }
+    return width * scale;
+}
+
+const GlyphAtlas::Glyph* GlyphAtlas::findGlyph(char character) const {
+    const auto code = static_cast<unsigned char>(character);
+    if (code >= GLYPH_TABLE_SIZE || glyph_index_[code] < 0) return nullptr;
+    return &glyphs_[static_cast<std::size_t>(glyph_index_[code])];
+}
+
+} // namespace engine::render
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "../utils/math.h"
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include <entt/core/fwd.hpp>
+#include <glm/vec2.hpp>
+
+struct SDL_Texture;
+
+namespace engine::resource {
+    class ResourceManager;
+}
+
+namespace engine::render {
+class Renderer;
+class PrimitiveBatch;
+
+/**
+ * @brief 位图字体图集：启动时把少量字符 (如数字与符号) 预先光栅化到一张纹理中。
+ *
+ * 文字不再为每次绘制创建 TTF_Text，而是由 addText() 把每个字符作为一个带纹理坐标的四边形加入图元批，
+ * 颜色与透明度由顶点颜色调制 (字形以白色光栅化)，因此任意数量、任意颜色的文字可以合并为一次绘制调用。
+ * 只支持构造时给出的 ASCII 字符，其余字符被跳过。
+ */
+class GlyphAtlas final {
+public:
+    /// @brief 单个字形在图集中的位置与尺寸
+    struct Glyph {
+        glm::vec2 uv_min_{0.0f};        ///< @brief 归一化纹理坐标 (左上)
+        glm::vec2 uv_max_{0.0f};        ///< @brief 归一化纹理坐标 (右下)
+        glm::vec2 size_{0.0f};          ///< @brief 像素尺寸 (宽度即步进宽度)
+    };
+
+private:
+    static constexpr std::size_t GLYPH_TABLE_SIZE = 128;    ///< @brief 只支持 ASCII 字符
+
+    Renderer* renderer_ = nullptr;                  ///< @brief 持有渲染器的非拥有指针 (销毁纹理)
+    SDL_Texture* texture_ = nullptr;                ///< @brief 图集纹理 (拥有)
+    std::vector<Glyph> glyphs_;                     ///< @brief 已光栅化的字形
+    std::array<std::int16_t, GLYPH_TABLE_SIZE> glyph_index_{};  ///< @brief 字符 -> glyphs_ 中的索引，-1 表示不支持
+    float line_height_ = 0.0f;                      ///< @brief 字体行高 (像素)
+
+public:
+    /**
+     * @brief 构造图集，在主线程中光栅化字符并创建纹理。
+     *
+     * @param renderer 渲染器。
+     * @param resource_manager 资源管理器 (用于获取字体)。
+     * @param font_id 字体 ID。
+     * @param point_size 字号 (位图字体应使用其原生字号)。
+     * @param font_path 字体文件路径。
+     * @param characters 需要光栅化的字符 (ASCII)。
+     * @throws std::runtime_error 如果字体获取或光栅化失败。
+     */
+    GlyphAtlas(Renderer& renderer, engine::resource::ResourceManager& resource_manager, entt::id_type font_id,
+               int point_size, std::string_view font_path, std::string_view characters);
+    ~GlyphAtlas();
+
+    // 删除复制/移动操作
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+    GlyphAtlas(GlyphAtlas&&) = delete;
+    GlyphAtlas& operator=(GlyphAtlas&&) = delete;
+
+    /**
+     * @brief 把字符串的每个字符作为四边形加入图元批 (批应配合 getTexture() 绘制)。
+     *
+     * @param batch 图元批。
+     * @param text 字符串 (不支持的字符被跳过)。
+     * @param position 左上角屏幕位置。
+     * @param scale 缩放比例 (位图字体使用整数倍可保持清晰)。
+     * @param color 文字颜色 (含透明度)。
+     */
+    void addText(PrimitiveBatch& batch, std::string_view text, const glm::vec2& position, float scale,
+                 const engine::utils::FColor& color) const;
+
+    /// @brief 测量字符串的宽度 (像素，已缩放)
+    [[nodiscard]] float measure(std::string_view text, float scale = 1.0f) const;
+
+    [[nodiscard]] SDL_Texture* getTexture() const { return texture_; }
+    [[nodiscard]] float getLineHeight() const { return line_height_; }
+
+private:
+    [[nodiscard]] const Glyph* findGlyph(char character) const;
+};
+
+} // namespace engine::render
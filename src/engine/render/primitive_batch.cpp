@@ -0,0 +1,60 @@
+#include "primitive_batch.h"
+#include <algorithm>
+#include <glm/geometric.hpp>
+
+namespace engine::render {
+
+void PrimitiveBatch::addFilledRect(const SDL_FRect& rect, const engine::utils::FColor& color) {
+    addQuad({rect.x, rect.y}, {rect.x + rect.w, rect.y}, {rect.x + rect.w, rect.y + rect.h}, {rect.x, rect.y + rect.h}, color);
+}
+
+void PrimitiveBatch::addTexturedRect(const SDL_FRect& rect, const glm::vec2& uv_min, const glm::vec2& uv_max, const engine::utils::FColor& color) {
+    addQuad({rect.x, rect.y}, {rect.x + rect.w, rect.y}, {rect.x + rect.w, rect.y + rect.h}, {rect.x, rect.y + rect.h}, color, uv_min, uv_max);
+}
+
+void PrimitiveBatch::addRect(const SDL_FRect& rect, const engine::utils::FColor& color, float thickness) {
+    if (thickness <= 0.0f) return;
+    // 边框宽到覆盖整个矩形时，等价于填充
+    if (thickness * 2.0f >= std::min(rect.w, rect.h)) {
+        addFilledRect(rect, color);
+        return;
+    }
+    const float inner_height = rect.h - thickness * 2.0f;
+    addFilledRect({rect.x, rect.y, rect.w, thickness}, color);                                      // 上
+    addFilledRect({rect.x, rect.y + rect.h - thickness, rect.w, thickness}, color);                 // 下
+    addFilledRect({rect.x, rect.y + thickness, thickness, inner_height}, color);                    // 左
+    addFilledRect({rect.x + rect.w - thickness, rect.y + thickness, thickness, inner_height}, color);   // 右
+}
+
+void PrimitiveBatch::addLine(const glm::vec2& start, const glm::vec2& end, const engine::utils::FColor& color, float thickness) {
+    const glm::vec2 delta = end - start;
+    const float length = glm::length(delta);
+    if (length <= 0.0f || thickness <= 0.0f) return;
+    // 沿法线方向各扩展半个线宽
+    const glm::vec2 normal = glm::vec2(-delta.y, delta.x) / length * (thickness * 0.5f);
+    addQuad(start + normal, end + normal, end - normal, start - normal, color);
+}
+
+void PrimitiveBatch::clear() {
+    vertices_.clear();
+    indices_.clear();
+}
+
+void PrimitiveBatch::release(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices) {
+    vertices.swap(vertices_);
+    indices.swap(indices_);
+    clear();
+}
+
+void PrimitiveBatch::addQuad(const glm::vec2& p0, const glm::vec2& p1, const glm::vec2& p2, const glm::vec2& p3, const engine::utils::FColor& color,
+                             const glm::vec2& uv_min, const glm::vec2& uv_max) {
+    const SDL_FColor vertex_color{color.r, color.g, color.b, color.a};
+    const int base = static_cast<int>(vertices_.size());
+    vertices_.push_back({{p0.x, p0.y}, vertex_color, {uv_min.x, uv_min.y}});
+    vertices_.push_back({{p1.x, p1.y}, vertex_color, {uv_max.x, uv_min.y}});
+    vertices_.push_back({{p2.x, p2.y}, vertex_color, {uv_max.x, uv_max.y}});
+    vertices_.push_back({{p3.x, p3.y}, vertex_color, {uv_min.x, uv_max.y}});
+    indices_.insert(indices_.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+}
+
+} // namespace engine::render
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../utils/math.h"
+#include <SDL3/SDL_render.h>
+#include <vector>
+
+namespace engine::render {
+
+/**
+ * @brief 图元批：把矩形、边框、线段等累积为带顶点颜色的三角形，一次 SDL_RenderGeometry 即可全部绘制。
+ *
+ * 所有坐标都是屏幕坐标。除 addTexturedRect 外纹理坐标固定为 (0,0)~(1,1)，因此同一个批可以配合一张纹理 (如圆形纹理) 使用，
+ * 也可以不使用纹理 (纯色)。批本身不持有纹理，由调用者决定。
+ */
+class PrimitiveBatch final {
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+
+public:
+    PrimitiveBatch() = default;
+
+    void addFilledRect(const SDL_FRect& rect, const engine::utils::FColor& color);      ///< @brief 填充矩形 (纹理坐标覆盖整张纹理)
+    void addRect(const SDL_FRect& rect, const engine::utils::FColor& color, float thickness);   ///< @brief 矩形边框，向内扩展 thickness
+    /// @brief 填充矩形，使用指定的纹理坐标 (归一化，u0 > u1 时水平翻转)
+    void addTexturedRect(const SDL_FRect& rect, const glm::vec2& uv_min, const glm::vec2& uv_max, const engine::utils::FColor& color);
+    void addLine(const glm::vec2& start, const glm::vec2& end, const engine::utils::FColor& color, float thickness);   ///< @brief 线段
+
+    void clear();
+    [[nodiscard]] bool empty() const { return indices_.empty(); }
+    [[nodiscard]] const std::vector<SDL_Vertex>& getVertices() const { return vertices_; }
+    [[nodiscard]] const std::vector<int>& getIndices() const { return indices_; }
+
+    /// @brief 取走累积的顶点和索引 (录制命令时使用)，之后批为空
+    void release(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices);
+
+private:
+    /// @brief 添加一个四边形 (顶点按 左上、右上、右下、左下 的顺序)
+    void addQuad(const glm::vec2& p0, const glm::vec2& p1, const glm::vec2& p2, const glm::vec2& p3, const engine::utils::FColor& color,
+                 const glm::vec2& uv_min = {0.0f, 0.0f}, const glm::vec2& uv_max = {1.0f, 1.0f});
+};
+
+} // namespace engine::render
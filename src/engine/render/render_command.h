@@ -0,0 +1,87 @@
+#pragma once
+
+#include "../utils/math.h"
+#include <SDL3/SDL_rect.h>
+#include <SDL3/SDL_render.h>    // 用于 SDL_Vertex
+#include <SDL3/SDL_surface.h>   // 用于 SDL_FlipMode
+#include <functional>
+#include <variant>
+#include <vector>
+
+struct SDL_Texture;
+
+namespace engine::render {
+
+/**
+ * @brief 渲染命令
+ *
+ * Renderer 的每个绘制函数都先把参数解析为一条命令 (纹理指针、屏幕坐标的矩形、颜色)，
+ * 录制时存入命令列表，之后在主线程中按顺序转换为 SDL 调用；不录制时立即执行。
+ * 命令只保存纹理指针，解析时不再访问资源管理器、相机等模拟线程的数据。
+ */
+namespace command {
+
+/// @brief 清屏
+struct Clear {
+    engine::utils::FColor color_;
+};
+
+/// @brief 绘制纹理 (精灵、圆形、UI图片、渲染目标纹理)
+struct Texture {
+    SDL_Texture* texture_ = nullptr;
+    SDL_FRect src_rect_{};
+    bool has_src_rect_ = false;                 ///< @brief 为 false 时绘制整个纹理
+    SDL_FRect dest_rect_{};
+    double rotation_ = 0.0;
+    SDL_FlipMode flip_ = SDL_FLIP_NONE;
+    bool modulate_ = false;                     ///< @brief 是否在绘制前设置颜色与透明度调制
+    engine::utils::FColor color_{1.0f, 1.0f, 1.0f, 1.0f};
+};
+
+/// @brief 绘制矩形 (填充或边框)
+struct Rect {
+    SDL_FRect rect_{};
+    engine::utils::FColor color_;
+    bool filled_ = true;
+    int thickness_ = 1;                         ///< @brief 边框宽度，仅 filled_ 为 false 时有效
+};
+
+/// @brief 绘制三角形网格 (图元批)，纹理为空时为纯色
+struct Geometry {
+    SDL_Texture* texture_ = nullptr;
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+};
+
+/// @brief 将渲染目标切换为纹理并清空
+struct PushTarget {
+    SDL_Texture* target_ = nullptr;
+};
+
+/// @brief 恢复上一个渲染目标
+struct PopTarget {};
+
+/// @brief 销毁纹理 (延迟到此前的命令都执行完毕之后)
+struct DestroyTexture {
+    SDL_Texture* texture_ = nullptr;
+};
+
+/// @brief 自定义绘制 (如文字)，在主线程中调用
+struct Custom {
+    std::function<void()> draw_;
+};
+
+} // namespace command
+
+using RenderCommand = std::variant<command::Clear,
+                                   command::Texture,
+                                   command::Rect,
+                                   command::Geometry,
+                                   command::PushTarget,
+                                   command::PopTarget,
+                                   command::DestroyTexture,
+                                   command::Custom>;
+
+using RenderCommandList = std::vector<RenderCommand>;
+
+} // namespace engine::render
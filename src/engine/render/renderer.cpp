@@ -2,8 +2,11 @@
 #include "../resource/resource_manager.h"
 #include "camera.h"
 #include "image.h"
+#include "../core/main_thread_queue.h"
 #include <SDL3/SDL.h>
 #include <stdexcept> // For std::runtime_error
+#include <cmath>
+#include <utility>
 #include <spdlog/spdlog.h>
 #include <entt/core/hashed_string.hpp>
 
@@ -12,8 +15,9 @@ using namespace entt::literals;
 namespace engine::render {
 
 // 构造函数: 执行初始化，增加 ResourceManager
-Renderer::Renderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager)
-    : renderer_(sdl_renderer), resource_manager_(resource_manager) 
+Renderer::Renderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager,
+                   engine::core::MainThreadQueue* main_thread_queue)
+    : renderer_(sdl_renderer), resource_manager_(resource_manager), main_thread_queue_(main_thread_queue)
 {
     spdlog::trace("Renderer build successfully.");
     if (!renderer_) {
@@ -58,32 +62,82 @@ void Renderer::drawSprite(const Camera& camera, const component::Sprite& sprite,
         sprite.src_rect_.size.y
     };
 
-    // 设置调整颜色与透明度
-    SDL_SetTextureColorModFloat(texture, color.r, color.g, color.b);
-    SDL_SetTextureAlphaModFloat(texture, color.a);
+    // 设置调整颜色与透明度，执行绘制(默认旋转中心为精灵的中心点)
+    submit(command::Texture{texture, src_rect, true, dest_rect, rotation,
+                            sprite.is_flipped_ ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE, true, color});
+}
+
+void Renderer::drawParallax(const Camera& camera, const component::Sprite& sprite, const glm::vec2& position, const glm::vec2& size,
+                            const glm::vec2& scroll_factor, const glm::bvec2& repeat, const engine::utils::FColor& color) {
+    if (size.x <= 0.0f || size.y <= 0.0f) return;
+    auto texture = resource_manager_->getTexture(sprite.texture_id_, sprite.texture_path_);
+    if (!texture) {
+        spdlog::error("unable to get texture for ID {}.", sprite.texture_id_);
+        return;
+    }
+
+    // 应用视差滚动后的屏幕位置
+    const glm::vec2 screen_position = camera.worldToScreenWithParallax(position, scroll_factor);
+    const glm::vec2 viewport_size = camera.getViewportSize();
+
+    // 每个方向上需要覆盖的范围：重复时从视口左上方第一个块开始铺满视口，否则只有一块
+    auto tile_range = [](float screen, float tile, float viewport, bool repeat, float& start, float& end) {
+        if (!repeat) {
+            start = screen;
+            end = screen + tile;
+            return;
+        }
+        start = std::fmod(screen, tile);
+        if (start > 0.0f) start -= tile;
+        end = viewport;
+    };
+    glm::vec2 start{0.0f};
+    glm::vec2 end{0.0f};
+    tile_range(screen_position.x, size.x, viewport_size.x, repeat.x, start.x, end.x);
+    tile_range(screen_position.y, size.y, viewport_size.y, repeat.y, start.y, end.y);
+    if (end.x < 0.0f || start.x > viewport_size.x || end.y < 0.0f || start.y > viewport_size.y) {
+        return;     // 不重复且在视口外
+    }
+
+    // 源矩形对应的归一化纹理坐标 (翻转时交换u)
+    glm::vec2 texture_size{0.0f};
+    if (!SDL_GetTextureSize(texture, &texture_size.x, &texture_size.y) || texture_size.x <= 0.0f || texture_size.y <= 0.0f) {
+        spdlog::error("cannot get texture size for parallax layer, ID: {}", sprite.texture_id_);
+        return;
+    }
+    glm::vec2 uv_min = sprite.src_rect_.position / texture_size;
+    glm::vec2 uv_max = (sprite.src_rect_.position + sprite.src_rect_.size) / texture_size;
+    if (sprite.is_flipped_) std::swap(uv_min.x, uv_max.x);
 
-    // 执行绘制(默认旋转中心为精灵的中心点)
-    if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect, &dest_rect, rotation, NULL, sprite.is_flipped_ ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-        spdlog::error("render rotate texture failed（ID: {}）：{}", sprite.texture_id_, SDL_GetError());
-    }   
+    // 只生成与视口相交的块
+    PrimitiveBatch batch;
+    for (float y = start.y; y < end.y; y += size.y) {
+        if (y + size.y < 0.0f) continue;
+        for (float x = start.x; x < end.x; x += size.x) {
+            if (x + size.x < 0.0f) continue;
+            batch.addTexturedRect({x, y, size.x, size.y}, uv_min, uv_max, color);
+        }
+    }
+    submitBatch(batch, texture);
 }
 
 void Renderer::drawFilledCircle(const Camera& camera, const glm::vec2& position, const float radius, const engine::utils::FColor& color) {
     // 获取引擎自带的圆形纹理
-    auto circle_texture = resource_manager_->getTexture("assets/textures/UI/circle.png"_hs);
+    auto circle_texture = resource_manager_->getTexture("assets/textures/UI/circle.png"_hs, "assets/textures/UI/circle.png");
     if (!circle_texture) {
         spdlog::error("not get engine default circle texture.");
         return;
     }
     auto screen_position = camera.worldToScreen(position);
-    // 设置颜色和透明度
-    SDL_SetTextureColorModFloat(circle_texture, color.r, color.g, color.b);
-    SDL_SetTextureAlphaModFloat(circle_texture, color.a);
-    // 绘制
+    // 设置颜色和透明度并绘制
     SDL_FRect dest_rect = {screen_position.x - radius, screen_position.y - radius, radius * 2, radius * 2};
-    if (!SDL_RenderTextureRotated(renderer_, circle_texture, nullptr, &dest_rect, 0.0, nullptr, SDL_FLIP_NONE)) {
-        spdlog::error("render filled circle failed：{}", SDL_GetError());
+    if (batching_) {
+        if (!isRectInViewport(camera, dest_rect)) return;
+        circle_texture_ = circle_texture;
+        circle_batch_.addFilledRect(dest_rect, color);
+        return;
     }
+    submit(command::Texture{circle_texture, {}, false, dest_rect, 0.0, SDL_FLIP_NONE, true, color});
 }
 
 void Renderer::drawFilledRect(const Camera& camera, const glm::vec2& position, const glm::vec2& size, const engine::utils::FColor& color) {
@@ -91,13 +145,12 @@ void Renderer::drawFilledRect(const Camera& camera, const glm::vec2& position, c
     auto screen_position = camera.worldToScreen(position);
     // 创建目标矩形
     SDL_FRect dest_rect = {screen_position.x, screen_position.y, size.x, size.y};
-    // 设置颜色并绘制
-    setDrawColorFloat(color.r, color.g, color.b, color.a);
-    if (!SDL_RenderFillRect(renderer_, &dest_rect)) {
-        spdlog::error("render fill rect failed：{}", SDL_GetError());
+    if (batching_) {
+        if (isRectInViewport(camera, dest_rect)) color_batch_.addFilledRect(dest_rect, color);
+        return;
     }
-    // 恢复默认颜色
-    setDrawColorFloat(0, 0, 0, 1.0f);
+    // 设置颜色并绘制
+    submit(command::Rect{dest_rect, color, true, 1});
 }
 
 void Renderer::drawRect(const Camera& camera, const glm::vec2& position, const glm::vec2& size, const engine::utils::FColor& color, const int thickness) {
@@ -105,19 +158,51 @@ void Renderer::drawRect(const Camera& camera, const glm::vec2& position, const g
     auto screen_position = camera.worldToScreen(position);
     // 创建目标矩形
     SDL_FRect dest_rect = {screen_position.x, screen_position.y, size.x, size.y};
+    if (batching_) {
+        if (isRectInViewport(camera, dest_rect)) color_batch_.addRect(dest_rect, color, static_cast<float>(thickness));
+        return;
+    }
     // 设置颜色并绘制
-    setDrawColorFloat(color.r, color.g, color.b, color.a);
-    for (int i = 0; i < thickness; i++) {
-        if (!SDL_RenderRect(renderer_, &dest_rect)) {
-            spdlog::error("render rect failed：{}", SDL_GetError());
-        }
-        dest_rect.x += 1;
-        dest_rect.y += 1;
-        dest_rect.w -= 2;
-        dest_rect.h -= 2;
+    submit(command::Rect{dest_rect, color, false, thickness});
+}
+
+void Renderer::drawLine(const Camera& camera, const glm::vec2& start, const glm::vec2& end, const engine::utils::FColor& color, const float thickness) {
+    const auto screen_start = camera.worldToScreen(start);
+    const auto screen_end = camera.worldToScreen(end);
+    if (batching_) {
+        color_batch_.addLine(screen_start, screen_end, color, thickness);
+        return;
     }
-    // 恢复默认颜色
-    setDrawColorFloat(0, 0, 0, 1.0f);
+    // 不在批处理中时，单独作为一条几何命令提交
+    PrimitiveBatch batch;
+    batch.addLine(screen_start, screen_end, color, thickness);
+    submitBatch(batch, nullptr);
+}
+
+void Renderer::beginBatch() {
+    if (batching_) {
+        spdlog::warn("beginBatch called while a batch is open, flushing it first.");
+        flushBatch();
+    }
+    batching_ = true;
+}
+
+void Renderer::flushBatch() {
+    if (!batching_) return;
+    batching_ = false;
+    submitBatch(color_batch_, nullptr);
+    submitBatch(circle_batch_, circle_texture_);
+}
+
+void Renderer::drawBatch(PrimitiveBatch& batch, SDL_Texture* texture) {
+    submitBatch(batch, texture);
+}
+
+void Renderer::submitBatch(PrimitiveBatch& batch, SDL_Texture* texture) {
+    if (batch.empty()) return;
+    command::Geometry geometry{texture, {}, {}};
+    batch.release(geometry.vertices_, geometry.indices_);
+    submit(std::move(geometry));
 }
 
 void Renderer::drawUIImage(const Image& image, const glm::vec2& position, const std::optional<glm::vec2>& size) {
@@ -143,9 +228,8 @@ void Renderer::drawUIImage(const Image& image, const glm::vec2& position, const
     }
 
     // 执行绘制(未考虑UI旋转)
-    if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dest_rect, 0.0, nullptr, image.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-        spdlog::error("draw UI Image failed for ID {}: {}", image.getTextureId(), SDL_GetError());
-    }
+    submit(command::Texture{texture, src_rect.value(), true, dest_rect, 0.0,
+                            image.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE, false, {}});
 }
 
 void Renderer::setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
@@ -161,20 +245,88 @@ void Renderer::setDrawColorFloat(float r, float g, float b, float a) {
 }
 
 void Renderer::clearScreen() {
-    setDrawColorFloat(background_color_.r, background_color_.g, background_color_.b, background_color_.a);
-    if (!SDL_RenderClear(renderer_)) {
-        spdlog::error("clear screen failed: {}", SDL_GetError());
-    }
+    submit(command::Clear{background_color_});
 }
 
 void Renderer::drawUIFilledRect(const engine::utils::Rect &rect, const engine::utils::FColor &color)
 {
-    setDrawColorFloat(color.r, color.g, color.b, color.a);
     SDL_FRect sdl_rect = {rect.position.x, rect.position.y, rect.size.x, rect.size.y};
-    if (!SDL_RenderFillRect(renderer_, &sdl_rect)) {
-        spdlog::error("draw filled rect failed: {}", SDL_GetError());
+    submit(command::Rect{sdl_rect, color, true, 1});
+}
+
+void Renderer::drawCustom(std::function<void()> draw_func) {
+    if (!draw_func) return;
+    submit(command::Custom{std::move(draw_func)});
+}
+
+SDL_Texture* Renderer::createRenderTarget(const glm::vec2& size) {
+    const int width = static_cast<int>(std::ceil(size.x));
+    const int height = static_cast<int>(std::ceil(size.y));
+    if (width <= 0 || height <= 0) return nullptr;
+    // 纹理只能由主线程创建
+    return engine::core::invokeOnMainThread(main_thread_queue_, [this, width, height]() -> SDL_Texture* {
+        SDL_Texture* texture = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (!texture) {
+            spdlog::error("create render target ({}x{}) failed: {}", width, height, SDL_GetError());
+            return nullptr;
+        }
+        // 与普通纹理一致，保持像素风格
+        SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        return texture;
+    });
+}
+
+bool Renderer::pushRenderTarget(SDL_Texture* target) {
+    if (!target) return false;
+    if (recording_) {
+        submit(command::PushTarget{target});
+        return true;
+    }
+    return applyRenderTarget(target);
+}
+
+void Renderer::popRenderTarget() {
+    submit(command::PopTarget{});
+}
+
+void Renderer::drawUITexture(SDL_Texture* texture, const engine::utils::Rect& rect) {
+    if (!texture) return;
+    SDL_FRect dest_rect = {rect.position.x, rect.position.y, rect.size.x, rect.size.y};
+    submit(command::Texture{texture, {}, false, dest_rect, 0.0, SDL_FLIP_NONE, false, {}});
+}
+
+void Renderer::destroyTexture(SDL_Texture* texture) {
+    if (!texture) return;
+    if (recording_) {
+        submit(command::DestroyTexture{texture});
+        return;
+    }
+    engine::core::invokeOnMainThread(main_thread_queue_, [texture] { SDL_DestroyTexture(texture); });
+}
+
+void Renderer::beginRecording() {
+    auto& list = command_lists_[record_index_];
+    list.clear();       // 保留容量，稳定后录制不再分配内存
+    recording_ = true;
+}
+
+void Renderer::endRecording() {
+    recording_ = false;
+    record_index_ ^= 1;
+}
+
+void Renderer::submitRecorded() {
+    auto& list = command_lists_[record_index_ ^ 1];
+    for (const auto& command : list) {
+        execute(command);
+    }
+    list.clear();
+    if (!target_stack_.empty()) {
+        spdlog::warn("{} render target(s) left pushed after submitting recorded commands.", target_stack_.size());
+        target_stack_.clear();
+        SDL_SetRenderTarget(renderer_, nullptr);
     }
-    setDrawColorFloat(0.0f, 0.0f, 0.0f, 1.0f);
 }
 
 void Renderer::present()
@@ -184,7 +336,7 @@ void Renderer::present()
 
 std::optional<SDL_FRect> Renderer::getImageSrcRect(const Image& image)
 {
-    SDL_Texture* texture = resource_manager_->getTexture(image.getTextureId());
+    SDL_Texture* texture = resource_manager_->getTexture(image.getTextureId(), image.getTexturePath());
     if (!texture) {
         spdlog::error("cannot get texture for ID {}.", image.getTextureId());
         return std::nullopt;
@@ -212,6 +364,113 @@ std::optional<SDL_FRect> Renderer::getImageSrcRect(const Image& image)
     }
 }
 
+void Renderer::submit(RenderCommand&& command) {
+    if (recording_) {
+        command_lists_[record_index_].push_back(std::move(command));
+    } else {
+        execute(command);
+    }
+}
+
+void Renderer::execute(const RenderCommand& command) {
+    std::visit([this](const auto& cmd) { execute(cmd); }, command);
+}
+
+void Renderer::execute(const command::Clear& command) {
+    setDrawColorFloat(command.color_.r, command.color_.g, command.color_.b, command.color_.a);
+    if (!SDL_RenderClear(renderer_)) {
+        spdlog::error("clear screen failed: {}", SDL_GetError());
+    }
+}
+
+void Renderer::execute(const command::Texture& command) {
+    if (command.modulate_) {
+        SDL_SetTextureColorModFloat(command.texture_, command.color_.r, command.color_.g, command.color_.b);
+        SDL_SetTextureAlphaModFloat(command.texture_, command.color_.a);
+    }
+    const SDL_FRect* src_rect = command.has_src_rect_ ? &command.src_rect_ : nullptr;
+    if (!SDL_RenderTextureRotated(renderer_, command.texture_, src_rect, &command.dest_rect_, command.rotation_, nullptr, command.flip_)) {
+        spdlog::error("render texture failed: {}", SDL_GetError());
+    }
+}
+
+void Renderer::execute(const command::Rect& command) {
+    setDrawColorFloat(command.color_.r, command.color_.g, command.color_.b, command.color_.a);
+    if (command.filled_) {
+        if (!SDL_RenderFillRect(renderer_, &command.rect_)) {
+            spdlog::error("render fill rect failed: {}", SDL_GetError());
+        }
+    } else {
+        SDL_FRect dest_rect = command.rect_;
+        for (int i = 0; i < command.thickness_; i++) {
+            if (!SDL_RenderRect(renderer_, &dest_rect)) {
+                spdlog::error("render rect failed: {}", SDL_GetError());
+            }
+            dest_rect.x += 1;
+            dest_rect.y += 1;
+            dest_rect.w -= 2;
+            dest_rect.h -= 2;
+        }
+    }
+    // 恢复默认颜色
+    setDrawColorFloat(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+void Renderer::execute(const command::Geometry& command) {
+    if (command.texture_) {
+        // 颜色由顶点提供，清除之前单独绘制时留下的颜色调制
+        SDL_SetTextureColorModFloat(command.texture_, 1.0f, 1.0f, 1.0f);
+        SDL_SetTextureAlphaModFloat(command.texture_, 1.0f);
+    }
+    if (!SDL_RenderGeometry(renderer_, command.texture_,
+                            command.vertices_.data(), static_cast<int>(command.vertices_.size()),
+                            command.indices_.data(), static_cast<int>(command.indices_.size()))) {
+        spdlog::error("render geometry failed: {}", SDL_GetError());
+    }
+}
+
+void Renderer::execute(const command::PushTarget& command) {
+    if (!applyRenderTarget(command.target_)) {
+        // 录制时已假定成功，这里压入当前目标以保持栈平衡，使对应的 PopTarget 恢复到当前目标
+        target_stack_.push_back(SDL_GetRenderTarget(renderer_));
+    }
+}
+
+void Renderer::execute(const command::PopTarget&) {
+    if (target_stack_.empty()) {
+        spdlog::warn("popRenderTarget called without matching pushRenderTarget.");
+        return;
+    }
+    target_stack_.pop_back();
+    // 栈空时恢复为窗口 (nullptr)，逻辑分辨率等设置由SDL自动恢复
+    SDL_Texture* previous = target_stack_.empty() ? nullptr : target_stack_.back();
+    if (!SDL_SetRenderTarget(renderer_, previous)) {
+        spdlog::error("restore render target failed: {}", SDL_GetError());
+    }
+}
+
+void Renderer::execute(const command::DestroyTexture& command) {
+    SDL_DestroyTexture(command.texture_);
+}
+
+void Renderer::execute(const command::Custom& command) {
+    command.draw_();
+}
+
+bool Renderer::applyRenderTarget(SDL_Texture* target) {
+    if (!SDL_SetRenderTarget(renderer_, target)) {
+        spdlog::error("set render target failed: {}", SDL_GetError());
+        return false;
+    }
+    target_stack_.push_back(target);
+    setDrawColorFloat(0.0f, 0.0f, 0.0f, 0.0f);
+    if (!SDL_RenderClear(renderer_)) {
+        spdlog::error("clear render target failed: {}", SDL_GetError());
+    }
+    setDrawColorFloat(0.0f, 0.0f, 0.0f, 1.0f);
+    return true;
+}
+
 bool Renderer::isRectInViewport(const Camera& camera, const SDL_FRect &rect) {
     glm::vec2 viewport_size = camera.getViewportSize();
     return rect.x + rect.w >= 0 && rect.x <= viewport_size.x &&     // 相当于 AABB碰撞检测
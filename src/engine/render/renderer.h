@@ -1,17 +1,27 @@
 #pragma once
 
 #include "image.h"
+#include "render_command.h"
+#include "primitive_batch.h"
 #include "../component/sprite_component.h"
 #include "../utils/math.h"
+#include <array>
+#include <functional>
 #include <optional>
+#include <vector>
 
 struct SDL_Renderer;
+struct SDL_Texture;
 struct SDL_FRect;
 
 namespace engine::resource {
     class ResourceManager;
 }
 
+namespace engine::core {
+    class MainThreadQueue;
+}
+
 namespace engine::render {
 class Camera;
 
@@ -21,13 +31,32 @@ class Camera;
  * 包装 SDL_Renderer 并提供清除屏幕、绘制精灵和呈现最终图像的方法。
  * 在构造时初始化。依赖于一个有效的 SDL_Renderer 和 ResourceManager。
  * 构造失败会抛出异常。
+ *
+ * 绘制函数先把参数解析为渲染命令 (见 RenderCommand)，默认立即执行；
+ * beginRecording() 与 endRecording() 之间的命令则录制到后台列表，由主线程在下一帧 submitRecorded() 时执行。
+ * 两个列表交替使用 (双缓冲)，因此模拟线程录制第 N 帧的同时，主线程可以提交第 N-1 帧。
+ *
+ * 图元批处理：beginBatch() 与 flushBatch() 之间的 drawFilledRect/drawRect/drawLine/drawFilledCircle
+ * 不单独绘制，而是累积为带顶点颜色的三角形，flushBatch() 时纯色图元与圆形各用一次 SDL_RenderGeometry 提交。
+ * 同一批内纯色图元总是先于圆形绘制。
  */
 class Renderer final{
 private:
     SDL_Renderer* renderer_ = nullptr;                              ///< @brief 指向 SDL_Renderer 的非拥有指针
     engine::resource::ResourceManager* resource_manager_ = nullptr; ///< @brief 指向 ResourceManager 的非拥有指针
+    engine::core::MainThreadQueue* main_thread_queue_ = nullptr;    ///< @brief 主线程任务队列 (可为空，为空时表示只在主线程中使用)
     
     engine::utils::FColor background_color_{0.0f, 0.0f, 0.0f, 1.0f};///< @brief 清除屏幕的颜色（默认黑色），可调用setBgColorFloat设置
+    std::vector<SDL_Texture*> target_stack_;                        ///< @brief 渲染目标栈，支持嵌套的渲染到纹理
+
+    std::array<RenderCommandList, 2> command_lists_;                ///< @brief 双缓冲的命令列表
+    size_t record_index_ = 0;                                       ///< @brief 正在录制的列表 (另一个为等待提交的前台列表)
+    bool recording_ = false;                                        ///< @brief 是否正在录制
+
+    PrimitiveBatch color_batch_;                                    ///< @brief 纯色图元批 (矩形、边框、线段)
+    PrimitiveBatch circle_batch_;                                   ///< @brief 圆形批 (使用默认圆形纹理)
+    SDL_Texture* circle_texture_ = nullptr;                         ///< @brief 圆形批使用的纹理
+    bool batching_ = false;                                         ///< @brief 是否正在累积图元批
 
 public:
     /**
@@ -35,9 +64,11 @@ public:
      *
      * @param sdl_renderer 指向有效的 SDL_Renderer 的指针。不能为空。
      * @param resource_manager 指向有效的 ResourceManager 的指针。不能为空。
-     * @throws std::runtime_error 如果任一指针为 nullptr。
+     * @param main_thread_queue 主线程任务队列，在其它线程中创建/销毁纹理时转交到主线程。可以为空。
+     * @throws std::runtime_error 如果 sdl_renderer 或 resource_manager 为 nullptr。
      */
-    Renderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager);
+    Renderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager,
+             engine::core::MainThreadQueue* main_thread_queue = nullptr);
 
     /**
      * @brief 绘制一个精灵
@@ -52,6 +83,23 @@ public:
     void drawSprite(const Camera& camera, const component::Sprite& sprite, const glm::vec2& position, 
                     const glm::vec2& size, const float rotation = 0.0f, const engine::utils::FColor& color = engine::utils::FColor::white());
 
+    /**
+     * @brief 绘制视差图层，按滚动因子偏移，并可在 x/y 方向上平铺重复。
+     *
+     * 只生成与视口相交的平铺块，所有块合并为一次 SDL_RenderGeometry 提交。
+     * 
+     * @param camera 游戏相机，用于坐标转换。
+     * @param sprite 图层图片。
+     * @param position 图层左上角的世界坐标 (未应用视差)。
+     * @param size 单个平铺块的大小。
+     * @param scroll_factor 滚动因子 (0=静止, 1=随相机移动)。
+     * @param repeat 是否在 x/y 方向上重复。
+     * @param color 调整颜色。
+     */
+    void drawParallax(const Camera& camera, const component::Sprite& sprite, const glm::vec2& position, const glm::vec2& size,
+                      const glm::vec2& scroll_factor, const glm::bvec2& repeat,
+                      const engine::utils::FColor& color = engine::utils::FColor::white());
+
     /**
      * @brief 绘制填充圆形
      * @note 必须存在默认圆形纹理"assets/textures/UI/circle.png"
@@ -81,6 +129,27 @@ public:
      */
     void drawRect(const Camera& camera, const glm::vec2& position, const glm::vec2& size, const engine::utils::FColor& color, const int thickness = 1);
 
+    /**
+     * @brief 绘制线段
+     * 
+     * @param start 起点 (世界坐标)
+     * @param end 终点 (世界坐标)
+     * @param color 颜色
+     * @param thickness 线宽 (像素)
+     */
+    void drawLine(const Camera& camera, const glm::vec2& start, const glm::vec2& end, const engine::utils::FColor& color, const float thickness = 1.0f);
+
+    // --- 图元批处理 ---
+    void beginBatch();                                                  ///< @brief 开始累积图元批，不可嵌套
+    void flushBatch();                                                  ///< @brief 提交累积的图元 (每类至多一次绘制调用) 并结束批处理
+
+    /**
+     * @brief 把调用者累积的图元批 (屏幕坐标) 作为一次 SDL_RenderGeometry 绘制，如位图字体的文字。
+     * @param batch 图元批，提交后为空
+     * @param texture 批使用的纹理，为空时为纯色
+     */
+    void drawBatch(PrimitiveBatch& batch, SDL_Texture* texture);
+
     /**
      * @brief 在屏幕坐标中直接渲染一个用于UI的Image对象。
      *
@@ -98,7 +167,45 @@ public:
      */
     void drawUIFilledRect(const engine::utils::Rect& rect, const engine::utils::FColor& color);
 
-    void present();                                                     ///< @brief 更新屏幕，包装 SDL_RenderPresent 函数
+    /**
+     * @brief 自定义绘制 (如文字)。录制时延迟到提交时在主线程中调用，否则立即调用。
+     * @note draw_func 捕获的数据在调用前必须保持有效，通常应按值捕获。
+     */
+    void drawCustom(std::function<void()> draw_func);
+
+    // --- 渲染到纹理 (用于UI缓存等) ---
+    /**
+     * @brief 创建一个可作为渲染目标的纹理，调用者负责通过 destroyTexture() 销毁。
+     * @param size 纹理尺寸 (逻辑像素)。
+     * @return 创建失败时返回 nullptr。
+     */
+    [[nodiscard]] SDL_Texture* createRenderTarget(const glm::vec2& size);
+
+    /**
+     * @brief 将渲染目标切换为指定纹理，并清空为全透明。
+     * @note 必须与 popRenderTarget() 成对调用，可以嵌套。录制时只检查参数，总是返回 true。
+     */
+    bool pushRenderTarget(SDL_Texture* target);
+    void popRenderTarget();                                             ///< @brief 恢复上一个渲染目标
+
+    /**
+     * @brief 在屏幕坐标中绘制由 pushRenderTarget 渲染得到的纹理。
+     * @note 渲染到透明纹理得到的是预乘alpha的颜色，因此使用预乘混合模式绘制。
+     */
+    void drawUITexture(SDL_Texture* texture, const engine::utils::Rect& rect);
+
+    /**
+     * @brief 销毁纹理。录制时延迟到此前录制的命令都执行完毕之后，因此可以销毁本帧刚绘制过的纹理。
+     */
+    void destroyTexture(SDL_Texture* texture);
+
+    // --- 命令录制 (模拟与渲染分离时使用) ---
+    void beginRecording();                                              ///< @brief 清空后台列表，之后的绘制命令都录制到其中
+    void endRecording();                                                ///< @brief 结束录制，刚录制的列表成为前台列表
+    void submitRecorded();                                              ///< @brief (主线程) 执行前台列表 (上一次录制的命令) 并清空
+    bool isRecording() const { return recording_; }
+
+    void present();                                                     ///< @brief 更新屏幕，包装 SDL_RenderPresent 函数 (主线程)
     void clearScreen();                                                 ///< @brief 清屏，包装 SDL_RenderClear 函数
 
     void setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);        ///< @brief 设置绘制颜色，包装 SDL_SetRenderDrawColor 函数，使用 Uint8 类型
@@ -107,6 +214,7 @@ public:
     void setBgColorFloat(float r, float g, float b, float a = 1.0f) { background_color_ = {r, g, b, a}; }    ///< @brief 设置背景颜色，使用 float 类型
 
     SDL_Renderer* getSDLRenderer() const { return renderer_; }          ///< @brief 获取底层的 SDL_Renderer 指针
+    engine::core::MainThreadQueue* getMainThreadQueue() const { return main_thread_queue_; }   ///< @brief 获取主线程任务队列 (可能为空)
 
     // 禁用拷贝和移动语义
     Renderer(const Renderer&) = delete;
@@ -118,6 +226,19 @@ private:
     std::optional<SDL_FRect> getImageSrcRect(const Image& image);       ///< @brief 获取Image的源矩形，用于具体绘制。出现错误则返回std::nullopt并跳过绘制
     bool isRectInViewport(const Camera& camera, const SDL_FRect& rect);  ///< @brief 判断矩形是否在视口中，用于视口裁剪
 
+    void submit(RenderCommand&& command);                               ///< @brief 录制时存入后台列表，否则立即执行
+    void execute(const RenderCommand& command);                         ///< @brief 把命令转换为 SDL 调用
+    void execute(const command::Clear& command);
+    void execute(const command::Texture& command);
+    void execute(const command::Rect& command);
+    void execute(const command::Geometry& command);
+    void execute(const command::PushTarget& command);
+    void execute(const command::PopTarget& command);
+    void execute(const command::DestroyTexture& command);
+    void execute(const command::Custom& command);
+    bool applyRenderTarget(SDL_Texture* target);                        ///< @brief 切换渲染目标并清空，失败返回 false
+    void submitBatch(PrimitiveBatch& batch, SDL_Texture* texture);      ///< @brief 把批中的图元作为一条几何命令提交
+
 };
 
 } // namespace engine::render
@@ -1,5 +1,7 @@
 #include "text_renderer.h"
 #include "camera.h"
+#include "renderer.h"
+#include "../core/main_thread_queue.h"
 #include "../resource/resource_manager.h"
 #include <SDL3_ttf/SDL_ttf.h>
 #include <spdlog/spdlog.h>
@@ -7,19 +9,19 @@
 
 namespace engine::render {
 
-TextRenderer::TextRenderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager)
-    : sdl_renderer_(sdl_renderer),
+TextRenderer::TextRenderer(Renderer* renderer, engine::resource::ResourceManager* resource_manager)
+    : renderer_(renderer),
       resource_manager_(resource_manager)
 {
-    if (!sdl_renderer_ || !resource_manager_) {
-        throw std::runtime_error("TextRenderer need valid SDL_Renderer and ResourceManager.");
+    if (!renderer_ || !resource_manager_) {
+        throw std::runtime_error("TextRenderer need valid Renderer and ResourceManager.");
     }
     // 初始化 SDL_ttf
     if (!TTF_WasInit() && TTF_Init() == false) {
         throw std::runtime_error("SDL_ttf init failed: " + std::string(SDL_GetError()));
     }
 
-    text_engine_ = TTF_CreateRendererTextEngine(sdl_renderer_);
+    text_engine_ = TTF_CreateRendererTextEngine(renderer_->getSDLRenderer());
     if (!text_engine_) {
         spdlog::error("Create TTF_TextEngine failed: {}", SDL_GetError());
         throw std::runtime_error("Create TTF_TextEngine failed.");
@@ -44,17 +46,25 @@ void TextRenderer::close()
 }
 
 void TextRenderer::drawUIText(std::string_view text, entt::id_type font_id, int font_size,
-                              const glm::vec2 &position, const engine::utils::FColor &color)
+                              const glm::vec2 &position, const engine::utils::FColor &color, std::string_view font_path)
 {
     /* 构造函数已经保证了必要指针不会为空，这里不需要再检查 */
-    TTF_Font* font = resource_manager_->getFont(font_id, font_size);
+    TTF_Font* font = resource_manager_->getFont(font_id, font_size, font_path);
     if (!font) {
         spdlog::warn("drawUIText get font failed: {} size {}", font_id, font_size);
         return;
     }
 
+    // 字符串按值捕获，录制时命令执行前调用方的字符串可能已经失效
+    renderer_->drawCustom([this, font, text = std::string(text), position, color] {
+        renderText(font, text, position, color);
+    });
+}
+
+void TextRenderer::renderText(TTF_Font* font, const std::string& text, const glm::vec2& position, const engine::utils::FColor& color)
+{
     // 创建临时 TTF_Text 对象   (目前效率不高，未来可以考虑使用缓存优化)
-    TTF_Text* temp_text_object = TTF_CreateText(text_engine_, font, text.data(), 0);
+    TTF_Text* temp_text_object = TTF_CreateText(text_engine_, font, text.c_str(), text.size());
     if (!temp_text_object) {
         spdlog::error("drawUIText create temp TTF_Text failed: {}", SDL_GetError());
         return;
@@ -77,13 +87,13 @@ void TextRenderer::drawUIText(std::string_view text, entt::id_type font_id, int
 }
 
 void TextRenderer::drawText(const Camera &camera, std::string_view text, entt::id_type font_id, int font_size, 
-                            const glm::vec2 &position, const engine::utils::FColor &color)
+                            const glm::vec2 &position, const engine::utils::FColor &color, std::string_view font_path)
 {
     // 应用相机变换
     glm::vec2 position_screen = camera.worldToScreen(position);
 
     // 用新坐标调用drawUIText即可
-    drawUIText(text, font_id, font_size, position_screen, color);
+    drawUIText(text, font_id, font_size, position_screen, color, font_path);
 }
 
 glm::vec2 TextRenderer::getTextSize(std::string_view text, entt::id_type font_id, int font_size, std::string_view font_path) {
@@ -94,18 +104,14 @@ glm::vec2 TextRenderer::getTextSize(std::string_view text, entt::id_type font_id
         return glm::vec2(0.0f, 0.0f);
     }
 
-    // 创建临时 TTF_Text 对象
-    TTF_Text* temp_text_object = TTF_CreateText(text_engine_, font, text.data(), 0);
-    if (!temp_text_object) {
-        spdlog::error("getTextSize create temp TTF_Text failed: {}", SDL_GetError());
-        return glm::vec2(0.0f, 0.0f);
-    }
-
-    int width, height;
-    TTF_GetTextSize(temp_text_object, &width, &height);
-
-    // 销毁临时 TTF_Text 对象
-    TTF_DestroyText(temp_text_object);
+    // 直接测量字符串，不需要创建 TTF_Text 对象；SDL_ttf 不是线程安全的，因此在主线程中测量
+    int width = 0;
+    int height = 0;
+    engine::core::invokeOnMainThread(renderer_->getMainThreadQueue(), [font, text, &width, &height] {
+        if (!TTF_GetStringSize(font, text.data(), text.size(), &width, &height)) {
+            spdlog::error("getTextSize measure string failed: {}", SDL_GetError());
+        }
+    });
 
     return glm::vec2(static_cast<float>(width), static_cast<float>(height));
 } 
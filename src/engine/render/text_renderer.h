@@ -1,12 +1,14 @@
 #pragma once
 
 #include <SDL3/SDL_render.h>
+#include <string>
 #include <string_view>
 #include <entt/core/hashed_string.hpp>
 #include <glm/vec2.hpp>
 #include "../utils/math.h"
 
 struct TTF_TextEngine;
+struct TTF_Font;
 
 namespace engine::resource {
     class ResourceManager;
@@ -14,15 +16,17 @@ namespace engine::resource {
 
 namespace engine::render {
     class Camera;
+    class Renderer;
 /**
  * @brief 使用 SDL_ttf 和 TTF_Text 对象处理文本渲染。
  *
  * 封装 TTF_TextEngine 并提供创建和绘制 TTF_Text 对象的方法，
  * 管理字体加载和颜色设置。
+ * 绘制通过 Renderer::drawCustom() 提交，因此与其它绘制命令一起录制，最终总是在主线程中执行。
  */
 class TextRenderer final {
 private:
-    SDL_Renderer* sdl_renderer_ = nullptr;                          ///< @brief 持有渲染器的非拥有指针
+    Renderer* renderer_ = nullptr;                                  ///< @brief 持有渲染器的非拥有指针
     engine::resource::ResourceManager* resource_manager_ = nullptr; ///< @brief 持有资源管理器的非拥有指针
     
     TTF_TextEngine* text_engine_ = nullptr;         ///< @brief 使用SDL3引入的 TTF_TextEngine 来进行绘制
@@ -31,11 +35,11 @@ public:
     /**
      * @brief 构造 TextRenderer。
      *
-     * @param sdl_renderer 有效的 SDL_Renderer 指针。
+     * @param renderer 有效的 Renderer 指针。
      * @param resource_manager 有效的 ResourceManager 指针（用于字体加载）。
      * @throws std::runtime_error 如果初始化失败。
      */
-    TextRenderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager);
+    TextRenderer(Renderer* renderer, engine::resource::ResourceManager* resource_manager);
 
     ~TextRenderer();            ///< @brief 析构函数，按需调用close()。
 
@@ -49,9 +53,11 @@ public:
      * @param font_size 字体大小。
      * @param position 左上角屏幕位置。
      * @param color 文本颜色。(默认为白色)
+     * @param font_path 字体文件路径 (字体被缓存淘汰后用于重新加载)
      */
     void drawUIText(std::string_view text, entt::id_type font_id, int font_size, 
-                  const glm::vec2& position, const engine::utils::FColor& color = {1.0f, 1.0f, 1.0f, 1.0f});
+                  const glm::vec2& position, const engine::utils::FColor& color = {1.0f, 1.0f, 1.0f, 1.0f},
+                  std::string_view font_path = "");
 
     /**
      * @brief 绘制地图上的字符串。
@@ -62,9 +68,11 @@ public:
      * @param font_size 字体大小。
      * @param position 左上角屏幕位置。
      * @param color 文本颜色。(默认为白色)
+     * @param font_path 字体文件路径 (字体被缓存淘汰后用于重新加载)
      */
     void drawText(const Camera& camera, std::string_view text, entt::id_type font_id, int font_size, 
-                  const glm::vec2& position, const engine::utils::FColor& color = {1.0f, 1.0f, 1.0f, 1.0f});
+                  const glm::vec2& position, const engine::utils::FColor& color = {1.0f, 1.0f, 1.0f, 1.0f},
+                  std::string_view font_path = "");
 
     /**
      * @brief 获取文本的尺寸。
@@ -82,6 +90,10 @@ public:
     TextRenderer(TextRenderer&&) = delete;
     TextRenderer& operator=(TextRenderer&&) = delete;
 
+private:
+    /// @brief (主线程) 立即绘制带阴影的字符串
+    void renderText(TTF_Font* font, const std::string& text, const glm::vec2& position, const engine::utils::FColor& color);
+
 }; // class TextRenderer
 
 } // namespace engine::render
\ No newline at end of file
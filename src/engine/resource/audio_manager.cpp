@@ -2,6 +2,9 @@
 #include <SDL3_mixer/SDL_mixer.h>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <entt/core/hashed_string.hpp>
 
 namespace engine::resource {
@@ -41,45 +44,73 @@ AudioManager::~AudioManager()
 }
 
 // --- 音效管理 ---
-Mix_Chunk* AudioManager::loadSound(entt::id_type id, std::string_view file_path) {
+bool AudioManager::loadSound(entt::id_type id, std::string_view file_path) {
     // 首先检查缓存
     auto it = sounds_.find(id);
     if (it != sounds_.end()) {
-        return it->second.get();
+        it->second.last_used_frame_ = current_frame_;
+        return true;
     }
 
-    // 加载音效块
+    // 只读取文件数据，解码推迟到首次播放
     spdlog::debug("loading sound: '{}', {}", file_path, id);
-    Mix_Chunk* raw_chunk = Mix_LoadWAV(file_path.data());
-    if (!raw_chunk) {
-        spdlog::error("loading sound failed: '{}', {}, {}", file_path, id, SDL_GetError());
-        return nullptr;
+    std::ifstream file(std::filesystem::path(file_path), std::ios::binary);
+    if (!file.is_open()) {
+        spdlog::error("loading sound failed: '{}', {}, can not open file.", file_path, id);
+        return false;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (data.empty()) {
+        spdlog::error("loading sound failed: '{}', {}, file is empty.", file_path, id);
+        return false;
     }
 
-    // 使用unique_ptr存储在缓存中
-    sounds_.emplace(id, std::unique_ptr<Mix_Chunk, SDLMixChunkDeleter>(raw_chunk));
-    spdlog::debug("successfully loaded and cached sound: '{}', {}", file_path, id);
-    return raw_chunk;
+    spdlog::debug("successfully loaded and cached sound: '{}', {}, {} bytes", file_path, id, data.size());
+    sound_paths_.try_emplace(id, file_path);
+    return cacheSound(id, std::move(data));
 }
 
-Mix_Chunk* AudioManager::loadSound(entt::hashed_string str_hs) {
+bool AudioManager::loadSound(entt::hashed_string str_hs) {
     return loadSound(str_hs.value(), str_hs.data());
 }
 
+bool AudioManager::addSound(entt::id_type id, std::vector<uint8_t> data, std::string_view file_path) {
+    if (sounds_.contains(id)) {
+        return true;
+    }
+    if (data.empty()) {
+        spdlog::error("cache sound failed: '{}', {}, data is empty.", file_path, id);
+        return false;
+    }
+    spdlog::debug("successfully cached preloaded sound: '{}', {}, {} bytes", file_path, id, data.size());
+    sound_paths_.try_emplace(id, file_path);
+    return cacheSound(id, std::move(data));
+}
+
 Mix_Chunk* AudioManager::getSound(entt::id_type id, std::string_view file_path) {
     auto it = sounds_.find(id);
-    if (it != sounds_.end()) {
-        return it->second.get();
+    if (it == sounds_.end()) {
+        // 如果未找到，判断是否提供了file_path (未提供时使用之前加载时记录的路径，音效可能已被淘汰)
+        if (file_path.empty()) {
+            if (auto path_it = sound_paths_.find(id); path_it != sound_paths_.end()) file_path = path_it->second;
+        }
+        if (file_path.empty()) {
+            spdlog::error("sound '{}', {} not found in cache, and no file path provided. Returning nullptr.", file_path, id);
+            return nullptr;
+        }
+        spdlog::warn("sound '{}', {} not found in cache, trying to load it.", file_path, id);
+        if (!loadSound(id, file_path)) return nullptr;
+        it = sounds_.find(id);
+        if (it == sounds_.end()) return nullptr;    // 超出预算且未被引用时可能立即被淘汰
     }
+    it->second.last_used_frame_ = current_frame_;
 
-    // 如果未找到，判断是否提供了file_path
-    if (file_path.empty()) {
-        spdlog::error("sound '{}', {} not found in cache, and no file path provided. Returning nullptr.", file_path, id);
-        return nullptr;
+    // 已解码则直接返回，否则解码一次
+    if (auto pcm_it = pcm_cache_.find(id); pcm_it != pcm_cache_.end()) {
+        touchPcm(pcm_it->second);
+        return pcm_it->second.get();
     }
-
-    spdlog::warn("sound '{}', {} not found in cache, trying to load it.", file_path, id);
-    return loadSound(id, file_path);
+    return decodeSound(id, it->second);
 }
 
 Mix_Chunk* AudioManager::getSound(entt::hashed_string str_hs) {
@@ -87,10 +118,15 @@ Mix_Chunk* AudioManager::getSound(entt::hashed_string str_hs) {
 }
 
 void AudioManager::unloadSound(entt::id_type id) {
+    if (auto pcm_it = pcm_cache_.find(id); pcm_it != pcm_cache_.end()) {
+        pcm_stats_.remove(pcm_it->second.bytes_);
+        pcm_cache_.erase(pcm_it);   // unique_ptr处理Mix_FreeChunk
+    }
     auto it = sounds_.find(id);
     if (it != sounds_.end()) {
         spdlog::debug("unloading sound: {}", id);
-        sounds_.erase(it);      // unique_ptr处理Mix_FreeChunk
+        sound_stats_.remove(it->second.bytes_);
+        sounds_.erase(it);
     } else {
         spdlog::warn("attempt to unload non-existent sound: {}", id);
     }
@@ -99,8 +135,12 @@ void AudioManager::unloadSound(entt::id_type id) {
 void AudioManager::clearSounds() {
     if (!sounds_.empty()) {
         spdlog::debug("successfully cleared all {} cached sounds.", sounds_.size());
-        sounds_.clear(); // unique_ptr处理删除
+        pcm_cache_.clear(); // unique_ptr处理删除
+        sounds_.clear();
     }
+    sound_paths_.clear();
+    sound_stats_.resident_bytes_ = 0;
+    pcm_stats_.resident_bytes_ = 0;
 }
 
 // --- 音乐管理 ---
@@ -108,6 +148,7 @@ Mix_Music* AudioManager::loadMusic(entt::id_type id, std::string_view file_path)
     // 首先检查缓存
     auto it = music_.find(id);
     if (it != music_.end()) {
+        it->second.last_used_frame_ = current_frame_;
         return it->second.get();
     }
 
@@ -119,28 +160,44 @@ Mix_Music* AudioManager::loadMusic(entt::id_type id, std::string_view file_path)
         return nullptr;
     }
 
-    // 使用unique_ptr存储在缓存中
-    music_.emplace(id, std::unique_ptr<Mix_Music, SDLMixMusicDeleter>(raw_music));
     spdlog::debug("successfully loaded and cached music: {}", file_path);
-    return raw_music;
+    return cacheMusic(id, raw_music, file_path);
 }
 
 Mix_Music* AudioManager::loadMusic(entt::hashed_string str_hs) {
     return loadMusic(str_hs.value(), str_hs.data());
 }
 
+Mix_Music* AudioManager::addMusic(entt::id_type id, Mix_Music* music, std::string_view file_path) {
+    std::unique_ptr<Mix_Music, SDLMixMusicDeleter> owned(music);
+    auto it = music_.find(id);
+    if (it != music_.end()) {
+        return it->second.get();        // 已存在，传入的音乐随 owned 释放
+    }
+    if (!owned) {
+        spdlog::error("cache music failed: '{}', {}, music is null.", file_path, id);
+        return nullptr;
+    }
+    spdlog::debug("successfully cached preloaded music: '{}', {}", file_path, id);
+    return cacheMusic(id, owned.release(), file_path);
+}
+
 Mix_Music* AudioManager::getMusic(entt::id_type id, std::string_view file_path) {
     auto it = music_.find(id);
     if (it != music_.end()) {
+        it->second.last_used_frame_ = current_frame_;
         return it->second.get();
     }
-    // 如果未找到，判断是否提供了file_path
+    // 如果未找到，判断是否提供了file_path (未提供时使用之前加载时记录的路径，音乐可能已被淘汰)
+    if (file_path.empty()) {
+        if (auto path_it = music_paths_.find(id); path_it != music_paths_.end()) file_path = path_it->second;
+    }
     if (file_path.empty()) {
         spdlog::error("music '{}' not found in cache, and no file path provided. Returning nullptr.", id);
         return nullptr;
     }
 
-    spdlog::warn("music '{}' not found in cache, trying to load it.", id);
+    spdlog::warn("music '{}', {} not found in cache, trying to load it.", file_path, id);
     return loadMusic(id, file_path);
 }
 
@@ -152,6 +209,7 @@ void AudioManager::unloadMusic(entt::id_type id) {
     auto it = music_.find(id);
     if (it != music_.end()) {
         spdlog::debug("unloading music: {}", id);
+        music_stats_.remove(it->second.bytes_);
         music_.erase(it); // unique_ptr处理Mix_FreeMusic
     } else {
         spdlog::warn("attempt to unload non-existent music: {}", id);
@@ -163,6 +221,8 @@ void AudioManager::clearMusic() {
         spdlog::debug("successfully cleared all {} cached music tracks.", music_.size());
         music_.clear(); // unique_ptr处理删除
     }
+    music_paths_.clear();
+    music_stats_.resident_bytes_ = 0;
 }
 
 void AudioManager::clearAudio()
@@ -171,4 +231,151 @@ void AudioManager::clearAudio()
     clearMusic();
 }
 
+// --- 驻留管理 ---
+bool AudioManager::addSoundRef(entt::id_type id) {
+    auto it = sounds_.find(id);
+    if (it == sounds_.end()) return false;
+    ++it->second.ref_count_;
+    return true;
+}
+
+void AudioManager::releaseSoundRef(entt::id_type id) {
+    auto it = sounds_.find(id);
+    if (it != sounds_.end() && it->second.ref_count_ > 0) {
+        --it->second.ref_count_;
+    }
+}
+
+bool AudioManager::addMusicRef(entt::id_type id) {
+    auto it = music_.find(id);
+    if (it == music_.end()) return false;
+    ++it->second.ref_count_;
+    return true;
+}
+
+void AudioManager::releaseMusicRef(entt::id_type id) {
+    auto it = music_.find(id);
+    if (it != music_.end() && it->second.ref_count_ > 0) {
+        --it->second.ref_count_;
+    }
+}
+
+void AudioManager::setSoundBudget(size_t bytes) {
+    sound_stats_.budget_bytes_ = bytes;
+    evict();
+}
+
+void AudioManager::setMusicBudget(size_t bytes) {
+    music_stats_.budget_bytes_ = bytes;
+    evict();
+}
+
+void AudioManager::setPcmCacheBudget(size_t bytes) {
+    pcm_stats_.budget_bytes_ = bytes;
+    evictPcm();
+}
+
+size_t AudioManager::evict() {
+    // 正在播放的音乐由 AudioPlayer 持有引用，不会被淘汰
+    auto evicted = evictLeastRecentlyUsed(sounds_, sound_stats_, current_frame_);
+    // 压缩数据已被淘汰的音效，其PCM也一并释放 (正在播放的除外)
+    if (!pcm_cache_.empty()) {
+        markPlayingPcm();
+        evicted += std::erase_if(pcm_cache_, [this](const auto& item) {
+            if (sounds_.contains(item.first) || item.second.last_used_frame_ >= current_frame_) return false;
+            pcm_stats_.remove(item.second.bytes_);
+            return true;
+        });
+    }
+    evicted += evictPcm();
+    evicted += evictLeastRecentlyUsed(music_, music_stats_, current_frame_);
+    if (evicted > 0) {
+        spdlog::debug("evicted {} audio resource(s), sound {} bytes, music {} bytes.", evicted,
+                      sound_stats_.resident_bytes_, music_stats_.resident_bytes_);
+    }
+    return evicted;
+}
+
+bool AudioManager::cacheSound(entt::id_type id, std::vector<uint8_t> data) {
+    SoundEntry entry;
+    entry.bytes_ = data.size();     // 压缩数据的字节数
+    entry.resource_ = std::make_unique<EncodedSound>(EncodedSound{std::move(data)});
+    entry.last_used_frame_ = current_frame_;
+    sound_stats_.add(entry.bytes_);
+    sounds_.emplace(id, std::move(entry));
+    evict();
+    return true;
+}
+
+Mix_Chunk* AudioManager::decodeSound(entt::id_type id, const SoundEntry& entry) {
+    const auto& data = entry.get()->data_;
+    SDL_IOStream* stream = SDL_IOFromConstMem(data.data(), data.size());
+    if (!stream) {
+        spdlog::error("decode sound failed: {}, {}", id, SDL_GetError());
+        return nullptr;
+    }
+    // Mix_LoadWAV_IO 会把整个音效解码并转换为设备格式的PCM (closeio = true，由其关闭流)
+    Mix_Chunk* raw_chunk = Mix_LoadWAV_IO(stream, true);
+    if (!raw_chunk) {
+        spdlog::error("decode sound failed: {}, {}", id, SDL_GetError());
+        return nullptr;
+    }
+
+    PcmEntry pcm;
+    pcm.resource_.reset(raw_chunk);
+    pcm.bytes_ = raw_chunk->alen;   // 解码后的PCM字节数
+    pcm_stats_.add(pcm.bytes_);
+    auto [it, inserted] = pcm_cache_.emplace(id, std::move(pcm));
+    touchPcm(it->second);
+    spdlog::debug("decoded sound {}: {} bytes compressed -> {} bytes PCM.", id, data.size(), raw_chunk->alen);
+    evictPcm();
+    return raw_chunk;
+}
+
+void AudioManager::touchPcm(PcmEntry& entry) {
+    entry.last_used_frame_ = current_frame_;
+    ++entry.use_count_;
+    // 短且常用的音效固定下来，保证其触发时无需解码
+    if (!entry.pinned_ && entry.bytes_ <= PIN_MAX_BYTES && entry.use_count_ >= PIN_MIN_USES) {
+        entry.pinned_ = true;
+        ++entry.ref_count_;
+    }
+}
+
+size_t AudioManager::evictPcm() {
+    if (pcm_stats_.budget_bytes_ == 0 || pcm_stats_.resident_bytes_ <= pcm_stats_.budget_bytes_) return 0;
+    markPlayingPcm();
+    return evictLeastRecentlyUsed(pcm_cache_, pcm_stats_, current_frame_);
+}
+
+void AudioManager::markPlayingPcm() {
+    // 释放正在播放的 Mix_Chunk 会中断播放，先把它们视为本帧使用过
+    const int channel_count = Mix_AllocateChannels(-1);
+    for (int channel = 0; channel < channel_count; ++channel) {
+        if (!Mix_Playing(channel)) continue;
+        Mix_Chunk* chunk = Mix_GetChunk(channel);
+        for (auto& [id, entry] : pcm_cache_) {
+            if (entry.get() == chunk) {
+                entry.last_used_frame_ = current_frame_;
+                break;
+            }
+        }
+    }
+}
+
+Mix_Music* AudioManager::cacheMusic(entt::id_type id, Mix_Music* raw_music, std::string_view file_path) {
+    MusicEntry entry;
+    entry.resource_.reset(raw_music);
+    // 音乐是流式解码的，无法得知解码器内部占用，按文件大小估算
+    std::error_code ec;
+    auto file_size = std::filesystem::file_size(std::filesystem::path(file_path), ec);
+    entry.bytes_ = ec ? 0 : static_cast<size_t>(file_size);
+    entry.last_used_frame_ = current_frame_;
+    music_paths_.try_emplace(id, file_path);
+    music_stats_.add(entry.bytes_);
+    music_.emplace(id, std::move(entry));
+    evict();
+    return raw_music;
+}
+
 } // namespace engine::resource
@@ -2,9 +2,13 @@
 
 #include <memory>
 #include <unordered_map>
+#include <string>
 #include <string_view>
+#include <vector>
+#include <cstdint>
 #include <entt/core/fwd.hpp>
 #include <SDL3_mixer/SDL_mixer.h> // SDL_mixer 主头文件
+#include "resource_residency.h"
 
 namespace engine::resource {
 
@@ -12,6 +16,8 @@ namespace engine::resource {
  * @brief 管理 SDL_mixer 音效 (Mix_Chunk) 和音乐 (Mix_Music)。
  *
  * 提供音频资源的加载和缓存功能。构造失败时会抛出异常。
+ * 音效以原始(压缩)文件数据常驻内存，首次播放时才解码为PCM并放入有容量上限的LRU缓存；
+ * 体积小且频繁播放的音效会被固定在缓存中，避免反复解码。
  * 仅供 ResourceManager 内部使用。
  * 
  * 外观模式，为一组复杂的子系统接口提供一个更高级别的、统一的接口。
@@ -38,10 +44,37 @@ private:
         }
     };
 
-    // 音效存储 (文件路径 -> Mix_Chunk)
-    std::unordered_map<entt::id_type, std::unique_ptr<Mix_Chunk, SDLMixChunkDeleter>> sounds_;
+    /// @brief 音效文件的原始数据 (ogg/mp3 等保持压缩状态)
+    struct EncodedSound {
+        std::vector<uint8_t> data_;
+    };
+
+    /// @brief 解码后的PCM缓存条目
+    struct PcmEntry : ResidentEntry<Mix_Chunk, SDLMixChunkDeleter> {
+        uint32_t use_count_{0};         ///< @brief 累计播放次数
+        bool pinned_{false};            ///< @brief 是否已固定 (固定时持有一个引用，不会被淘汰)
+    };
+
+    using SoundEntry = ResidentEntry<EncodedSound, std::default_delete<EncodedSound>>;
+    using MusicEntry = ResidentEntry<Mix_Music, SDLMixMusicDeleter>;
+
+    static constexpr size_t PIN_MAX_BYTES = 256 * 1024;     ///< @brief PCM不超过该大小的音效视为短音效 (约1.5秒的44.1kHz立体声)
+    static constexpr uint32_t PIN_MIN_USES = 3;             ///< @brief 短音效播放达到该次数后固定在PCM缓存中
+
+    // 音效存储 (文件路径 -> 压缩数据)
+    std::unordered_map<entt::id_type, SoundEntry> sounds_;
+    // 解码后的音效 (文件路径 -> Mix_Chunk)，按需解码、LRU淘汰
+    std::unordered_map<entt::id_type, PcmEntry> pcm_cache_;
     // 音乐存储 (文件路径 -> Mix_Music)
-    std::unordered_map<entt::id_type, std::unique_ptr<Mix_Music, SDLMixMusicDeleter>> music_;
+    std::unordered_map<entt::id_type, MusicEntry> music_;
+    // 加载过的音频文件路径，音频被淘汰后仅凭ID也能重新加载
+    std::unordered_map<entt::id_type, std::string> sound_paths_;
+    std::unordered_map<entt::id_type, std::string> music_paths_;
+
+    ResidencyStats sound_stats_;        ///< @brief 音效(压缩数据)驻留统计与预算
+    ResidencyStats pcm_stats_;          ///< @brief 音效PCM缓存统计与预算
+    ResidencyStats music_stats_;        ///< @brief 音乐驻留统计与预算
+    uint64_t current_frame_{0};         ///< @brief 当前帧号 (由 ResourceManager 每帧设置)
 
 public:
     /**
@@ -61,30 +94,37 @@ public:
 private:  // 仅供 ResourceManager 访问的方法
 
     /**
-     * @brief 从文件路径加载音效
+     * @brief 从文件路径加载音效（只读取压缩数据，不解码）
      * @param id 音效的唯一标识符, 通过entt::hashed_string生成
      * @param file_path 音效文件的路径
-     * @return 加载的音效的指针
-     * @note 如果音效已经加载，则返回已加载音效的指针
-     * @note 如果音效未加载，则从文件路径加载音效，并返回加载的音效的指针
+     * @return 加载成功(或已加载)返回 true
      */
-    Mix_Chunk* loadSound(entt::id_type id, std::string_view file_path);
+    bool loadSound(entt::id_type id, std::string_view file_path);
 
     /**
-     * @brief 从字符串哈希值加载音效
+     * @brief 从字符串哈希值加载音效（只读取压缩数据，不解码）
      * @param str_hs entt::hashed_string类型
-     * @return 加载的音效的指针
-     * @note 如果音效已经加载，则返回已加载音效的指针
-     * @note 如果音效未加载，则从哈希字符串对应的文件路径加载音效，并返回加载的音效的指针
+     * @return 加载成功(或已加载)返回 true
      */
-    Mix_Chunk* loadSound(entt::hashed_string str_hs);
+    bool loadSound(entt::hashed_string str_hs);
+
+    /**
+     * @brief 缓存一个已读取的音效文件数据（用于并行预加载）
+     * @param id 音效的唯一标识符, 通过entt::hashed_string生成
+     * @param data 音效文件的原始数据
+     * @param file_path 音效文件的路径（用于日志及淘汰后重新加载）
+     * @return 缓存成功(或已存在)返回 true
+     */
+    bool addSound(entt::id_type id, std::vector<uint8_t> data, std::string_view file_path);
 
     /**
      * @brief 从文件路径获取音效
      * @param id 音效的唯一标识符, 通过entt::hashed_string生成
-     * @return 加载的音效的指针
-     * @note 如果音效已经加载，则返回已加载音效的指针
-     * @note 如果音效未加载，则从哈希字符串对应的文件路径加载音效，并返回加载的音效的指针
+     * @param file_path 音效文件的路径 (为空时使用之前加载时记录的路径)
+     * @return 解码后的音效的指针
+     * @note 如果音效尚未解码，则从压缩数据解码并放入PCM缓存
+     * @note 如果音效未加载(或已被淘汰)，则从文件路径重新加载音效，并返回解码后的音效的指针
+     * @note 返回的指针在下一次淘汰前有效，播放中的音效不会被淘汰
      */
     Mix_Chunk* getSound(entt::id_type id, std::string_view file_path = "");
 
@@ -127,12 +167,23 @@ private:  // 仅供 ResourceManager 访问的方法
      */
     Mix_Music* loadMusic(entt::hashed_string str_hs);
 
+    /**
+     * @brief 缓存一个已打开的音乐（用于并行预加载）
+     * @param id 音乐的唯一标识符, 通过entt::hashed_string生成
+     * @param music 已打开的音乐，所有权转移给AudioManager
+     * @param file_path 音乐文件的路径（用于日志及淘汰后重新加载）
+     * @return 缓存中的音乐的指针
+     * @note 如果音乐已经加载，则释放传入的音乐，返回已加载音乐的指针
+     */
+    Mix_Music* addMusic(entt::id_type id, Mix_Music* music, std::string_view file_path);
+
     /**
      * @brief 从文件路径获取音乐
      * @param id 音乐的唯一标识符, 通过entt::hashed_string生成
+     * @param file_path 音乐文件的路径 (为空时使用之前加载时记录的路径)
      * @return 加载的音乐的指针
      * @note 如果音乐已经加载，则返回已加载音乐的指针
-     * @note 如果音乐未加载，则从哈希字符串对应的文件路径加载音乐，并返回加载的音乐的指针
+     * @note 如果音乐未加载(或已被淘汰)，则从文件路径重新加载音乐，并返回加载的音乐的指针
      */
     Mix_Music* getMusic(entt::id_type id, std::string_view file_path = "");
 
@@ -160,6 +211,30 @@ private:  // 仅供 ResourceManager 访问的方法
      * @brief 清空所有音频资源
      */
     void clearAudio();
+
+    // --- 驻留管理 ---
+    bool addSoundRef(entt::id_type id);                     ///< @brief 增加音效引用计数，音效不存在时返回false
+    void releaseSoundRef(entt::id_type id);                 ///< @brief 减少音效引用计数
+    bool addMusicRef(entt::id_type id);                     ///< @brief 增加音乐引用计数，音乐不存在时返回false
+    void releaseMusicRef(entt::id_type id);                 ///< @brief 减少音乐引用计数
+    void setSoundBudget(size_t bytes);                      ///< @brief 设置音效内存预算（0 表示不限制）
+    void setMusicBudget(size_t bytes);                      ///< @brief 设置音乐内存预算（0 表示不限制）
+    void setCurrentFrame(uint64_t frame) { current_frame_ = frame; }
+    size_t evict();                                         ///< @brief 按LRU淘汰超出预算的未引用音频，返回淘汰数量
+    void setPcmCacheBudget(size_t bytes);                   ///< @brief 设置音效PCM缓存预算（0 表示不限制）
+    [[nodiscard]] const ResidencyStats& getSoundStats() const { return sound_stats_; }
+    [[nodiscard]] const ResidencyStats& getPcmStats() const { return pcm_stats_; }
+    [[nodiscard]] size_t getPcmCount() const { return pcm_cache_.size(); }
+    [[nodiscard]] const ResidencyStats& getMusicStats() const { return music_stats_; }
+    [[nodiscard]] size_t getSoundCount() const { return sounds_.size(); }
+    [[nodiscard]] size_t getMusicCount() const { return music_.size(); }
+
+    bool cacheSound(entt::id_type id, std::vector<uint8_t> data);                           ///< @brief 缓存新音效的压缩数据并按预算淘汰
+    Mix_Chunk* decodeSound(entt::id_type id, const SoundEntry& entry);                      ///< @brief 将压缩数据解码为PCM并放入缓存
+    void touchPcm(PcmEntry& entry);                                                         ///< @brief 记录一次使用，短且常用的音效会被固定
+    size_t evictPcm();                                                                      ///< @brief 按LRU淘汰超出预算的PCM (跳过正在播放的)
+    void markPlayingPcm();                                                                  ///< @brief 把正在播放的PCM标记为本帧使用过，使其不会被淘汰
+    Mix_Music* cacheMusic(entt::id_type id, Mix_Music* raw_music, std::string_view file_path); ///< @brief 缓存新音乐并按预算淘汰
 };
 
 } // namespace engine::resource
@@ -1,10 +1,18 @@
 #include "font_manager.h"
+#include "../core/main_thread_queue.h"
 #include <spdlog/spdlog.h>
 #include <stdexcept>
+#include <filesystem>
 #include <entt/core/hashed_string.hpp>
 
 namespace engine::resource {
 
+void FontManager::SDLFontDeleter::operator()(TTF_Font* font) const {
+    if (font) {
+        engine::core::invokeOnMainThread(main_thread_queue_, [font] { TTF_CloseFont(font); });
+    }
+}
+
 FontManager::FontManager() {
     if (!TTF_WasInit() && !TTF_Init()) {
         throw std::runtime_error("FontManager build: TTF_Init failed: " + std::string(SDL_GetError()));
@@ -34,19 +42,31 @@ TTF_Font* FontManager::loadFont(entt::id_type id, int point_size, std::string_vi
     // 首先检查缓存
     auto it = fonts_.find(key);
     if (it != fonts_.end()) {
+        it->second.last_used_frame_ = current_frame_;
         return it->second.get();
     }
 
-    // 缓存中不存在，则加载字体
+    // 缓存中不存在，则加载字体 (SDL_GetError 是线程局部的，错误在执行的线程中输出)
     spdlog::debug("loading font '{}' ({}pt) ...", file_path, point_size);
-    TTF_Font* raw_font = TTF_OpenFont(file_path.data(), point_size);
-    if (!raw_font) {
-        spdlog::error("loading font '{}' ({}pt) failed: {}", file_path, point_size, SDL_GetError());
-        return nullptr;
-    }
-
-    // 使用 unique_ptr 存储到缓存中
-    fonts_.emplace(key, std::unique_ptr<TTF_Font, SDLFontDeleter>(raw_font));
+    TTF_Font* raw_font = engine::core::invokeOnMainThread(main_thread_queue_, [file_path, point_size] {
+        TTF_Font* font = TTF_OpenFont(file_path.data(), point_size);
+        if (!font) {
+            spdlog::error("loading font '{}' ({}pt) failed: {}", file_path, point_size, SDL_GetError());
+        }
+        return font;
+    });
+    if (!raw_font) return nullptr;
+
+    // 使用 unique_ptr 存储到缓存中 (字形缓存大小无法得知，按字体文件大小估算)
+    FontEntry entry;
+    entry.resource_ = std::unique_ptr<TTF_Font, SDLFontDeleter>(raw_font, SDLFontDeleter{main_thread_queue_});
+    std::error_code ec;
+    auto file_size = std::filesystem::file_size(std::filesystem::path(file_path), ec);
+    entry.bytes_ = ec ? 0 : static_cast<size_t>(file_size);
+    entry.last_used_frame_ = current_frame_;
+    stats_.add(entry.bytes_);
+    fonts_.emplace(key, std::move(entry));
+    evict();
     spdlog::debug("font '{}' (id = {}, {}pt) loaded and cached successfully.", file_path, id, point_size);
     return raw_font;
 }
@@ -59,6 +79,7 @@ TTF_Font* FontManager::getFont(entt::id_type id, int point_size, std::string_vie
     FontKey key = {id, point_size};
     auto it = fonts_.find(key);
     if (it != fonts_.end()) {
+        it->second.last_used_frame_ = current_frame_;
         return it->second.get();
     }
 
@@ -82,6 +103,7 @@ void FontManager::unloadFont(entt::id_type id, int point_size) {
     auto it = fonts_.find(key);
     if (it != fonts_.end()) {
         spdlog::debug("unloading font '{}' ({}pt) ...", id, point_size);
+        stats_.remove(it->second.bytes_);
         fonts_.erase(it);       // unique_ptr 会处理 TTF_CloseFont
     } else {
         spdlog::warn("font '{}' ({}pt) not found in cache, nothing to unload.", id, point_size);
@@ -93,6 +115,34 @@ void FontManager::clearFonts() {
         spdlog::debug("clearing all {} cached fonts ...", fonts_.size());
         fonts_.clear();         // unique_ptr 会处理删除
     }
+    stats_.resident_bytes_ = 0;
+}
+
+bool FontManager::addRef(entt::id_type id, int point_size) {
+    auto it = fonts_.find(FontKey{id, point_size});
+    if (it == fonts_.end()) return false;
+    ++it->second.ref_count_;
+    return true;
+}
+
+void FontManager::releaseRef(entt::id_type id, int point_size) {
+    auto it = fonts_.find(FontKey{id, point_size});
+    if (it != fonts_.end() && it->second.ref_count_ > 0) {
+        --it->second.ref_count_;
+    }
+}
+
+void FontManager::setBudget(size_t bytes) {
+    stats_.budget_bytes_ = bytes;
+    evict();
+}
+
+size_t FontManager::evict() {
+    auto evicted = evictLeastRecentlyUsed(fonts_, stats_, current_frame_);
+    if (evicted > 0) {
+        spdlog::debug("evicted {} font(s), resident {} bytes / budget {} bytes.", evicted, stats_.resident_bytes_, stats_.budget_bytes_);
+    }
+    return evicted;
 }
 
 } // namespace engine::resource
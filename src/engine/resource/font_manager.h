@@ -5,9 +5,12 @@
 #include <utility>
 #include <string_view>
 #include <entt/core/fwd.hpp>
-#include <SDL3_ttf/SDL_ttf.h>
-
 #include <SDL3_ttf/SDL_ttf.h> // SDL_ttf 主头文件
+#include "resource_residency.h"
+
+namespace engine::core {
+class MainThreadQueue;
+}
 
 namespace engine::resource {
 
@@ -33,6 +36,7 @@ struct FontKeyHash {
  *
  * 提供字体的加载和缓存功能，通过文件路径和点大小来标识。
  * 构造失败会抛出异常。仅供 ResourceManager 内部使用。
+ * 设置了主线程任务队列时，字体的打开与关闭总是转交到主线程执行。
  */
 class FontManager final{
     friend class ResourceManager;
@@ -40,17 +44,19 @@ class FontManager final{
 private:
     // TTF_Font 的自定义删除器
     struct SDLFontDeleter {
-        void operator()(TTF_Font* font) const {
-            if (font) {
-                TTF_CloseFont(font);
-            }
-        }
+        engine::core::MainThreadQueue* main_thread_queue_ = nullptr;   ///< @brief 非空时在主线程中关闭
+        void operator()(TTF_Font* font) const;
     };
 
     // 字体存储（FontKey -> TTF_Font）。  
     // unordered_map 的键需要能转换为哈希值，对于基础数据类型，系统会自动转换
     // 但是对于对于自定义类型（系统无法自动转化），则需要提供自定义哈希函数（第三个模版参数）
-    std::unordered_map<FontKey, std::unique_ptr<TTF_Font, SDLFontDeleter>, FontKeyHash> fonts_;
+    using FontEntry = ResidentEntry<TTF_Font, SDLFontDeleter>;
+    std::unordered_map<FontKey, FontEntry, FontKeyHash> fonts_;
+
+    ResidencyStats stats_;              ///< @brief 驻留统计与预算
+    uint64_t current_frame_{0};         ///< @brief 当前帧号 (由 ResourceManager 每帧设置)
+    engine::core::MainThreadQueue* main_thread_queue_ = nullptr;  ///< @brief 主线程任务队列 (可为空)，SDL_ttf 不是线程安全的
 
 public:
     /**
@@ -122,6 +128,16 @@ private: // 仅由 ResourceManager（和内部）访问的方法
      * @brief 清空所有缓存的字体
      */
     void clearFonts();                                             ///< @brief 清空所有缓存的字体
+
+    // --- 驻留管理 ---
+    bool addRef(entt::id_type id, int point_size);                  ///< @brief 增加引用计数，字体不存在时返回false
+    void releaseRef(entt::id_type id, int point_size);              ///< @brief 减少引用计数
+    void setBudget(size_t bytes);                                   ///< @brief 设置内存预算（0 表示不限制）
+    void setCurrentFrame(uint64_t frame) { current_frame_ = frame; }
+    void setMainThreadQueue(engine::core::MainThreadQueue* queue) { main_thread_queue_ = queue; }
+    size_t evict();                                                 ///< @brief 按LRU淘汰超出预算的未引用字体，返回淘汰数量
+    [[nodiscard]] const ResidencyStats& getStats() const { return stats_; }
+    [[nodiscard]] size_t getCount() const { return fonts_.size(); }
 };
 
 } // namespace engine::resource
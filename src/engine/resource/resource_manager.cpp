@@ -2,8 +2,12 @@
 #include "texture_manager.h"
 #include "audio_manager.h"
 #include "font_manager.h" 
+#include "resource_preloader.h"
+#include "resource_scope.h"
 #include <fstream>
 #include <filesystem>
+#include <algorithm>
+#include <utility>
 #include <SDL3_mixer/SDL_mixer.h>
 #include <SDL3_ttf/SDL_ttf.h> 
 #include <glm/glm.hpp>
@@ -20,19 +24,24 @@ ResourceManager::ResourceManager(SDL_Renderer* renderer) {
     texture_manager_ = std::make_unique<TextureManager>(renderer);
     audio_manager_ = std::make_unique<AudioManager>();
     font_manager_ = std::make_unique<FontManager>();
+    global_scope_ = std::make_unique<ResourceScope>("global");
 
     spdlog::trace("ResourceManager build successfully.");
     // RAII: 构造成功即代表资源管理器可以正常工作，无需再初始化，无需检查指针是否为空
 }
 
 void ResourceManager::clear() {
+    // 先等待后台加载结束，避免清空后又被注册进来
+    if (preloader_) preloader_->waitAll();
     font_manager_->clearFonts();
     audio_manager_->clearSounds();
     texture_manager_->clearTextures();
+    global_scope_->handles_.clear();
+    global_scope_->keys_.clear();
     spdlog::trace("ResourceManager clear successfully.");
 }
 
-void ResourceManager::loadResources(std::string_view file_path) {
+void ResourceManager::loadResources(std::string_view file_path, int thread_count) {
     std::filesystem::path path(file_path);
     if (!std::filesystem::exists(path)) {
         spdlog::warn("resource map file not found: {}", file_path);
@@ -41,57 +50,251 @@ void ResourceManager::loadResources(std::string_view file_path) {
 
     std::ifstream file(path);
     nlohmann::json json;
-    file >> json;
+    std::vector<PreloadRequest> requests;
     try {
+        file >> json;
         if (json.contains("sound")) {
             for (const auto& [key, value] : json["sound"].items()) {
-                loadSound(entt::hashed_string(key.c_str()), value.get<std::string>());
+                requests.push_back({entt::hashed_string(key.c_str()), ResourceType::SOUND, value.get<std::string>()});
             }
         }
         if (json.contains("music")) {
             for (const auto& [key, value] : json["music"].items()) {
-                loadMusic(entt::hashed_string(key.c_str()), value.get<std::string>());
+                requests.push_back({entt::hashed_string(key.c_str()), ResourceType::MUSIC, value.get<std::string>()});
             }
         }
         if (json.contains("texture")) {
             for (const auto& [key, value] : json["texture"].items()) {
-                loadTexture(entt::hashed_string(key.c_str()), value.get<std::string>());
+                requests.push_back({entt::hashed_string(key.c_str()), ResourceType::TEXTURE, value.get<std::string>()});
             }
         }
         if (json.contains("font")) {
+            // 字体格式: "name": {"path": "...", "size": 16}
             for (const auto& [key, value] : json["font"].items()) {
-                loadFont(entt::hashed_string(key.c_str()), value.get<int>(), value.get<std::string>());
+                requests.push_back({entt::hashed_string(key.c_str()), ResourceType::FONT,
+                                    value.at("path").get<std::string>(), value.value("size", 16)});
             }
-        }   
+        }
     } catch (const nlohmann::json::exception& e) {
         spdlog::error("load resource map file failed: {}", e.what());
+        return;
+    }
+
+    if (!preloader_) {
+        preloader_ = std::make_unique<ResourcePreloader>(thread_count, [this](const PreloadRequest& request, DecodedAsset& asset) {
+            return registerPreloaded(request, asset);
+        });
+    }
+    // 先提交耗时最长的纹理和音效，让工作线程尽早开始解码
+    std::stable_partition(requests.begin(), requests.end(), [](const PreloadRequest& request) {
+        return request.type_ == ResourceType::TEXTURE || request.type_ == ResourceType::SOUND;
+    });
+    for (auto& request : requests) {
+        preloader_->submit(std::move(request));
+    }
+    spdlog::info("resource map '{}' submitted: {} asset(s), {} pending.", file_path, requests.size(), preloader_->getPendingCount());
+}
+
+void ResourceManager::setMainThreadQueue(engine::core::MainThreadQueue* queue) {
+    texture_manager_->setMainThreadQueue(queue);
+    font_manager_->setMainThreadQueue(queue);
+}
+
+void ResourceManager::update() {
+    // 推进帧计数，本帧使用过的资源不会被淘汰
+    ++frame_;
+    texture_manager_->setCurrentFrame(frame_);
+    audio_manager_->setCurrentFrame(frame_);
+    font_manager_->setCurrentFrame(frame_);
+    if (preloader_) preloader_->update();
+}
+
+bool ResourceManager::waitForResource(entt::id_type id) {
+    return preloader_ && preloader_->wait(id);
+}
+
+void ResourceManager::waitForAllResources() {
+    if (preloader_) preloader_->waitAll();
+}
+
+std::shared_future<bool> ResourceManager::getResourceFuture(entt::id_type id) const {
+    return preloader_ ? preloader_->getFuture(id) : std::shared_future<bool>{};
+}
+
+bool ResourceManager::isPreloading() const {
+    return preloader_ && !preloader_->isIdle();
+}
+
+const std::vector<PreloadRecord>& ResourceManager::getPreloadRecords() const {
+    static const std::vector<PreloadRecord> empty_records;
+    return preloader_ ? preloader_->getRecords() : empty_records;
+}
+
+bool ResourceManager::registerPreloaded(const PreloadRequest& request, DecodedAsset& asset) {
+    bool success = false;
+    switch (request.type_) {
+        case ResourceType::TEXTURE:
+            // surface 仍由 asset 持有，纹理创建后随 asset 释放
+            success = texture_manager_->addTexture(request.id_, asset.surface_, request.path_) != nullptr;
+            break;
+        case ResourceType::SOUND:
+            success = audio_manager_->addSound(request.id_, std::move(asset.bytes_), request.path_);
+            break;
+        case ResourceType::MUSIC:
+            success = audio_manager_->addMusic(request.id_, std::exchange(asset.music_, nullptr), request.path_) != nullptr;
+            break;
+        case ResourceType::FONT:
+            success = font_manager_->loadFont(request.id_, request.point_size_, request.path_) != nullptr;
+            break;
+    }
+    // 映射文件中的资源只能通过映射名访问，由全局作用域持有，不参与淘汰
+    if (success && !global_scope_->contains(request.type_, request.id_, request.point_size_) &&
+        acquireResource(request.type_, request.id_, request.point_size_)) {
+        global_scope_->track(request.type_, request.id_, request.point_size_);
+    }
+    return success;
+}
+
+void ResourceManager::waitIfPreloading(entt::id_type id) {
+    if (preloader_ && preloader_->isPending(id)) {
+        preloader_->wait(id);
+    }
+}
+
+// --- 驻留管理 ---
+void ResourceManager::beginScope(ResourceScope& scope) {
+    scope_stack_.push_back(&scope);
+    spdlog::trace("begin recording resource scope '{}'.", scope.getName());
+}
+
+void ResourceManager::endScope() {
+    if (scope_stack_.empty()) {
+        spdlog::warn("endScope called without matching beginScope.");
+        return;
+    }
+    auto* scope = scope_stack_.back();
+    scope_stack_.pop_back();
+    spdlog::debug("resource scope '{}' holds {} resource(s).", scope->getName(), scope->size());
+}
+
+void ResourceManager::releaseScope(ResourceScope& scope) {
+    // 作用域仍在记录中时先将其出栈，避免悬垂指针
+    std::erase(scope_stack_, &scope);
+    for (const auto& handle : scope.handles_) {
+        releaseResource(handle.type_, handle.id_, handle.point_size_);
+    }
+    spdlog::debug("resource scope '{}' released {} resource(s).", scope.getName(), scope.size());
+    scope.handles_.clear();
+    scope.keys_.clear();
+
+    // 引用归还后，超出预算的部分立即淘汰
+    texture_manager_->evict();
+    audio_manager_->evict();
+    font_manager_->evict();
+}
+
+bool ResourceManager::acquireResource(ResourceType type, entt::id_type id, int point_size) {
+    switch (type) {
+        case ResourceType::TEXTURE: return texture_manager_->addRef(id);
+        case ResourceType::SOUND: return audio_manager_->addSoundRef(id);
+        case ResourceType::MUSIC: return audio_manager_->addMusicRef(id);
+        case ResourceType::FONT: return font_manager_->addRef(id, point_size);
+    }
+    return false;
+}
+
+void ResourceManager::releaseResource(ResourceType type, entt::id_type id, int point_size) {
+    switch (type) {
+        case ResourceType::TEXTURE: texture_manager_->releaseRef(id); break;
+        case ResourceType::SOUND: audio_manager_->releaseSoundRef(id); break;
+        case ResourceType::MUSIC: audio_manager_->releaseMusicRef(id); break;
+        case ResourceType::FONT: font_manager_->releaseRef(id, point_size); break;
+    }
+}
+
+void ResourceManager::setBudget(ResourceType type, size_t bytes) {
+    switch (type) {
+        case ResourceType::TEXTURE: texture_manager_->setBudget(bytes); break;
+        case ResourceType::SOUND: audio_manager_->setSoundBudget(bytes); break;
+        case ResourceType::MUSIC: audio_manager_->setMusicBudget(bytes); break;
+        case ResourceType::FONT: font_manager_->setBudget(bytes); break;
+    }
+}
+
+const ResidencyStats& ResourceManager::getResidencyStats(ResourceType type) const {
+    switch (type) {
+        case ResourceType::TEXTURE: return texture_manager_->getStats();
+        case ResourceType::SOUND: return audio_manager_->getSoundStats();
+        case ResourceType::MUSIC: return audio_manager_->getMusicStats();
+        case ResourceType::FONT: return font_manager_->getStats();
+    }
+    return texture_manager_->getStats();
+}
+
+size_t ResourceManager::getResidentCount(ResourceType type) const {
+    switch (type) {
+        case ResourceType::TEXTURE: return texture_manager_->getCount();
+        case ResourceType::SOUND: return audio_manager_->getSoundCount();
+        case ResourceType::MUSIC: return audio_manager_->getMusicCount();
+        case ResourceType::FONT: return font_manager_->getCount();
+    }
+    return 0;
+}
+
+void ResourceManager::setSoundCacheBudget(size_t bytes) {
+    audio_manager_->setPcmCacheBudget(bytes);
+}
+
+const ResidencyStats& ResourceManager::getSoundCacheStats() const {
+    return audio_manager_->getPcmStats();
+}
+
+size_t ResourceManager::getSoundCacheCount() const {
+    return audio_manager_->getPcmCount();
+}
+
+void ResourceManager::trackInScope(ResourceType type, entt::id_type id, int point_size) {
+    if (scope_stack_.empty()) return;
+    auto* scope = scope_stack_.back();
+    if (!scope->contains(type, id, point_size) && acquireResource(type, id, point_size)) {
+        scope->track(type, id, point_size);
     }
 }
 
 // --- 纹理接口实现 ---
 SDL_Texture* ResourceManager::loadTexture(entt::id_type id, std::string_view file_path) {
+    waitIfPreloading(id);
     // 构造函数已经确保了 texture_manager_ 不为空，因此不需要再进行if检查，以免性能浪费
-    return texture_manager_->loadTexture(id, file_path);
+    return tracked(texture_manager_->loadTexture(id, file_path), ResourceType::TEXTURE, id);
 }
 
 SDL_Texture* ResourceManager::loadTexture(entt::hashed_string str_hs) {
-    return texture_manager_->loadTexture(str_hs);
+    waitIfPreloading(str_hs.value());
+    return tracked(texture_manager_->loadTexture(str_hs), ResourceType::TEXTURE, str_hs.value());
 }
 
 SDL_Texture* ResourceManager::getTexture(entt::id_type id, std::string_view file_path) {
-    return texture_manager_->getTexture(id, file_path);
+    waitIfPreloading(id);
+    return tracked(texture_manager_->getTexture(id, file_path), ResourceType::TEXTURE, id);
 }
 
 SDL_Texture* ResourceManager::getTexture(entt::hashed_string str_hs) {
-    return texture_manager_->getTexture(str_hs);
+    waitIfPreloading(str_hs.value());
+    return tracked(texture_manager_->getTexture(str_hs), ResourceType::TEXTURE, str_hs.value());
 }
 
 glm::vec2 ResourceManager::getTextureSize(entt::id_type id, std::string_view file_path) {
-    return texture_manager_->getTextureSize(id, file_path);
+    waitIfPreloading(id);
+    auto size = texture_manager_->getTextureSize(id, file_path);
+    trackInScope(ResourceType::TEXTURE, id);
+    return size;
 }
 
 glm::vec2 ResourceManager::getTextureSize(entt::hashed_string str_hs) {
-    return texture_manager_->getTextureSize(str_hs);
+    waitIfPreloading(str_hs.value());
+    auto size = texture_manager_->getTextureSize(str_hs);
+    trackInScope(ResourceType::TEXTURE, str_hs.value());
+    return size;
 }
 
 void ResourceManager::unloadTexture(entt::id_type id) {
@@ -103,20 +306,28 @@ void ResourceManager::clearTextures() {
 }
 
 // --- 音频接口实现 ---
-Mix_Chunk* ResourceManager::loadSound(entt::id_type id, std::string_view file_path) {
-    return audio_manager_->loadSound(id, file_path);
+bool ResourceManager::loadSound(entt::id_type id, std::string_view file_path) {
+    waitIfPreloading(id);
+    if (!audio_manager_->loadSound(id, file_path)) return false;
+    trackInScope(ResourceType::SOUND, id);
+    return true;
 }
 
-Mix_Chunk* ResourceManager::loadSound(entt::hashed_string str_hs) {
-    return audio_manager_->loadSound(str_hs);
+bool ResourceManager::loadSound(entt::hashed_string str_hs) {
+    waitIfPreloading(str_hs.value());
+    if (!audio_manager_->loadSound(str_hs)) return false;
+    trackInScope(ResourceType::SOUND, str_hs.value());
+    return true;
 }
 
 Mix_Chunk* ResourceManager::getSound(entt::id_type id, std::string_view file_path) {
-    return audio_manager_->getSound(id, file_path);
+    waitIfPreloading(id);
+    return tracked(audio_manager_->getSound(id, file_path), ResourceType::SOUND, id);
 }
 
 Mix_Chunk* ResourceManager::getSound(entt::hashed_string str_hs) {
-    return audio_manager_->getSound(str_hs);
+    waitIfPreloading(str_hs.value());
+    return tracked(audio_manager_->getSound(str_hs), ResourceType::SOUND, str_hs.value());
 }
 
 void ResourceManager::unloadSound(entt::id_type id) {
@@ -128,19 +339,23 @@ void ResourceManager::clearSounds() {
 }
 
 Mix_Music* ResourceManager::loadMusic(entt::id_type id, std::string_view file_path) {
-    return audio_manager_->loadMusic(id, file_path);
+    waitIfPreloading(id);
+    return tracked(audio_manager_->loadMusic(id, file_path), ResourceType::MUSIC, id);
 }
 
 Mix_Music* ResourceManager::loadMusic(entt::hashed_string str_hs) {
-    return audio_manager_->loadMusic(str_hs);
+    waitIfPreloading(str_hs.value());
+    return tracked(audio_manager_->loadMusic(str_hs), ResourceType::MUSIC, str_hs.value());
 }
 
 Mix_Music* ResourceManager::getMusic(entt::id_type id, std::string_view file_path) {
-    return audio_manager_->getMusic(id, file_path);
+    waitIfPreloading(id);
+    return tracked(audio_manager_->getMusic(id, file_path), ResourceType::MUSIC, id);
 }
 
 Mix_Music* ResourceManager::getMusic(entt::hashed_string str_hs) {
-    return audio_manager_->getMusic(str_hs);
+    waitIfPreloading(str_hs.value());
+    return tracked(audio_manager_->getMusic(str_hs), ResourceType::MUSIC, str_hs.value());
 }
 
 void ResourceManager::unloadMusic(entt::id_type id) {
@@ -153,19 +368,19 @@ void ResourceManager::clearMusic() {
 
 // --- 字体接口实现 ---
 TTF_Font* ResourceManager::loadFont(entt::id_type id, int point_size, std::string_view file_path) {
-    return font_manager_->loadFont(id, point_size, file_path);
+    return tracked(font_manager_->loadFont(id, point_size, file_path), ResourceType::FONT, id, point_size);
 }
 
 TTF_Font* ResourceManager::loadFont(entt::hashed_string str_hs, int point_size) {
-    return font_manager_->loadFont(str_hs, point_size);
+    return tracked(font_manager_->loadFont(str_hs, point_size), ResourceType::FONT, str_hs.value(), point_size);
 }
 
 TTF_Font* ResourceManager::getFont(entt::id_type id, int point_size, std::string_view file_path) {
-    return font_manager_->getFont(id, point_size, file_path);
+    return tracked(font_manager_->getFont(id, point_size, file_path), ResourceType::FONT, id, point_size);
 }
 
 TTF_Font* ResourceManager::getFont(entt::hashed_string str_hs, int point_size) {
-    return font_manager_->getFont(str_hs, point_size);
+    return tracked(font_manager_->getFont(str_hs, point_size), ResourceType::FONT, str_hs.value(), point_size);
 }
 
 void ResourceManager::unloadFont(entt::id_type id, int point_size) {
@@ -2,9 +2,13 @@
 
 #include <memory> // 用于 std::unique_ptr
 #include <string_view> // 用于 std::string_view
+#include <future> // 用于 std::shared_future
+#include <vector>
+#include <cstdint>
 #include <glm/glm.hpp>
 #include <entt/core/fwd.hpp>
 #include <nlohmann/json_fwd.hpp>
+#include "resource_residency.h"
 
 // 前向声明 SDL 类型
 struct SDL_Renderer;
@@ -13,12 +17,21 @@ struct Mix_Chunk;
 struct Mix_Music;
 struct TTF_Font;
 
+namespace engine::core {
+class MainThreadQueue;
+}
+
 namespace engine::resource {
 
 // 前向声明内部管理器
 class TextureManager;
 class AudioManager;
 class FontManager;
+class ResourcePreloader;
+class ResourceScope;
+struct PreloadRequest;
+struct PreloadRecord;
+struct DecodedAsset;
 
 /**
  * @brief 作为访问各种资源管理器的中央控制点（外观模式 Facade）。
@@ -30,6 +43,11 @@ private:
     std::unique_ptr<TextureManager> texture_manager_;
     std::unique_ptr<AudioManager> audio_manager_;
     std::unique_ptr<FontManager> font_manager_;
+    std::unique_ptr<ResourcePreloader> preloader_;  ///< @brief 资源预加载器（最后声明，保证先于子管理器析构）
+
+    std::unique_ptr<ResourceScope> global_scope_;   ///< @brief 全局作用域，持有资源映射文件中的资源（它们只能通过映射名访问，淘汰后无法按路径重新加载）
+    std::vector<ResourceScope*> scope_stack_;       ///< @brief 正在记录的作用域栈，栈顶作用域记录新获取的资源
+    uint64_t frame_{0};                             ///< @brief 帧计数，用于LRU
 
 public:
     /**
@@ -42,14 +60,42 @@ public:
 
     void clear();        ///< @brief 清空所有资源
 
+    /// @brief 设置主线程任务队列，之后纹理与字体的创建/销毁都转交到主线程执行 (模拟线程与渲染分离时使用)
+    void setMainThreadQueue(engine::core::MainThreadQueue* queue);
+
     // 当前设计中，我们只需要一个ResourceManager，所有权不变，所以不需要拷贝、移动相关构造及赋值运算符
     ResourceManager(const ResourceManager&) = delete;
     ResourceManager& operator=(const ResourceManager&) = delete;
     ResourceManager(ResourceManager&&) = delete;
     ResourceManager& operator=(ResourceManager&&) = delete;
 
-    // 加载资源
-    void loadResources(std::string_view file_path);
+    /**
+     * @brief 按资源映射文件加载资源
+     * @param file_path 资源映射文件路径
+     * @param thread_count 预加载工作线程数。0 表示在当前线程串行加载（函数返回时全部加载完毕）；
+     *        大于0 时读取与解码在工作线程中并行执行，函数立即返回，由 update() 在主线程完成注册
+     */
+    void loadResources(std::string_view file_path, int thread_count = 0);
+
+    void update();                                                                  ///< @brief (主线程) 注册已在后台解码完成的资源，每帧调用
+    bool waitForResource(entt::id_type id);                                         ///< @brief (主线程) 阻塞等待指定的预加载资源就绪，返回是否加载成功
+    void waitForAllResources();                                                     ///< @brief (主线程) 阻塞等待所有预加载资源就绪
+    [[nodiscard]] std::shared_future<bool> getResourceFuture(entt::id_type id) const; ///< @brief 获取预加载资源的 future，非预加载资源返回无效 future
+    [[nodiscard]] bool isPreloading() const;                                        ///< @brief 是否还有预加载资源未完成
+    [[nodiscard]] const std::vector<PreloadRecord>& getPreloadRecords() const;      ///< @brief 获取每个资源的加载耗时记录
+
+    // --- 驻留管理 (作用域引用计数 + 预算内LRU淘汰) ---
+    void beginScope(ResourceScope& scope);                                          ///< @brief 开始记录作用域：之后获取的资源都会计入该作用域并被其持有
+    void endScope();                                                                ///< @brief 结束记录当前作用域（已持有的引用保持不变）
+    void releaseScope(ResourceScope& scope);                                        ///< @brief 归还作用域持有的所有引用，并按预算淘汰
+    bool acquireResource(ResourceType type, entt::id_type id, int point_size = 0);  ///< @brief 手动增加资源引用计数，资源未加载时返回false
+    void releaseResource(ResourceType type, entt::id_type id, int point_size = 0);  ///< @brief 手动减少资源引用计数
+    void setBudget(ResourceType type, size_t bytes);                                ///< @brief 设置某类资源的内存预算（0 表示不限制）
+    [[nodiscard]] const ResidencyStats& getResidencyStats(ResourceType type) const; ///< @brief 获取某类资源的驻留统计
+    [[nodiscard]] size_t getResidentCount(ResourceType type) const;                 ///< @brief 获取某类资源的驻留数量
+    void setSoundCacheBudget(size_t bytes);                                         ///< @brief 设置音效PCM解码缓存的预算（0 表示不限制）
+    [[nodiscard]] const ResidencyStats& getSoundCacheStats() const;                 ///< @brief 获取音效PCM解码缓存的统计
+    [[nodiscard]] size_t getSoundCacheCount() const;                                ///< @brief 获取已解码的音效数量
 
     // --- 统一资源访问接口 ---
     // -- Texture --
@@ -63,8 +109,8 @@ public:
     void clearTextures();                                                           ///< @brief 清空所有纹理资源
 
     // -- Sound Effects (Chunks) --
-    Mix_Chunk* loadSound(entt::id_type id, std::string_view file_path);             ///< @brief 载入音效资源(通过id + 文件路径)
-    Mix_Chunk* loadSound(entt::hashed_string str_hs);                               ///< @brief 载入音效资源(通过字符串哈希值)
+    bool loadSound(entt::id_type id, std::string_view file_path);                   ///< @brief 载入音效资源(通过id + 文件路径)，只读取压缩数据，首次播放时才解码
+    bool loadSound(entt::hashed_string str_hs);                                     ///< @brief 载入音效资源(通过字符串哈希值)，只读取压缩数据，首次播放时才解码
     Mix_Chunk* getSound(entt::id_type id, std::string_view file_path = "");         ///< @brief 尝试获取已加载音效的指针，如果未加载则尝试加载(通过id + 文件路径)
     Mix_Chunk* getSound(entt::hashed_string str_hs);                                ///< @brief 尝试获取已加载音效的指针，如果未加载则尝试加载(通过字符串哈希值)
     void unloadSound(entt::id_type id);                                             ///< @brief 卸载指定的音效资源
@@ -85,6 +131,18 @@ public:
     TTF_Font* getFont(entt::hashed_string str_hs, int point_size);                        ///< @brief 尝试获取已加载字体的指针，如果未加载则尝试加载(通过字符串哈希值)
     void unloadFont(entt::id_type id, int point_size);                              ///< @brief 卸载指定的字体资源
     void clearFonts();                                                              ///< @brief 清空所有字体资源 
+
+private:
+    bool registerPreloaded(const PreloadRequest& request, DecodedAsset& asset);     ///< @brief (主线程) 把解码结果转交给对应的子管理器
+    void waitIfPreloading(entt::id_type id);                                        ///< @brief 若资源正在预加载，则先等待其完成，避免重复加载
+    void trackInScope(ResourceType type, entt::id_type id, int point_size = 0);     ///< @brief 若正在记录作用域，则把资源计入栈顶作用域
+
+    /// @brief 获取资源后，若在记录作用域则计入 (资源为空时不记录)
+    template <typename T>
+    T* tracked(T* resource, ResourceType type, entt::id_type id, int point_size = 0) {
+        if (resource && !scope_stack_.empty()) trackInScope(type, id, point_size);
+        return resource;
+    }
 };
 
 } // namespace engine::resource
@@ -0,0 +1,275 @@
+#include "resource_preloader.h"
+#include <algorithm>
+#include <utility>
+#include <fstream>
+#include <filesystem>
+#include <iterator>
+#include <SDL3/SDL_surface.h>
+#include <SDL3_image/SDL_image.h>
+#include <SDL3_mixer/SDL_mixer.h>
+#include <spdlog/spdlog.h>
+
+namespace engine::resource {
+
+namespace {
+
+double elapsedMs(ResourcePreloader::Clock::time_point start, ResourcePreloader::Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+const char* toString(ResourceType type) {
+    switch (type) {
+        case ResourceType::SOUND: return "sound";
+        case ResourceType::MUSIC: return "music";
+        case ResourceType::TEXTURE: return "texture";
+        case ResourceType::FONT: return "font";
+    }
+    return "unknown";
+}
+
+} // namespace
+
+// --- DecodedAsset ---
+DecodedAsset::~DecodedAsset() {
+    release();
+}
+
+DecodedAsset::DecodedAsset(DecodedAsset&& other) noexcept
+    : surface_(std::exchange(other.surface_, nullptr)),
+      bytes_(std::move(other.bytes_)),
+      music_(std::exchange(other.music_, nullptr)),
+      error_(std::move(other.error_)),
+      decode_ms_(other.decode_ms_) {
+}
+
+DecodedAsset& DecodedAsset::operator=(DecodedAsset&& other) noexcept {
+    if (this != &other) {
+        release();
+        surface_ = std::exchange(other.surface_, nullptr);
+        bytes_ = std::move(other.bytes_);
+        music_ = std::exchange(other.music_, nullptr);
+        error_ = std::move(other.error_);
+        decode_ms_ = other.decode_ms_;
+    }
+    return *this;
+}
+
+void DecodedAsset::release() {
+    if (surface_) SDL_DestroySurface(surface_);
+    if (music_) Mix_FreeMusic(music_);
+    surface_ = nullptr;
+    music_ = nullptr;
+}
+
+// --- ResourcePreloader ---
+ResourcePreloader::ResourcePreloader(int thread_count, RegisterFunc register_func)
+    : register_func_(std::move(register_func)) {
+    workers_.reserve(static_cast<size_t>(std::max(thread_count, 0)));
+    for (int i = 0; i < thread_count; ++i) {
+        workers_.emplace_back(&ResourcePreloader::workerLoop, this);
+    }
+    spdlog::trace("ResourcePreloader build successfully, worker threads: {}", workers_.size());
+}
+
+ResourcePreloader::~ResourcePreloader() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+        jobs_.clear();          // 丢弃尚未开始的任务（对应的 future 会得到 broken_promise）
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) worker.join();
+    }
+    // 未注册的解码结果随 pending_ 一同析构，由 DecodedAsset 释放
+    spdlog::trace("ResourcePreloader destroyed, {} asset(s) discarded.", pending_.size());
+}
+
+std::shared_future<bool> ResourcePreloader::submit(PreloadRequest request) {
+    const auto id = request.id_;
+    // 重复提交时直接返回已有的 future
+    if (auto future = getFuture(id); future.valid()) {
+        return future;
+    }
+
+    auto now = Clock::now();
+    report_pending_ = true;
+
+    PendingAsset pending;
+    pending.request_ = request;
+    pending.ready_ = pending.promise_.get_future().share();
+    pending.submit_time_ = now;
+
+    // 解码任务只持有请求的拷贝，不访问预加载器的其他状态
+    std::packaged_task<DecodedAsset()> task([request = std::move(request)]() {
+        return decode(request);
+    });
+    pending.decoded_ = task.get_future();
+
+    if (workers_.empty()) {
+        task();         // 串行模式：在调用线程上立即解码
+    } else {
+        {
+            std::lock_guard lock(mutex_);
+            jobs_.push_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    auto ready = pending.ready_;
+    auto [it, inserted] = pending_.emplace(id, std::move(pending));
+    if (workers_.empty()) {
+        finish(it);     // 串行模式：立即注册
+    }
+    return ready;
+}
+
+void ResourcePreloader::update() {
+    for (auto it = pending_.begin(); it != pending_.end();) {
+        if (it->second.decoded_.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            auto next = std::next(it);
+            finish(it);
+            it = next;
+        } else {
+            ++it;
+        }
+    }
+
+    if (report_pending_ && pending_.empty()) {
+        report_pending_ = false;
+        logReport();
+    }
+}
+
+bool ResourcePreloader::wait(entt::id_type id) {
+    if (auto it = pending_.find(id); it != pending_.end()) {
+        it->second.decoded_.wait();
+        finish(it);
+    }
+    auto future = getFuture(id);
+    return future.valid() && future.get();
+}
+
+void ResourcePreloader::waitAll() {
+    while (!pending_.empty()) {
+        auto it = pending_.begin();
+        it->second.decoded_.wait();
+        finish(it);
+    }
+    update();           // 输出报告
+}
+
+std::shared_future<bool> ResourcePreloader::getFuture(entt::id_type id) const {
+    if (auto it = pending_.find(id); it != pending_.end()) {
+        return it->second.ready_;
+    }
+    if (auto it = finished_.find(id); it != finished_.end()) {
+        return it->second;
+    }
+    return {};
+}
+
+void ResourcePreloader::logReport() const {
+    if (records_.empty()) return;
+
+    auto sorted = records_;
+    std::sort(sorted.begin(), sorted.end(), [](const PreloadRecord& a, const PreloadRecord& b) {
+        return a.decode_ms_ + a.register_ms_ > b.decode_ms_ + b.register_ms_;
+    });
+
+    double total_decode_ms = 0.0;
+    double total_register_ms = 0.0;
+    size_t failed_count = 0;
+    for (const auto& record : sorted) {
+        total_decode_ms += record.decode_ms_;
+        total_register_ms += record.register_ms_;
+        if (!record.success_) ++failed_count;
+    }
+    double wall_ms = 0.0;
+    for (const auto& record : sorted) {
+        wall_ms = std::max(wall_ms, record.latency_ms_);
+    }
+
+    spdlog::info("resource preload report: {} asset(s), {} failed, {} worker(s), wall {:.2f} ms, decode sum {:.2f} ms, register sum {:.2f} ms",
+                 sorted.size(), failed_count, workers_.size(), wall_ms, total_decode_ms, total_register_ms);
+    for (const auto& record : sorted) {
+        spdlog::info("  [{:<7}] decode {:>8.2f} ms | register {:>7.2f} ms | latency {:>8.2f} ms | {}{}",
+                     toString(record.type_), record.decode_ms_, record.register_ms_, record.latency_ms_,
+                     record.path_, record.success_ ? "" : " (FAILED)");
+    }
+}
+
+DecodedAsset ResourcePreloader::decode(const PreloadRequest& request) {
+    DecodedAsset asset;
+    auto start = Clock::now();
+    switch (request.type_) {
+        case ResourceType::TEXTURE:
+            // 只解码为 SDL_Surface，纹理的创建必须在渲染器所属线程进行
+            asset.surface_ = IMG_Load(request.path_.c_str());
+            if (!asset.surface_) asset.error_ = SDL_GetError();
+            break;
+        case ResourceType::SOUND: {
+            // 音效只读取文件数据，保持压缩状态，首次播放时才解码
+            std::ifstream file(std::filesystem::path(request.path_), std::ios::binary);
+            if (file.is_open()) {
+                asset.bytes_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            }
+            if (asset.bytes_.empty()) asset.error_ = "can not read file or file is empty";
+            break;
+        }
+        case ResourceType::MUSIC:
+            // 音乐是流式解码的，这里只打开文件并解析头部
+            asset.music_ = Mix_LoadMUS(request.path_.c_str());
+            if (!asset.music_) asset.error_ = SDL_GetError();
+            break;
+        case ResourceType::FONT:
+            // SDL_ttf 共享同一个 FreeType 实例，不能跨线程打开字体，交由注册步骤在所属线程完成
+            break;
+    }
+    asset.decode_ms_ = elapsedMs(start, Clock::now());
+    return asset;
+}
+
+void ResourcePreloader::workerLoop() {
+    while (true) {
+        std::packaged_task<DecodedAsset()> task;
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+            if (stopping_) return;
+            task = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        task();
+    }
+}
+
+void ResourcePreloader::finish(std::unordered_map<entt::id_type, PendingAsset>::iterator it) {
+    auto& pending = it->second;
+    PreloadRecord record{pending.request_.id_, pending.request_.type_, pending.request_.path_};
+
+    bool success = false;
+    auto start = Clock::now();
+    try {
+        DecodedAsset asset = pending.decoded_.get();
+        record.decode_ms_ = asset.decode_ms_;
+        if (!asset.error_.empty()) {
+            spdlog::error("preload {} '{}' failed: {}", toString(record.type_), record.path_, asset.error_);
+        } else {
+            success = register_func_(pending.request_, asset);
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("preload {} '{}' failed: {}", toString(record.type_), record.path_, e.what());
+    }
+    auto end = Clock::now();
+    record.register_ms_ = elapsedMs(start, end);
+    record.latency_ms_ = elapsedMs(pending.submit_time_, end);
+    record.success_ = success;
+    records_.push_back(std::move(record));
+
+    pending.promise_.set_value(success);
+    finished_.emplace(it->first, pending.ready_);
+    pending_.erase(it);
+}
+
+} // namespace engine::resource
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <functional>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+#include <entt/core/fwd.hpp>
+#include "resource_residency.h"
+
+// 前向声明 SDL 类型
+struct SDL_Surface;
+struct Mix_Music;
+
+namespace engine::resource {
+
+/// @brief 预加载请求（由资源映射文件中的一项生成）
+struct PreloadRequest {
+    entt::id_type id_{};                                ///< @brief 资源ID
+    ResourceType type_{ResourceType::SOUND};    ///< @brief 资源类型
+    std::string path_;                                  ///< @brief 文件路径
+    int point_size_{0};                                 ///< @brief 字体字号 (仅字体使用)
+};
+
+/**
+ * @brief 工作线程的解码结果。
+ * @note 在被所属线程注册（转交给各个子管理器）之前，由它持有SDL对象的所有权；
+ *       若最终未被注册（例如加载中途退出），析构时会自动释放。
+ */
+struct DecodedAsset {
+    SDL_Surface* surface_{nullptr};     ///< @brief 解码后的图像 (纹理)
+    std::vector<uint8_t> bytes_;        ///< @brief 音效文件的原始数据 (音效保持压缩状态，播放时才解码)
+    Mix_Music* music_{nullptr};         ///< @brief 打开的音乐流
+    std::string error_;                 ///< @brief 解码失败时的错误信息 (SDL_GetError 是线程局部的，需在工作线程中取出)
+    double decode_ms_{};                ///< @brief 读取+解码耗时 (毫秒)
+
+    DecodedAsset() = default;
+    ~DecodedAsset();
+
+    // 只允许移动（future::get 需要移动语义）
+    DecodedAsset(const DecodedAsset&) = delete;
+    DecodedAsset& operator=(const DecodedAsset&) = delete;
+    DecodedAsset(DecodedAsset&& other) noexcept;
+    DecodedAsset& operator=(DecodedAsset&& other) noexcept;
+
+private:
+    void release();
+};
+
+/// @brief 单个资源的加载耗时记录
+struct PreloadRecord {
+    entt::id_type id_{};
+    ResourceType type_{ResourceType::SOUND};
+    std::string path_;
+    double decode_ms_{};        ///< @brief 工作线程上读取+解码耗时
+    double register_ms_{};      ///< @brief 所属线程上创建纹理/注册音频的耗时
+    double latency_ms_{};       ///< @brief 从提交到完成注册的总时长 (包含排队等待)
+    bool success_{false};
+};
+
+/**
+ * @brief 资源预加载器，由 ResourceManager 内部持有。
+ *
+ * 文件读取与解码在工作线程池中并行执行，而 SDL_Texture 的创建以及向混音器/管理器的注册
+ * 只在所属线程（主线程）上完成。每个资源对应一个 std::shared_future<bool>，
+ * 场景可以据此等待特定资源就绪。
+ * 工作线程数为0时退化为串行模式：解码与注册都在提交时于调用线程上立即完成。
+ */
+class ResourcePreloader final {
+public:
+    using RegisterFunc = std::function<bool(const PreloadRequest&, DecodedAsset&)>;
+    using Clock = std::chrono::steady_clock;
+
+private:
+    /// @brief 尚未在所属线程上注册的资源
+    struct PendingAsset {
+        PreloadRequest request_;
+        std::future<DecodedAsset> decoded_;     ///< @brief 工作线程的解码结果
+        std::promise<bool> promise_;            ///< @brief 注册完成后兑现
+        std::shared_future<bool> ready_;        ///< @brief 对外提供的等待句柄
+        Clock::time_point submit_time_;
+    };
+
+    RegisterFunc register_func_;
+
+    // --- 工作线程池 (受 mutex_ 保护) ---
+    std::vector<std::thread> workers_;
+    std::deque<std::packaged_task<DecodedAsset()>> jobs_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_{false};
+
+    // --- 仅所属线程访问 ---
+    std::unordered_map<entt::id_type, PendingAsset> pending_;                   ///< @brief 等待注册的资源
+    std::unordered_map<entt::id_type, std::shared_future<bool>> finished_;      ///< @brief 已完成的资源 (保留以便后续等待)
+    std::vector<PreloadRecord> records_;                                        ///< @brief 耗时记录
+    bool report_pending_{false};                                                ///< @brief 本批次完成后是否需要输出报告
+
+public:
+    /**
+     * @brief 构造函数
+     * @param thread_count 工作线程数，0 表示串行模式
+     * @param register_func 注册函数（在所属线程中调用，负责创建纹理并转交给各个子管理器）
+     */
+    ResourcePreloader(int thread_count, RegisterFunc register_func);
+    ~ResourcePreloader();
+
+    // 禁止拷贝和移动
+    ResourcePreloader(const ResourcePreloader&) = delete;
+    ResourcePreloader& operator=(const ResourcePreloader&) = delete;
+    ResourcePreloader(ResourcePreloader&&) = delete;
+    ResourcePreloader& operator=(ResourcePreloader&&) = delete;
+
+    /**
+     * @brief 提交一个预加载请求
+     * @return 资源就绪的 future（值为是否加载成功）。重复提交同一ID时返回已有的 future
+     */
+    std::shared_future<bool> submit(PreloadRequest request);
+
+    void update();                                              ///< @brief (所属线程) 注册所有已解码完成的资源，每帧调用
+    bool wait(entt::id_type id);                                ///< @brief (所属线程) 阻塞等待指定资源，只注册该资源。返回是否加载成功
+    void waitAll();                                             ///< @brief (所属线程) 阻塞等待所有资源完成
+
+    [[nodiscard]] bool isPending(entt::id_type id) const { return !pending_.empty() && pending_.contains(id); }
+    [[nodiscard]] bool isIdle() const { return pending_.empty(); }
+    [[nodiscard]] size_t getPendingCount() const { return pending_.size(); }
+    [[nodiscard]] std::shared_future<bool> getFuture(entt::id_type id) const;  ///< @brief 获取资源的 future，未知ID返回无效 future
+    [[nodiscard]] const std::vector<PreloadRecord>& getRecords() const { return records_; }
+
+    void logReport() const;                                     ///< @brief 输出加载耗时报告（按解码+注册总耗时降序）
+
+private:
+    static DecodedAsset decode(const PreloadRequest& request);   ///< @brief (工作线程) 读取并解码文件，不得访问渲染器/管理器
+    void workerLoop();
+    void finish(std::unordered_map<entt::id_type, PendingAsset>::iterator it);
+};
+
+} // namespace engine::resource
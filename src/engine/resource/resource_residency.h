@@ -0,0 +1,83 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::resource {
+
+/// @brief 资源类型
+enum class ResourceType {
+    TEXTURE,
+    SOUND,
+    MUSIC,
+    FONT,
+};
+
+/**
+ * @brief 常驻资源条目，在资源本身之外记录驻留信息。
+ * @tparam T SDL资源类型
+ * @tparam Deleter 对应的自定义删除器
+ */
+template <typename T, typename Deleter>
+struct ResidentEntry {
+    std::unique_ptr<T, Deleter> resource_;      ///< @brief 资源本身
+    size_t bytes_{0};                           ///< @brief 估算的内存占用 (字节)
+    int ref_count_{0};                          ///< @brief 引用计数，大于0时表示被某个作用域持有，不会被淘汰
+    uint64_t last_used_frame_{0};               ///< @brief 最近一次被使用的帧号 (用于LRU淘汰)
+
+    T* get() const { return resource_.get(); }
+};
+
+/// @brief 某类资源的驻留统计与预算
+struct ResidencyStats {
+    size_t resident_bytes_{0};      ///< @brief 当前驻留字节数
+    size_t budget_bytes_{0};        ///< @brief 内存预算，0 表示不限制
+    size_t peak_bytes_{0};          ///< @brief 驻留字节数峰值
+    size_t evicted_count_{0};       ///< @brief 累计淘汰数量
+
+    void add(size_t bytes) {
+        resident_bytes_ += bytes;
+        peak_bytes_ = std::max(peak_bytes_, resident_bytes_);
+    }
+    void remove(size_t bytes) {
+        resident_bytes_ -= std::min(resident_bytes_, bytes);
+    }
+};
+
+/**
+ * @brief 当驻留字节数超出预算时，按最近最少使用(LRU)的顺序淘汰未被引用的条目。
+ * @note 当前帧使用过的条目不会被淘汰（渲染器可能仍持有本帧取得的指针）。
+ * @return 淘汰的条目数量
+ */
+template <typename Key, typename Entry, typename Hash>
+size_t evictLeastRecentlyUsed(std::unordered_map<Key, Entry, Hash>& entries, ResidencyStats& stats, uint64_t current_frame) {
+    if (stats.budget_bytes_ == 0 || stats.resident_bytes_ <= stats.budget_bytes_) return 0;
+
+    // 收集可淘汰的候选者并按最近使用帧号升序排列 (超预算是少见情况，这里的排序开销可以接受)
+    using Iterator = typename std::unordered_map<Key, Entry, Hash>::iterator;
+    std::vector<Iterator> candidates;
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (it->second.ref_count_ <= 0 && it->second.last_used_frame_ < current_frame) {
+            candidates.push_back(it);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const Iterator& a, const Iterator& b) {
+        return a->second.last_used_frame_ < b->second.last_used_frame_;
+    });
+
+    size_t evicted = 0;
+    for (auto it : candidates) {
+        if (stats.resident_bytes_ <= stats.budget_bytes_) break;
+        stats.remove(it->second.bytes_);
+        entries.erase(it);      // 删除器负责释放SDL资源
+        ++evicted;
+    }
+    stats.evicted_count_ += evicted;
+    return evicted;
+}
+
+} // namespace engine::resource
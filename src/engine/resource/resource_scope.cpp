@@ -0,0 +1,15 @@
+#include "resource_scope.h"
+#include "resource_manager.h"
+
+namespace engine::resource {
+
+ResourceScopeRecorder::ResourceScopeRecorder(ResourceManager& resource_manager, ResourceScope& scope)
+    : resource_manager_(resource_manager) {
+    resource_manager_.beginScope(scope);
+}
+
+ResourceScopeRecorder::~ResourceScopeRecorder() {
+    resource_manager_.endScope();
+}
+
+} // namespace engine::resource
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "resource_residency.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_set>
+#include <entt/core/fwd.hpp>
+
+namespace engine::resource {
+
+class ResourceManager;
+
+/**
+ * @brief 资源作用域，持有一组资源的引用计数。
+ *
+ * 在 ResourceManager::beginScope / endScope 之间获取（加载或命中缓存）的资源都会被记录到作用域中，
+ * 作用域存在期间这些资源不会被LRU淘汰；调用 ResourceManager::releaseScope 后引用归还，
+ * 超出预算时即可被淘汰。典型用法：场景在 init() 中记录本关卡用到的资源，在 clean() 中释放。
+ */
+class ResourceScope final {
+    friend class ResourceManager;
+
+    /// @brief 作用域持有的一个资源引用
+    struct Handle {
+        ResourceType type_{ResourceType::TEXTURE};
+        entt::id_type id_{};
+        int point_size_{0};             ///< @brief 字号 (仅字体使用)
+    };
+
+    std::string name_;                          ///< @brief 作用域名称 (用于日志)
+    std::vector<Handle> handles_;               ///< @brief 已持有的引用
+    std::unordered_set<uint64_t> keys_;         ///< @brief 去重用的键
+
+public:
+    explicit ResourceScope(std::string_view name) : name_(name) {}
+
+    // 引用由 ResourceManager 归还，禁止拷贝和移动以免重复释放
+    ResourceScope(const ResourceScope&) = delete;
+    ResourceScope& operator=(const ResourceScope&) = delete;
+    ResourceScope(ResourceScope&&) = delete;
+    ResourceScope& operator=(ResourceScope&&) = delete;
+
+    [[nodiscard]] const std::string& getName() const { return name_; }
+    [[nodiscard]] size_t size() const { return handles_.size(); }
+    [[nodiscard]] bool empty() const { return handles_.empty(); }
+
+private:
+    static uint64_t makeKey(ResourceType type, entt::id_type id, int point_size) {
+        return (static_cast<uint64_t>(type) << 56) ^ (static_cast<uint64_t>(point_size) << 32) ^ static_cast<uint64_t>(id);
+    }
+
+    /// @brief 资源是否已在作用域中（同一资源在一个作用域中只计一次引用）
+    bool contains(ResourceType type, entt::id_type id, int point_size = 0) const {
+        return keys_.contains(makeKey(type, id, point_size));
+    }
+
+    /// @brief 记录一个已增加引用计数的资源
+    void track(ResourceType type, entt::id_type id, int point_size = 0) {
+        if (keys_.insert(makeKey(type, id, point_size)).second) {
+            handles_.push_back({type, id, point_size});
+        }
+    }
+};
+
+/**
+ * @brief RAII 辅助类，构造时开始记录作用域，析构时结束记录。
+ * @note 保证初始化流程中途返回时也能正确结束记录。
+ */
+class ResourceScopeRecorder final {
+    ResourceManager& resource_manager_;
+
+public:
+    ResourceScopeRecorder(ResourceManager& resource_manager, ResourceScope& scope);
+    ~ResourceScopeRecorder();
+
+    ResourceScopeRecorder(const ResourceScopeRecorder&) = delete;
+    ResourceScopeRecorder& operator=(const ResourceScopeRecorder&) = delete;
+    ResourceScopeRecorder(ResourceScopeRecorder&&) = delete;
+    ResourceScopeRecorder& operator=(ResourceScopeRecorder&&) = delete;
+};
+
+} // namespace engine::resource
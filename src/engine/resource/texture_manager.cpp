@@ -1,10 +1,18 @@
 #include "texture_manager.h"
+#include "../core/main_thread_queue.h"
 #include <SDL3_image/SDL_image.h> // 用于 IMG_LoadTexture, IMG_Init, IMG_Quit
 #include <spdlog/spdlog.h>
 #include <stdexcept>
     #include <entt/core/hashed_string.hpp>
 
 namespace engine::resource {
+
+void TextureManager::SDLTextureDeleter::operator()(SDL_Texture* texture) const {
+    if (texture) {
+        engine::core::invokeOnMainThread(main_thread_queue_, [texture] { SDL_DestroyTexture(texture); });
+    }
+}
+
 TextureManager::TextureManager(SDL_Renderer* renderer) : renderer_(renderer) {
     if (!renderer_) {
         // 关键错误，无法继续，抛出异常 （它将由catch语句捕获（位于GameApp），并进行处理）
@@ -18,37 +26,69 @@ SDL_Texture* TextureManager::loadTexture(entt::id_type id, std::string_view file
     // 检查是否已加载
     auto it = textures_.find(id);
     if (it != textures_.end()) {
+        it->second.last_used_frame_ = current_frame_;
         return it->second.get();
     }
 
-    // 如果没加载则尝试加载纹理
-    SDL_Texture* raw_texture = IMG_LoadTexture(renderer_, file_path.data());
-
-    // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
-    if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
-        spdlog::warn("cannot set texture scale mode to nearest interpolation.");
-    }
+    // 如果没加载则尝试加载纹理 (纹理只能由主线程创建)
+    SDL_Texture* raw_texture = engine::core::invokeOnMainThread(main_thread_queue_, [this, file_path]() -> SDL_Texture* {
+        SDL_Texture* texture = IMG_LoadTexture(renderer_, file_path.data());
+        if (!texture) {
+            spdlog::error("failed to load texture '{}': {}", file_path, SDL_GetError());
+            return nullptr;
+        }
+        // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
+        if (!SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST)) {
+            spdlog::warn("cannot set texture scale mode to nearest interpolation.");
+        }
+        return texture;
+    });
+    if (!raw_texture) return nullptr;
 
-    if (!raw_texture) {
-        spdlog::error("failed to load texture '{}': {}", file_path, SDL_GetError());
-        return nullptr;
-    }
-
-    // 使用带有自定义删除器的 unique_ptr 存储加载的纹理
-    textures_.emplace(id, std::unique_ptr<SDL_Texture, SDLTextureDeleter>(raw_texture));
     spdlog::debug("successfully loaded and cached texture: {}", file_path);
-
-    return raw_texture;
+    return cacheTexture(id, raw_texture);
 }
 
 SDL_Texture* TextureManager::loadTexture(entt::hashed_string str_hs) {
     return loadTexture(str_hs.value(), str_hs.data());
 }
 
+SDL_Texture* TextureManager::addTexture(entt::id_type id, SDL_Surface* surface, std::string_view file_path) {
+    // 检查是否已加载
+    auto it = textures_.find(id);
+    if (it != textures_.end()) {
+        it->second.last_used_frame_ = current_frame_;
+        return it->second.get();
+    }
+
+    if (!surface) {
+        spdlog::error("failed to create texture '{}': surface is null.", file_path);
+        return nullptr;
+    }
+
+    // 解码已在工作线程完成，这里只把像素上传到渲染器
+    SDL_Texture* raw_texture = engine::core::invokeOnMainThread(main_thread_queue_, [this, surface, file_path]() -> SDL_Texture* {
+        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer_, surface);
+        if (!texture) {
+            spdlog::error("failed to create texture '{}': {}", file_path, SDL_GetError());
+            return nullptr;
+        }
+        if (!SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST)) {
+            spdlog::warn("cannot set texture scale mode to nearest interpolation.");
+        }
+        return texture;
+    });
+    if (!raw_texture) return nullptr;
+
+    spdlog::debug("successfully created and cached texture: {}", file_path);
+    return cacheTexture(id, raw_texture);
+}
+
 SDL_Texture* TextureManager::getTexture(entt::id_type id, std::string_view file_path) {
-    // 查找现有纹理
+    // 查找现有纹理 (同时刷新最近使用帧号)
     auto it = textures_.find(id);
     if (it != textures_.end()) {
+        it->second.last_used_frame_ = current_frame_;
         return it->second.get();
     }
 
@@ -91,6 +131,7 @@ void TextureManager::unloadTexture(entt::id_type id) {
     auto it = textures_.find(id);
     if (it != textures_.end()) {
         spdlog::debug("successfully unloaded texture: id = {}", id);
+        stats_.remove(it->second.bytes_);
         textures_.erase(it); // unique_ptr 通过自定义删除器处理删除
     } else {
         spdlog::warn("failed to unload texture: id = {}, texture not found in cache.", id);
@@ -102,6 +143,53 @@ void TextureManager::clearTextures() {
         spdlog::debug("successfully cleared all {} cached textures.", textures_.size());
         textures_.clear(); // unique_ptr 处理所有元素的删除
     }
+    stats_.resident_bytes_ = 0;
+}
+
+bool TextureManager::addRef(entt::id_type id) {
+    auto it = textures_.find(id);
+    if (it == textures_.end()) return false;
+    ++it->second.ref_count_;
+    return true;
+}
+
+void TextureManager::releaseRef(entt::id_type id) {
+    auto it = textures_.find(id);
+    if (it != textures_.end() && it->second.ref_count_ > 0) {
+        --it->second.ref_count_;
+    }
+}
+
+void TextureManager::setBudget(size_t bytes) {
+    stats_.budget_bytes_ = bytes;
+    evict();
+}
+
+size_t TextureManager::evict() {
+    auto evicted = evictLeastRecentlyUsed(textures_, stats_, current_frame_);
+    if (evicted > 0) {
+        spdlog::debug("evicted {} texture(s), resident {} bytes / budget {} bytes.", evicted, stats_.resident_bytes_, stats_.budget_bytes_);
+    }
+    return evicted;
+}
+
+size_t TextureManager::estimateBytes(SDL_Texture* texture) {
+    float width = 0.0f;
+    float height = 0.0f;
+    if (!texture || !SDL_GetTextureSize(texture, &width, &height)) return 0;
+    return static_cast<size_t>(width) * static_cast<size_t>(height) * 4;    // 按RGBA8估算
+}
+
+SDL_Texture* TextureManager::cacheTexture(entt::id_type id, SDL_Texture* raw_texture) {
+    // 使用带有自定义删除器的 unique_ptr 存储加载的纹理
+    TextureEntry entry;
+    entry.resource_ = std::unique_ptr<SDL_Texture, SDLTextureDeleter>(raw_texture, SDLTextureDeleter{main_thread_queue_});
+    entry.bytes_ = estimateBytes(raw_texture);
+    entry.last_used_frame_ = current_frame_;
+    stats_.add(entry.bytes_);
+    textures_.emplace(id, std::move(entry));
+    evict();    // 新纹理本帧刚使用过，不会被淘汰
+    return raw_texture;
 }
 
 } // namespace engine::resource
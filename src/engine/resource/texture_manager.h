@@ -6,6 +6,11 @@
 #include <SDL3/SDL_render.h>
 #include <glm/glm.hpp>
 #include <entt/core/fwd.hpp>
+#include "resource_residency.h"
+
+namespace engine::core {
+class MainThreadQueue;
+}
 
 namespace engine::resource {
 
@@ -14,6 +19,7 @@ namespace engine::resource {
  *
  * 在构造时初始化。使用文件路径作为键，确保纹理只加载一次并正确释放。
  * 依赖于一个有效的 SDL_Renderer，构造失败会抛出异常。
+ * 设置了主线程任务队列时，纹理的创建与销毁总是转交到主线程执行，因此可以在模拟线程中使用。
  */
 class TextureManager final{
     friend class ResourceManager;
@@ -21,17 +27,20 @@ class TextureManager final{
 private:
     // SDL_Texture 的删除器函数对象，用于智能指针管理
     struct SDLTextureDeleter {
-        void operator()(SDL_Texture* texture) const {
-            if (texture) {
-                SDL_DestroyTexture(texture);
-            }
-        }
+        engine::core::MainThreadQueue* main_thread_queue_ = nullptr;   ///< @brief 非空时在主线程中销毁
+        void operator()(SDL_Texture* texture) const;
     };
 
-    // 存储文件路径和指向管理纹理的 unique_ptr 的映射。(容器的键不可使用entt::hashed_string)
-    std::unordered_map<entt::id_type, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> textures_;
+    using TextureEntry = ResidentEntry<SDL_Texture, SDLTextureDeleter>;
+
+    // 存储文件路径和纹理条目的映射。(容器的键不可使用entt::hashed_string)
+    std::unordered_map<entt::id_type, TextureEntry> textures_;
 
     SDL_Renderer* renderer_ = nullptr; // 指向主渲染器的非拥有指针
+    engine::core::MainThreadQueue* main_thread_queue_ = nullptr;  ///< @brief 主线程任务队列 (可为空)
+
+    ResidencyStats stats_;              ///< @brief 驻留统计与预算
+    uint64_t current_frame_{0};         ///< @brief 当前帧号 (由 ResourceManager 每帧设置)
 
 public:
     /**
@@ -67,6 +76,16 @@ private: // 仅供 ResourceManager 访问的方法
      * @note 如果纹理未加载，则从字符串对应的文件路径加载纹理，并返回加载的纹理的指针
      */
     SDL_Texture* loadTexture(entt::hashed_string str_hs);
+
+    /**
+     * @brief 从已解码的图像创建纹理并缓存（用于并行预加载，必须在渲染器所属线程调用）
+     * @param id 纹理的唯一标识符, 通过entt::hashed_string生成
+     * @param surface 已解码的图像，所有权不转移，由调用者释放
+     * @param file_path 纹理文件的路径（仅用于日志）
+     * @return 创建的纹理的指针，失败返回nullptr
+     * @note 如果纹理已经加载，则直接返回已加载的纹理的指针
+     */
+    SDL_Texture* addTexture(entt::id_type id, SDL_Surface* surface, std::string_view file_path);
     
     /**
      * @brief 获取纹理
@@ -115,6 +134,22 @@ private: // 仅供 ResourceManager 访问的方法
      * @brief 清空所有纹理资源
      */
     void clearTextures();                                  ///< @brief 清空所有纹理资源
+
+    // --- 驻留管理 ---
+    bool addRef(entt::id_type id);                          ///< @brief 增加引用计数，纹理不存在时返回false
+    void releaseRef(entt::id_type id);                      ///< @brief 减少引用计数，归零后成为可淘汰条目
+    void setBudget(size_t bytes);                           ///< @brief 设置内存预算（0 表示不限制），超出时立即淘汰
+    void setCurrentFrame(uint64_t frame) { current_frame_ = frame; }
+    void setMainThreadQueue(engine::core::MainThreadQueue* queue) { main_thread_queue_ = queue; }
+    size_t evict();                                         ///< @brief 按LRU淘汰超出预算的未引用纹理，返回淘汰数量
+    [[nodiscard]] const ResidencyStats& getStats() const { return stats_; }
+    [[nodiscard]] size_t getCount() const { return textures_.size(); }
+
+    /// @brief 估算纹理占用的显存 (宽 * 高 * 4字节)
+    static size_t estimateBytes(SDL_Texture* texture);
+
+    /// @brief 缓存新纹理并按预算淘汰
+    SDL_Texture* cacheTexture(entt::id_type id, SDL_Texture* raw_texture);
 };
 
 } // namespace engine::resource
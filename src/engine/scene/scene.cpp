@@ -12,6 +12,8 @@ Scene::Scene(std::string_view name, engine::core::Context& context)
     : scene_name_(name),
       context_(context), 
       ui_manager_(std::make_unique<engine::ui::UIManager>()),
+      arena_("scene"),
+      pool_(&arena_),
       is_initialized_(false) {
     spdlog::trace("scene '{}' constructed successfully.", scene_name_);
 }
@@ -41,6 +43,9 @@ void Scene::clean() {
     if (!is_initialized_) return;
 
     registry_.clear();
+    // 组件都已销毁，场景内存整体归还 (派生类须在此之前销毁其它使用场景内存的对象)
+    pool_.release();
+    arena_.release();
 
     is_initialized_ = false;        // 清理完成后，设置场景为未初始化
     spdlog::trace("scene '{}' cleaned successfully.", scene_name_);
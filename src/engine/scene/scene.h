@@ -1,6 +1,8 @@
 #pragma once
 
+#include "../memory/linear_arena.h"
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <entt/entity/registry.hpp>
@@ -27,6 +29,10 @@ protected:
     std::string scene_name_;                            ///< @brief 场景名称
     engine::core::Context& context_;                    ///< @brief 上下文引用（隐式，构造时传入）
     std::unique_ptr<engine::ui::UIManager> ui_manager_; ///< @brief UI管理器(初始化时自动创建)
+
+    // --- 场景内存 (需晚于注册表析构，因此声明在注册表之前) ---
+    engine::memory::LinearArena arena_;                 ///< @brief 场景线性分配器，clean() 时整体释放
+    std::pmr::unsynchronized_pool_resource pool_;       ///< @brief 建立在 arena_ 之上的池，组件销毁后内存可被复用
     entt::registry registry_;                           ///< @brief ECS注册表
     
     bool is_initialized_ = false;                       ///< @brief 场景是否已初始化(非当前场景很可能未被删除，因此需要初始化标志避免重复初始化)
@@ -52,7 +58,8 @@ public:
     // 核心循环方法
     virtual void init();                        ///< @brief 初始化场景。
     virtual void update(float delta_time);      ///< @brief 更新场景。
-    virtual void render();                      ///< @brief 渲染场景。
+    virtual void render();                      ///< @brief 渲染场景。(模拟与渲染分离时在模拟线程中录制)
+    virtual void renderImGui() {}               ///< @brief 绘制 ImGui 调试UI。总是在主线程中、render() 之后调用。
     virtual void clean();                       ///< @brief 清理场景。
 
     /// @brief 请求弹出当前场景。
@@ -75,6 +82,9 @@ public:
 
     engine::core::Context& getContext() const { return context_; }                  ///< @brief 获取上下文引用
     entt::registry& getRegistry() { return registry_; }                      ///< @brief 获取注册表引用
+    /// @brief 场景生命周期的内存资源 (组件中的容器、加载器的临时数据等)，在 clean() 中整体释放
+    std::pmr::memory_resource* getMemoryResource() { return &pool_; }
+    const engine::memory::LinearArena& getArena() const { return arena_; }   ///< @brief 获取场景线性分配器 (统计)
 };
 
 } // namespace engine::scene
\ No newline at end of file
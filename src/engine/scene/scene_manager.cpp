@@ -46,6 +46,14 @@ void SceneManager::render() {
     }
 }
 
+void SceneManager::renderImGui() {
+    for (const auto& scene : scene_stack_) {
+        if (scene) {
+            scene->renderImGui();
+        }
+    }
+}
+
 void SceneManager::close() {
     spdlog::trace("scene manager closed successfully.");
     // 清理栈中所有剩余的场景（从顶到底）
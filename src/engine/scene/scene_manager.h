@@ -44,6 +44,7 @@ public:
     // 核心循环函数
     void update(float delta_time);
     void render();
+    void renderImGui();             ///< @brief (主线程) 绘制所有场景的即时模式调试UI
     void close();
 
 private:
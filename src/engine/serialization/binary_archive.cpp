@@ -0,0 +1,15 @@
+#include "binary_archive.h"
+#include <stdexcept>
+
+namespace engine::serialization {
+
+void BinaryInputArchive::readBytes(void* data, std::size_t size) {
+    if (size == 0) return;
+    if (size > size_ - offset_) {
+        throw std::runtime_error("BinaryInputArchive: unexpected end of data");
+    }
+    std::memcpy(data, data_ + offset_, size);
+    offset_ += size;
+}
+
+} // namespace engine::serialization
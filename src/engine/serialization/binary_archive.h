@@ -0,0 +1,250 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <memory_resource>
+#include <queue>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 二进制存档，用于注册表快照 (entt::snapshot / entt::snapshot_loader) 以及场景中其它需要保存的状态。
+ *
+ * 数据按本机字节序原样写入，只用于同一进程内的快照 (重开关卡、快速存读档)，不保证跨版本、跨平台兼容。
+ * 支持的类型：
+ * - 可平凡复制的类型 (数值、枚举、entt::entity、glm 向量、只含这些成员的组件)：直接复制字节；
+ * - 字符串、vector、deque、queue、array、unordered_map、pair：先写元素数量，再逐个写元素
+ *   (元素可平凡复制的 vector 整块复制)；
+ * - 其它类型需提供成员函数 `template <typename Archive> void serialize(Archive& archive)`，
+ *   在其中按固定顺序调用 archive(成员...)，同一个函数同时用于读和写。
+ */
+namespace engine::serialization {
+
+namespace detail {
+
+template <typename T, template <typename...> typename Template>
+struct is_specialization : std::false_type {};
+
+template <template <typename...> typename Template, typename... Args>
+struct is_specialization<Template<Args...>, Template> : std::true_type {};
+
+template <typename T, template <typename...> typename Template>
+inline constexpr bool is_specialization_v = is_specialization<T, Template>::value;
+
+template <typename T>
+struct is_std_array : std::false_type {};
+
+template <typename T, std::size_t N>
+struct is_std_array<std::array<T, N>> : std::true_type {};
+
+/// @brief 元素可平凡复制的 vector，可以整块读写
+template <typename T>
+struct is_trivial_vector : std::false_type {};
+
+template <typename T, typename Allocator>
+struct is_trivial_vector<std::vector<T, Allocator>> : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template <typename T, typename Archive>
+concept has_serialize = requires(T& value, Archive& archive) { value.serialize(archive); };
+
+/// @brief 是否为使用多态内存资源的容器 (pmr 容器的分配器构造后不能更换)
+template <typename T>
+inline constexpr bool uses_memory_resource_v = std::uses_allocator_v<T, std::pmr::polymorphic_allocator<std::byte>>;
+
+} // namespace detail
+
+/**
+ * @brief 写入存档，数据追加到外部的字节缓冲区 (缓冲区可复用，避免每次保存都重新分配)。
+ */
+class BinaryOutputArchive final {
+    std::vector<std::byte>& buffer_;
+
+public:
+    explicit BinaryOutputArchive(std::vector<std::byte>& buffer) : buffer_(buffer) {}
+
+    /// @brief 依次写入若干个值 (entt::snapshot 以此方式调用)
+    template <typename... Types>
+    void operator()(const Types&... values) {
+        (write(values), ...);
+    }
+
+    void writeBytes(const void* data, std::size_t size) {
+        if (size == 0) return;
+        const auto offset = buffer_.size();
+        buffer_.resize(offset + size);
+        std::memcpy(buffer_.data() + offset, data, size);
+    }
+
+    [[nodiscard]] std::size_t size() const { return buffer_.size(); }
+
+private:
+    void writeSize(std::size_t size) {
+        const auto value = static_cast<std::uint32_t>(size);
+        writeBytes(&value, sizeof(value));
+    }
+
+    template <typename T>
+    void write(const T& value) {
+        if constexpr (detail::has_serialize<T, BinaryOutputArchive>) {
+            // serialize 同时用于读写，写入时不会修改对象
+            const_cast<T&>(value).serialize(*this);
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            writeBytes(&value, sizeof(T));
+        } else if constexpr (detail::is_specialization_v<T, std::basic_string>) {
+            writeSize(value.size());
+            writeBytes(value.data(), value.size() * sizeof(typename T::value_type));
+        } else if constexpr (detail::is_trivial_vector<T>::value) {
+            writeSize(value.size());
+            writeBytes(value.data(), value.size() * sizeof(typename T::value_type));
+        } else if constexpr (detail::is_specialization_v<T, std::vector> ||
+                             detail::is_specialization_v<T, std::deque> ||
+                             detail::is_specialization_v<T, std::unordered_map>) {
+            writeSize(value.size());
+            for (const auto& element : value) {
+                write(element);
+            }
+        } else if constexpr (detail::is_std_array<T>::value) {
+            for (const auto& element : value) {
+                write(element);
+            }
+        } else if constexpr (detail::is_specialization_v<T, std::pair>) {
+            write(value.first);
+            write(value.second);
+        } else if constexpr (detail::is_specialization_v<T, std::queue>) {
+            // 队列不能遍历，复制一份依次弹出 (只用于波次这类很短的队列)
+            writeSize(value.size());
+            for (auto copy = value; !copy.empty(); copy.pop()) {
+                write(copy.front());
+            }
+        } else {
+            static_assert(sizeof(T) == 0, "BinaryOutputArchive: type is not serializable, add a serialize() member");
+        }
+    }
+};
+
+/**
+ * @brief 读取存档。
+ *
+ * 读取 pmr 容器时使用构造时传入的内存资源 (通常是场景内存)，不传时使用默认资源。
+ * 数据不足时抛出 std::runtime_error。
+ */
+class BinaryInputArchive final {
+    const std::byte* data_;
+    std::size_t size_;
+    std::size_t offset_ = 0;
+    std::pmr::memory_resource* resource_;
+
+public:
+    BinaryInputArchive(const std::vector<std::byte>& buffer,
+                       std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : data_(buffer.data()), size_(buffer.size()), resource_(resource) {}
+
+    /// @brief 依次读取若干个值 (entt::snapshot_loader 以此方式调用)
+    template <typename... Types>
+    void operator()(Types&... values) {
+        (read(values), ...);
+    }
+
+    void readBytes(void* data, std::size_t size);
+
+    [[nodiscard]] bool isAtEnd() const { return offset_ == size_; }
+
+private:
+    std::size_t readSize() {
+        std::uint32_t value = 0;
+        readBytes(&value, sizeof(value));
+        return value;
+    }
+
+    /// @brief 创建空容器，pmr 容器使用存档的内存资源
+    template <typename Container>
+    Container makeContainer() const {
+        if constexpr (detail::uses_memory_resource_v<Container>) {
+            return Container(resource_);
+        } else {
+            return Container();
+        }
+    }
+
+    /// @brief 用读好的容器替换原容器。pmr 容器的移动赋值会保留原来的内存资源，因此原地重新构造。
+    template <typename Container>
+    static void replace(Container& target, Container&& source) {
+        if constexpr (detail::uses_memory_resource_v<Container>) {
+            std::destroy_at(&target);
+            std::construct_at(&target, std::move(source));
+        } else {
+            target = std::move(source);
+        }
+    }
+
+    template <typename T>
+    void read(T& value) {
+        if constexpr (detail::has_serialize<T, BinaryInputArchive>) {
+            value.serialize(*this);
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            readBytes(&value, sizeof(T));
+        } else if constexpr (detail::is_specialization_v<T, std::basic_string>) {
+            auto result = makeContainer<T>();
+            result.resize(readSize());
+            readBytes(result.data(), result.size() * sizeof(typename T::value_type));
+            replace(value, std::move(result));
+        } else if constexpr (detail::is_trivial_vector<T>::value) {
+            auto result = makeContainer<T>();
+            result.resize(readSize());
+            readBytes(result.data(), result.size() * sizeof(typename T::value_type));
+            replace(value, std::move(result));
+        } else if constexpr (detail::is_specialization_v<T, std::vector> ||
+                             detail::is_specialization_v<T, std::deque>) {
+            auto result = makeContainer<T>();
+            const auto count = readSize();
+            if constexpr (detail::is_specialization_v<T, std::vector>) {
+                result.reserve(count);
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                typename T::value_type element{};
+                read(element);
+                result.push_back(std::move(element));
+            }
+            replace(value, std::move(result));
+        } else if constexpr (detail::is_specialization_v<T, std::unordered_map>) {
+            auto result = makeContainer<T>();
+            const auto count = readSize();
+            result.reserve(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                typename T::key_type key{};
+                typename T::mapped_type mapped{};
+                read(key);
+                read(mapped);
+                result.emplace(std::move(key), std::move(mapped));
+            }
+            replace(value, std::move(result));
+        } else if constexpr (detail::is_std_array<T>::value) {
+            for (auto& element : value) {
+                read(element);
+            }
+        } else if constexpr (detail::is_specialization_v<T, std::pair>) {
+            read(value.first);
+            read(value.second);
+        } else if constexpr (detail::is_specialization_v<T, std::queue>) {
+            T result;
+            const auto count = readSize();
+            for (std::size_t i = 0; i < count; ++i) {
+                typename T::value_type element{};
+                read(element);
+                result.push(std::move(element));
+            }
+            value = std::move(result);
+        } else {
+            static_assert(sizeof(T) == 0, "BinaryInputArchive: type is not serializable, add a serialize() member");
+        }
+    }
+};
+
+} // namespace engine::serialization
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "binary_archive.h"
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace engine::serialization {
+
+/**
+ * @brief 估算对象在堆上 (或内存资源中) 占用的字节数，用于调试统计。
+ *
+ * 与 BinaryOutputArchive 遍历相同的成员 (组件的 serialize() 成员同时用于读写快照与估算)，
+ * 但不写入数据，只累加字符串与容器的容量：
+ * - 字符串：超出短字符串优化 (SSO) 的容量；
+ * - vector：容量 × 元素大小；deque、queue：数量 × 元素大小；
+ * - unordered_map：桶数组 + 每个节点 (元素 + 链表指针 + 哈希值)；
+ * - 元素本身含有容器时递归累加。
+ * 结果只是估计值，不包括分配器的额外开销。
+ */
+class HeapSizeArchive final {
+    std::size_t bytes_ = 0;
+
+public:
+    HeapSizeArchive() = default;
+
+    /// @brief 累加若干个值的堆内存 (与其它存档的调用方式相同)
+    template <typename... Types>
+    void operator()(const Types&... values) {
+        (add(values), ...);
+    }
+
+    [[nodiscard]] std::size_t getBytes() const { return bytes_; }
+    void reset() { bytes_ = 0; }
+
+private:
+    template <typename T>
+    void add(const T& value) {
+        if constexpr (detail::has_serialize<T, HeapSizeArchive>) {
+            // serialize 同时用于读写，估算时不会修改对象
+            const_cast<T&>(value).serialize(*this);
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            // 没有堆内存
+        } else if constexpr (detail::is_specialization_v<T, std::basic_string>) {
+            if (value.capacity() > T(value.get_allocator()).capacity()) {
+                bytes_ += (value.capacity() + 1) * sizeof(typename T::value_type);
+            }
+        } else if constexpr (detail::is_specialization_v<T, std::vector>) {
+            bytes_ += value.capacity() * sizeof(typename T::value_type);
+            addElements(value);
+        } else if constexpr (detail::is_specialization_v<T, std::deque>) {
+            bytes_ += value.size() * sizeof(typename T::value_type);
+            addElements(value);
+        } else if constexpr (detail::is_specialization_v<T, std::unordered_map>) {
+            constexpr std::size_t NODE_OVERHEAD = sizeof(void*) + sizeof(std::size_t);
+            bytes_ += value.bucket_count() * sizeof(void*) + value.size() * (sizeof(typename T::value_type) + NODE_OVERHEAD);
+            addElements(value);
+        } else if constexpr (detail::is_std_array<T>::value) {
+            addElements(value);
+        } else if constexpr (detail::is_specialization_v<T, std::pair>) {
+            add(value.first);
+            add(value.second);
+        } else if constexpr (detail::is_specialization_v<T, std::queue>) {
+            // 队列不能遍历，只统计元素本身
+            bytes_ += value.size() * sizeof(typename T::value_type);
+        } else {
+            static_assert(sizeof(T) == 0, "HeapSizeArchive: type is not supported, add a serialize() member");
+        }
+    }
+
+    /// @brief 元素含有容器时逐个累加 (元素可平凡复制时跳过遍历)
+    template <typename Container>
+    void addElements(const Container& container) {
+        if constexpr (!std::is_trivially_copyable_v<typename Container::value_type>) {
+            for (const auto& element : container) {
+                add(element);
+            }
+        }
+    }
+};
+
+} // namespace engine::serialization
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "binary_archive.h"
+#include <entt/core/type_traits.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+
+namespace engine::serialization {
+
+/**
+ * @brief 把注册表中的实体及列出的组件写入存档。
+ * @param registry 注册表
+ * @param archive 写入存档
+ * @param components 要保存的组件类型列表 (entt::type_list)，读取时必须使用同一个列表
+ */
+template <typename... Component>
+void saveRegistry(const entt::registry& registry, BinaryOutputArchive& archive, entt::type_list<Component...>) {
+    entt::snapshot snapshot{registry};
+    snapshot.template get<entt::entity>(archive);
+    (snapshot.template get<Component>(archive), ...);
+}
+
+/**
+ * @brief 清空注册表后从存档恢复实体及组件，实体ID (含版本号) 与保存时完全一致。
+ * @param registry 注册表 (上下文变量与信号连接保留)
+ * @param archive 读取存档
+ * @param components 组件类型列表，必须与保存时一致
+ * @note 恢复组件时会触发 on_construct 信号，不应在恢复时执行的回调需由调用者事先断开。
+ */
+template <typename... Component>
+void loadRegistry(entt::registry& registry, BinaryInputArchive& archive, entt::type_list<Component...>) {
+    // snapshot_loader 要求注册表为空：先销毁所有组件与实体，再清空实体池中已释放的ID
+    registry.clear();
+    registry.storage<entt::entity>().clear();
+    entt::snapshot_loader loader{registry};
+    loader.template get<entt::entity>(archive);
+    (loader.template get<Component>(archive), ...);
+}
+
+} // namespace engine::serialization
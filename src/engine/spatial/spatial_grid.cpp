@@ -0,0 +1,95 @@
+#include "spatial_grid.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace engine::spatial {
+
+SpatialGrid::SpatialGrid(float cell_size)
+    : cell_size_(cell_size) {
+    if (cell_size_ <= 0.0f) {
+        throw std::runtime_error("SpatialGrid build failed: cell size must be positive.");
+    }
+    spdlog::trace("SpatialGrid build successfully, cell size: {}", cell_size_);
+}
+
+void SpatialGrid::update(entt::entity entity, const engine::utils::Rect& bounds) {
+    const auto range = toCellRange(bounds);
+    if (auto it = entries_.find(entity); it != entries_.end()) {
+        if (it->second == range) return;        // 仍在原来的格子中，无需更新
+        eraseCells(entity, it->second);
+        it->second = range;
+    } else {
+        entries_.emplace(entity, range);
+    }
+    insertCells(entity, range);
+}
+
+void SpatialGrid::remove(entt::entity entity) {
+    auto it = entries_.find(entity);
+    if (it == entries_.end()) return;
+    eraseCells(entity, it->second);
+    entries_.erase(it);
+}
+
+void SpatialGrid::query(const engine::utils::Rect& area, std::vector<entt::entity>& out) const {
+    const auto range = toCellRange(area);
+    for (int y = range.min_y_; y <= range.max_y_; ++y) {
+        for (int x = range.min_x_; x <= range.max_x_; ++x) {
+            auto it = cells_.find(cellKey(x, y));
+            if (it == cells_.end()) continue;
+            for (const auto& item : it->second) {
+                // 跨越多个格子的实体，只在“实体范围与查询范围交集”的左上角格子中输出一次
+                if (x != std::max(item.range_.min_x_, range.min_x_) ||
+                    y != std::max(item.range_.min_y_, range.min_y_)) continue;
+                out.push_back(item.entity_);
+            }
+        }
+    }
+}
+
+void SpatialGrid::clear() {
+    cells_.clear();
+    entries_.clear();
+}
+
+SpatialGrid::CellRange SpatialGrid::toCellRange(const engine::utils::Rect& bounds) const {
+    return CellRange{
+        static_cast<int>(std::floor(bounds.position.x / cell_size_)),
+        static_cast<int>(std::floor(bounds.position.y / cell_size_)),
+        static_cast<int>(std::floor((bounds.position.x + bounds.size.x) / cell_size_)),
+        static_cast<int>(std::floor((bounds.position.y + bounds.size.y) / cell_size_)),
+    };
+}
+
+uint64_t SpatialGrid::cellKey(int x, int y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+void SpatialGrid::insertCells(entt::entity entity, const CellRange& range) {
+    for (int y = range.min_y_; y <= range.max_y_; ++y) {
+        for (int x = range.min_x_; x <= range.max_x_; ++x) {
+            cells_[cellKey(x, y)].push_back({entity, range});
+        }
+    }
+}
+
+void SpatialGrid::eraseCells(entt::entity entity, const CellRange& range) {
+    for (int y = range.min_y_; y <= range.max_y_; ++y) {
+        for (int x = range.min_x_; x <= range.max_x_; ++x) {
+            auto it = cells_.find(cellKey(x, y));
+            if (it == cells_.end()) continue;
+            auto& items = it->second;
+            // 格子内顺序无关，交换到末尾后弹出
+            auto item = std::find_if(items.begin(), items.end(), [entity](const CellItem& i) { return i.entity_ == entity; });
+            if (item != items.end()) {
+                *item = items.back();
+                items.pop_back();
+            }
+            // 空格子保留容量，单位在相邻格子间来回移动时不必反复分配
+        }
+    }
+}
+
+} // namespace engine::spatial
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../utils/math.h"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <entt/entity/entity.hpp>
+
+namespace engine::spatial {
+
+/**
+ * @brief 均匀网格空间索引，按轴对齐包围盒存储实体。
+ *
+ * 世界被划分为边长固定的格子，实体登记在其包围盒覆盖的所有格子中 (格子按哈希表稀疏存储，地图大小不受限制)。
+ * 查询时只访问与查询矩形相交的格子，因此开销与查询范围内的实体数量有关，而与实体总数无关。
+ *
+ * - 静态实体 (瓦片、装饰物) 可以一次性插入，之后只查询；
+ * - 动态实体 (单位、投射物) 每帧调用 update()，所在格子未变化时直接返回。
+ *
+ * @note 查询结果是“可能相交”的候选集合 (格子粒度)，需要精确结果时由调用者再做一次包围盒检测。
+ */
+class SpatialGrid final {
+    /// @brief 包围盒覆盖的格子范围 (闭区间)
+    struct CellRange {
+        int min_x_{0};
+        int min_y_{0};
+        int max_x_{-1};
+        int max_y_{-1};
+        bool operator==(const CellRange&) const = default;
+    };
+
+    /// @brief 格子中的一项，同时保存实体的格子范围，用于查询时去重
+    struct CellItem {
+        entt::entity entity_;
+        CellRange range_;
+    };
+
+    float cell_size_;                                               ///< @brief 格子边长 (世界坐标)
+    std::unordered_map<uint64_t, std::vector<CellItem>> cells_;     ///< @brief 格子坐标 -> 格子中的实体
+    std::unordered_map<entt::entity, CellRange> entries_;           ///< @brief 实体 -> 所在的格子范围
+
+public:
+    /**
+     * @brief 构造函数
+     * @param cell_size 格子边长，通常取常见实体尺寸的 2~4 倍。
+     */
+    explicit SpatialGrid(float cell_size);
+
+    // 删除复制/移动操作
+    SpatialGrid(const SpatialGrid&) = delete;
+    SpatialGrid& operator=(const SpatialGrid&) = delete;
+    SpatialGrid(SpatialGrid&&) = delete;
+    SpatialGrid& operator=(SpatialGrid&&) = delete;
+
+    /**
+     * @brief 插入或更新实体的包围盒。
+     * @param entity 实体。
+     * @param bounds 世界坐标下的包围盒。
+     * @note 所在格子范围未变化时不做任何修改。
+     */
+    void update(entt::entity entity, const engine::utils::Rect& bounds);
+
+    /// @brief 移除实体，实体不在网格中时什么也不做
+    void remove(entt::entity entity);
+
+    /**
+     * @brief 查询与矩形所在格子相交的实体 (每个实体只出现一次)。
+     * @param area 世界坐标下的查询矩形。
+     * @param out 结果追加到此容器中 (不会清空)。
+     */
+    void query(const engine::utils::Rect& area, std::vector<entt::entity>& out) const;
+
+    void clear();                                                           ///< @brief 清空网格
+    [[nodiscard]] bool contains(entt::entity entity) const { return entries_.contains(entity); }
+    [[nodiscard]] size_t size() const { return entries_.size(); }           ///< @brief 网格中的实体数量
+    [[nodiscard]] size_t getCellCount() const { return cells_.size(); }     ///< @brief 已分配的格子数量
+    [[nodiscard]] float getCellSize() const { return cell_size_; }
+
+private:
+    [[nodiscard]] CellRange toCellRange(const engine::utils::Rect& bounds) const;
+    [[nodiscard]] static uint64_t cellKey(int x, int y);
+    void insertCells(entt::entity entity, const CellRange& range);
+    void eraseCells(entt::entity entity, const CellRange& range);
+};
+
+} // namespace engine::spatial
@@ -1,26 +1,52 @@
 #include "animation_system.h"
 #include "../component/animation_component.h"
 #include "../component/sprite_component.h"
+#include "../component/transform_component.h"
+#include "../render/camera.h"
+#include "../utils/bounds.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
+#include <cmath>
+#include <limits>
 
 namespace engine::system {
 
+namespace {
+    constexpr float VISIBLE_MARGIN = 32.0f;     ///< @brief 视口向外扩展的距离，实体进入视口前就开始写入精灵
+}
+
 AnimationSystem::AnimationSystem(entt::registry& registry, entt::dispatcher& dispatcher)
     : registry_(registry), dispatcher_(dispatcher) {
     dispatcher_.sink<engine::utils::PlayAnimationEvent>().connect<&AnimationSystem::onPlayAnimationEvent>(this);
+    registry_.on_construct<engine::component::AnimationComponent>().connect<&AnimationSystem::onAnimationConstruct>(this);
 }
 
 AnimationSystem::~AnimationSystem() {
     dispatcher_.disconnect(this);
+    registry_.on_construct<engine::component::AnimationComponent>().disconnect(this);
 }
 
-void AnimationSystem::update(float dt) {
+void AnimationSystem::update(float dt, const engine::render::Camera& camera) {
+    const double dt_ms = dt * 1000.0;
+    const double last_clock_ms = clock_ms_;
+    clock_ms_ += dt_ms;
+
     auto view = registry_.view<engine::component::AnimationComponent, engine::component::SpriteComponent>();
     for (auto entity : view) {
         auto& anim_component = view.get<engine::component::AnimationComponent>(entity);
         auto& sprite_component = view.get<engine::component::SpriteComponent>(entity);
 
+        // 没有变换组件的实体无法判断位置，视为可见
+        bool is_visible = true;
+        if (auto transform = registry_.try_get<engine::component::TransformComponent>(entity); transform) {
+            is_visible = camera.isInView(engine::utils::getSpriteBounds(*transform, sprite_component), VISIBLE_MARGIN);
+        }
+
+        // 屏幕外且本帧不会到达可观察时刻，直接跳过 (连动画查找都不需要)
+        if (!is_visible && clock_ms_ < anim_component.lod_wake_ms_ && dt_ms < anim_component.lod_max_step_ms_) {
+            continue;
+        }
+
         // 如果动画不存在，则跳过
         auto it = anim_component.animations_.find(anim_component.current_animation_id_);
         if (it == anim_component.animations_.end()) {
@@ -28,49 +54,94 @@ void AnimationSystem::update(float dt) {
         }
 
         // 获取当前动画
-        auto& current_animation = it->second;
+        const auto& current_animation = it->second;
         // 如果没有帧，则跳过
         if (current_animation.frames_.empty()) {
             continue;
         }
 
+        // 先补上之前跳过的时间 (不含本帧)
+        catchUp(entity, anim_component, current_animation, (last_clock_ms - anim_component.lod_synced_ms_) * anim_component.speed_);
+        anim_component.lod_synced_ms_ = clock_ms_;
+
         // 更新当前播放时间 (推进计时器)
         anim_component.current_time_ms_ += dt * 1000.0f * anim_component.speed_;
 
-        // 获取当前帧
-        const auto& current_frame = current_animation.frames_[anim_component.current_frame_index_];
-
         // 检查是否需要切换到下一帧
-        if (anim_component.current_time_ms_ >= current_frame.duration_ms_) {
-            anim_component.current_time_ms_ -= current_frame.duration_ms_;
-            anim_component.current_frame_index_++;
-
-            // 检查是否要发送动画事件
-            if (current_animation.events_.find(anim_component.current_frame_index_) != current_animation.events_.end()) {
-                dispatcher_.enqueue(engine::utils::AnimationEvent{entity, 
-                    current_animation.events_.at(anim_component.current_frame_index_),
-                    anim_component.current_animation_id_});
-            }
-
-            // 处理动画播放完成
-            if (anim_component.current_frame_index_ >= current_animation.frames_.size()) {
-                if (current_animation.loop_) {
-                    anim_component.current_frame_index_ = 0;
-                } else {
-                    // 动画播放完毕且不循环，停在最后一帧
-                    anim_component.current_frame_index_ = current_animation.frames_.size() - 1;
-                    // 发送动画播放完成事件
-                    dispatcher_.enqueue(engine::utils::AnimationFinishedEvent{entity, anim_component.current_animation_id_});
-                }
-            }
+        if (anim_component.current_time_ms_ >= current_animation.frames_[anim_component.current_frame_index_].duration_ms_) {
+            advanceFrame(entity, anim_component, current_animation);
+        }
+
+        if (is_visible) {
+            // 更新 SpriteComponent 的源矩形 （根据当前动画帧的源矩形信息）
+            const auto& next_frame = current_animation.frames_[anim_component.current_frame_index_];
+            sprite_component.sprite_.src_rect_ = next_frame.src_rect_;
+            anim_component.lod_wake_ms_ = clock_ms_;    // 离开视口后的第一帧重新计算
+        } else {
+            anim_component.lod_wake_ms_ = computeWakeTime(anim_component, current_animation);
+            anim_component.lod_max_step_ms_ = current_animation.min_frame_ms_ / anim_component.speed_;
         }
-        
-        // 更新 SpriteComponent 的源矩形 （根据当前动画帧的源矩形信息）
-        const auto& next_frame = current_animation.frames_[anim_component.current_frame_index_];
-        sprite_component.sprite_.src_rect_ = next_frame.src_rect_;
     }
 }
 
+void AnimationSystem::catchUp(entt::entity entity, engine::component::AnimationComponent& anim,
+                              const engine::component::Animation& animation, double elapsed_ms) {
+    if (elapsed_ms <= 0.0) return;
+    // 没有事件的循环动画，整圈的时间不改变状态
+    if (animation.loop_ && animation.events_.empty() && animation.total_duration_ms_ > 0.0f) {
+        elapsed_ms = std::fmod(elapsed_ms, static_cast<double>(animation.total_duration_ms_));
+    }
+    anim.current_time_ms_ += static_cast<float>(elapsed_ms);
+    // 每帧时长都小于最短帧间隔时，逐帧推进等价于一次跨过多帧
+    while (anim.current_time_ms_ >= animation.frames_[anim.current_frame_index_].duration_ms_) {
+        const bool finished = !animation.loop_ && anim.current_frame_index_ + 1 >= animation.frames_.size();
+        advanceFrame(entity, anim, animation);
+        if (finished) break;    // 停在最后一帧，剩余时间留给之后的逐帧推进
+    }
+}
+
+void AnimationSystem::advanceFrame(entt::entity entity, engine::component::AnimationComponent& anim,
+                                   const engine::component::Animation& animation) {
+    anim.current_time_ms_ -= animation.frames_[anim.current_frame_index_].duration_ms_;
+    anim.current_frame_index_++;
+
+    // 检查是否要发送动画事件
+    if (auto event_it = animation.events_.find(static_cast<int>(anim.current_frame_index_)); event_it != animation.events_.end()) {
+        dispatcher_.enqueue(engine::utils::AnimationEvent{entity, event_it->second, anim.current_animation_id_});
+    }
+
+    // 处理动画播放完成
+    if (anim.current_frame_index_ >= animation.frames_.size()) {
+        if (animation.loop_) {
+            anim.current_frame_index_ = 0;
+        } else {
+            // 动画播放完毕且不循环，停在最后一帧
+            anim.current_frame_index_ = animation.frames_.size() - 1;
+            // 发送动画播放完成事件
+            dispatcher_.enqueue(engine::utils::AnimationFinishedEvent{entity, anim.current_animation_id_});
+        }
+    }
+}
+
+double AnimationSystem::computeWakeTime(const engine::component::AnimationComponent& anim,
+                                        const engine::component::Animation& animation) const {
+    if (anim.speed_ <= 0.0f) return std::numeric_limits<double>::infinity();
+    const auto frame_count = animation.frames_.size();
+    // 从当前帧向后累加帧间隔，直到遇到有事件的帧或播放完成
+    double remaining_ms = animation.frames_[anim.current_frame_index_].duration_ms_ - anim.current_time_ms_;
+    size_t index = anim.current_frame_index_;
+    for (size_t i = 0; i <= frame_count; ++i) {
+        const size_t next = index + 1;
+        if (animation.events_.contains(static_cast<int>(next)) || (next >= frame_count && !animation.loop_)) {
+            return anim.lod_synced_ms_ + remaining_ms / anim.speed_;
+        }
+        index = next >= frame_count ? 0 : next;
+        remaining_ms += animation.frames_[index].duration_ms_;
+    }
+    // 循环一整圈都没有事件，屏幕外时永远不需要推进
+    return std::numeric_limits<double>::infinity();
+}
+
 void AnimationSystem::onPlayAnimationEvent(const engine::utils::PlayAnimationEvent& event) {
     // 使用try_get方法来安全获取可能存在的组件。如果不存在则返回nullptr
     if (auto anim = registry_.try_get<engine::component::AnimationComponent>(event.entity_); anim) {
@@ -78,7 +149,16 @@ void AnimationSystem::onPlayAnimationEvent(const engine::utils::PlayAnimationEve
         anim->current_frame_index_ = 0;
         anim->current_time_ms_ = 0.0f;
         anim->animations_.at(event.animation_id_).loop_ = event.loop_;
+        // 新动画从当前时钟开始，下一帧重新计算可观察时刻
+        anim->lod_synced_ms_ = clock_ms_;
+        anim->lod_wake_ms_ = clock_ms_;
     }
 }
 
-} // namespace engine::system
\ No newline at end of file
+void AnimationSystem::onAnimationConstruct(entt::registry& registry, entt::entity entity) {
+    auto& anim = registry.get<engine::component::AnimationComponent>(entity);
+    anim.lod_synced_ms_ = clock_ms_;
+    anim.lod_wake_ms_ = clock_ms_;
+}
+
+} // namespace engine::system
@@ -4,26 +4,58 @@
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
 
+namespace engine::component {
+    struct Animation;
+    struct AnimationComponent;
+}
+
+namespace engine::render {
+    class Camera;
+}
+
 namespace engine::system {
 
 /**
  * @brief 动画系统
- * 
+ *
  * 负责更新实体的动画组件，并同步到精灵组件。
+ *
+ * 动画LOD：屏幕外的实体不逐帧推进，而是记录下一个可观察时刻 (有事件的帧或播放完成)，
+ * 在此之前直接跳过；到达该时刻或重新进入视口时，再一次性补上跳过的时间并发送事件。
+ * 只有可见的实体才会写入精灵的源矩形。
+ * 单帧时长不小于动画最短帧间隔时 (逐帧推进每次只前进一帧)，退回逐帧推进，保证事件与逐帧推进一致。
  */
 class AnimationSystem {
     // 将依赖保存为成员变量，方便回调函数使用
     entt::registry& registry_;
     entt::dispatcher& dispatcher_;
-    
+
+    double clock_ms_{};     ///< @brief 动画系统的时钟（毫秒），用于计算屏幕外实体跳过的时间
+
 public:
     AnimationSystem(entt::registry& registry, entt::dispatcher& dispatcher);
     ~AnimationSystem();
 
-    void update(float dt);  ///< @brief 现在更新函数只需要传入dt，注册表和dispatcher在构造函数中传入
+    /**
+     * @brief 更新动画
+     * @param dt 帧间隔（秒）
+     * @param camera 相机，用于判断实体是否可见
+     */
+    void update(float dt, const engine::render::Camera& camera);
 
 private:
+    /// @brief 补上屏幕外跳过的时间 (期间最多跨过一个可观察时刻)
+    void catchUp(entt::entity entity, engine::component::AnimationComponent& anim,
+                 const engine::component::Animation& animation, double elapsed_ms);
+    /// @brief 切换到下一帧，并按需发送动画事件和播放完成事件
+    void advanceFrame(entt::entity entity, engine::component::AnimationComponent& anim,
+                      const engine::component::Animation& animation);
+    /// @brief 计算下一个可观察时刻的时钟，没有时返回无穷大
+    [[nodiscard]] double computeWakeTime(const engine::component::AnimationComponent& anim,
+                                         const engine::component::Animation& animation) const;
+
     void onPlayAnimationEvent(const engine::utils::PlayAnimationEvent& event);  ///< @brief 播放动画事件处理函数
+    void onAnimationConstruct(entt::registry& registry, entt::entity entity);   ///< @brief 新动画从当前时钟开始计时
 };
 
-} // namespace engine::system
\ No newline at end of file
+} // namespace engine::system
@@ -1,11 +1,14 @@
 #include "audio_system.h"
 #include "../core/context.h"
 #include "../component/audio_component.h"
+#include "../component/transform_component.h"
 #include "../audio/audio_player.h"
+#include "../audio/voice_manager.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <entt/core/hashed_string.hpp>
 #include <spdlog/spdlog.h>
+#include <optional>
 
 using namespace entt::literals;
 
@@ -23,29 +26,26 @@ AudioSystem::AudioSystem(entt::registry& registry, engine::core::Context& contex
 }
 
 void AudioSystem::onPlaySoundEvent(const engine::utils::PlaySoundEvent& event) {
-    // 如果没有传入目标实体，则直接播放全局音效
-    if (event.entity_ == entt::null) {
-        spdlog::info("play global sound: {}", event.sound_id_);
-        context_.getAudioPlayer().playSound(event.sound_id_);
-    }
-    // 如果有传入目标实体，且实体有音效组件
-    else if (auto audio_component = registry_.try_get<engine::component::AudioComponent>(event.entity_); audio_component) {
-        auto it = audio_component->sounds_.find(event.sound_id_);
-        // 先尝试在目标实体的音效集合中查找
-        if (it != audio_component->sounds_.end()) {
-            spdlog::info("entity ID: {} found sound: {}", entt::to_integral(event.entity_), it->second);
-            context_.getAudioPlayer().playSound(it->second);
-        // 如果没找到，则播放全局音效
-        } else {
-            spdlog::info("entity ID: {} not found sound: {}", entt::to_integral(event.entity_), event.sound_id_);
-            context_.getAudioPlayer().playSound(event.sound_id_);
+    // 大规模战斗时每帧可能有几十个音效事件，日志只在 trace 级别输出
+    entt::id_type sound_id = event.sound_id_;
+    std::optional<glm::vec2> position;
+    // 如果有传入目标实体，先尝试在目标实体的音效集合中查找，没找到则播放全局音效
+    if (event.entity_ != entt::null && registry_.valid(event.entity_)) {
+        if (auto audio_component = registry_.try_get<engine::component::AudioComponent>(event.entity_); audio_component) {
+            if (auto it = audio_component->sounds_.find(event.sound_id_); it != audio_component->sounds_.end()) {
+                sound_id = it->second;
+            } else {
+                spdlog::trace("entity ID: {} not found sound: {}", entt::to_integral(event.entity_), event.sound_id_);
+            }
+        }
+        // 有位置的实体按与相机的距离衰减
+        if (auto transform = registry_.try_get<engine::component::TransformComponent>(event.entity_); transform) {
+            position = transform->position_;
         }
     }
-    // 如果有传入目标实体，但实体没有音效组件，也尝试播放全局音效
-    else {
-        spdlog::info("entity ID: {} not found AudioComponent, try play global sound: {}", entt::to_integral(event.entity_), event.sound_id_);
-        context_.getAudioPlayer().playSound(event.sound_id_);
-    }
+    spdlog::trace("request sound: {}, entity ID: {}", sound_id, entt::to_integral(event.entity_));
+    // 交给发声管理器，同帧重复的音效会被合并，实际播放在帧末统一进行
+    context_.getAudioPlayer().getVoiceManager().request(sound_id, context_.getCamera(), position);
 }
 
 } // namespace engine::system
\ No newline at end of file
@@ -7,16 +7,11 @@ namespace engine::system {
 
 void MovementSystem::update(entt::registry& registry, float delta_time) {
     spdlog::trace("MovementSystem::update");
-    // 获取感兴趣的实体 view
-    auto view = registry.view<engine::component::VelocityComponent, engine::component::TransformComponent>();
-
-    // 遍历获取的实体，获取组件并执行相关逻辑
-    for (auto entity : view) {
-        const auto& velocity = view.get<engine::component::VelocityComponent>(entity);
-        auto& transform = view.get<engine::component::TransformComponent>(entity);
-
+    // 拥有组：速度与变换组件在各自的存储中按相同顺序排在最前面，逐个并行遍历，不需要逐实体查找
+    auto group = registry.group<engine::component::VelocityComponent, engine::component::TransformComponent>();
+    group.each([delta_time](const engine::component::VelocityComponent& velocity, engine::component::TransformComponent& transform) {
         transform.position_ += velocity.velocity_ * delta_time; // 更新位置
-    }
+    });
 }
 
 }   // namespace engine::system
\ No newline at end of file
@@ -8,6 +8,9 @@ namespace engine::system {
  * @brief 移动系统
  * 
  * 负责更新实体的移动组件，并同步到变换组件。
+ *
+ * 使用拥有 VelocityComponent 与 TransformComponent 的组 (owning group)。
+ * 一个组件只能被一个组拥有，其它系统需要这两个组件时只能用视图或非拥有的方式获取。
  */
 class MovementSystem {
 public:
@@ -4,30 +4,147 @@
 #include "../component/transform_component.h"
 #include "../component/sprite_component.h"
 #include "../component/render_component.h"
+#include "../component/parallax_component.h"
+#include "../component/static_render_tag.h"
+#include "../utils/bounds.h"
+#include <entt/entity/registry.hpp>
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
 
 namespace engine::system {
 
-void RenderSystem::update(entt::registry& registry, render::Renderer& renderer, const render::Camera& camera) {
+namespace {
+    constexpr float STATIC_CELL_SIZE = 256.0f;      ///< @brief 静态网格的格子边长 (瓦片数量多、不移动，格子可以大一些)
+    constexpr float DYNAMIC_CELL_SIZE = 128.0f;     ///< @brief 动态网格的格子边长
+    constexpr float CULL_MARGIN = 16.0f;            ///< @brief 查询范围向外扩展的距离，避免边缘处的精灵闪烁
+
+    /// @brief 动态渲染组：拥有渲染与精灵组件 (变换组件已被移动组拥有，按实体查找)，静态实体与视差图层不在组内
+    auto dynamicGroup(entt::registry& registry) {
+        return registry.group<component::RenderComponent, component::SpriteComponent>(
+            entt::get<component::TransformComponent>, entt::exclude<component::StaticRenderTag, component::ParallaxComponent>);
+    }
+}
+
+RenderSystem::RenderSystem(entt::registry& registry)
+    : registry_(registry), static_grid_(STATIC_CELL_SIZE), dynamic_grid_(DYNAMIC_CELL_SIZE) {
+    registry_.on_construct<component::StaticRenderTag>().connect<&RenderSystem::onStaticChanged>(this);
+    registry_.on_destroy<component::StaticRenderTag>().connect<&RenderSystem::onStaticChanged>(this);
+    registry_.on_destroy<component::TransformComponent>().connect<&RenderSystem::onRenderableDestroy>(this);
+    registry_.on_destroy<component::SpriteComponent>().connect<&RenderSystem::onRenderableDestroy>(this);
+    registry_.on_destroy<component::RenderComponent>().connect<&RenderSystem::onRenderableDestroy>(this);
+    // 提前创建动态渲染组，已有的实体在这里整理一次
+    dynamicGroup(registry_);
+    // 统计数据放入注册表上下文，方便调试UI读取
+    registry_.ctx().emplace<RenderStats&>(stats_);
+}
+
+RenderSystem::~RenderSystem() {
+    registry_.on_construct<component::StaticRenderTag>().disconnect(this);
+    registry_.on_destroy<component::StaticRenderTag>().disconnect(this);
+    registry_.on_destroy<component::TransformComponent>().disconnect(this);
+    registry_.on_destroy<component::SpriteComponent>().disconnect(this);
+    registry_.on_destroy<component::RenderComponent>().disconnect(this);
+    registry_.ctx().erase<RenderStats&>();
+}
+
+void RenderSystem::update(render::Renderer& renderer, const render::Camera& camera) {
     spdlog::trace("RenderSystem::update");
 
-    // 对RenderComponent进行排序 (需要自定义RenderComponent的比较运算符)
-    registry.sort<component::RenderComponent>([](const auto& lhs, const auto& rhs) {
+    if (static_dirty_) rebuildStaticGrid();
+    updateDynamicGrid();
+
+    // 用相机视口 (世界坐标) 查询两个网格，得到可能可见的实体
+    const auto view_position = camera.getPosition();
+    const auto view_size = camera.getViewportSize();
+    const engine::utils::Rect query_area{view_position - glm::vec2(CULL_MARGIN), view_size + glm::vec2(CULL_MARGIN * 2.0f)};
+    candidates_.clear();
+    static_grid_.query(query_area, candidates_);
+    dynamic_grid_.query(query_area, candidates_);
+
+    // 视差实体 (图片层) 不在网格中，总是作为候选
+    auto parallax_view = registry_.view<component::ParallaxComponent, component::RenderComponent,
+                                        component::TransformComponent, component::SpriteComponent>();
+    int parallax_count = 0;
+    for (auto entity : parallax_view) {
+        candidates_.push_back(entity);
+        ++parallax_count;
+    }
+
+    // 只对候选实体排序 (图层、深度；相同时按实体ID，保证顺序稳定)
+    auto view = registry_.view<component::RenderComponent, component::TransformComponent, component::SpriteComponent>();
+    std::sort(candidates_.begin(), candidates_.end(), [&view](entt::entity lhs, entt::entity rhs) {
+        const auto& render_lhs = view.get<component::RenderComponent>(lhs);
+        const auto& render_rhs = view.get<component::RenderComponent>(rhs);
+        if (render_lhs < render_rhs) return true;
+        if (render_rhs < render_lhs) return false;
         return lhs < rhs;
     });
 
-    // 执行渲染，注意排序组件RenderComponent必须放在最前面
-    auto view = registry.view<component::RenderComponent, component::TransformComponent, component::SpriteComponent>();
-    for (auto entity : view) {
+    stats_ = RenderStats{};
+    stats_.total_ = static_cast<int>(static_grid_.size() + dynamic_grid_.size()) + parallax_count;
+    stats_.candidates_ = static_cast<int>(candidates_.size());
+    for (auto entity : candidates_) {
         const auto& render = view.get<component::RenderComponent>(entity);
         const auto& transform = view.get<component::TransformComponent>(entity);
         const auto& sprite = view.get<component::SpriteComponent>(entity);
+
         auto position = transform.position_ + sprite.offset_;   // 位置 = 变换组件的位置 + 精灵的偏移
         auto size = sprite.size_ * transform.scale_;            // 大小 = 精灵的大小 * 变换组件的缩放
-        renderer.drawSprite(camera, sprite.sprite_, position, size, transform.rotation_);
+
+        // 视差图层：按滚动因子偏移并平铺，可见的块由Renderer合并为一次绘制
+        if (parallax_view.contains(entity)) {
+            const auto& parallax = parallax_view.get<component::ParallaxComponent>(entity);
+            if (!parallax.is_visible_) continue;
+            renderer.drawParallax(camera, sprite.sprite_, position, size, parallax.scroll_factor_, parallax.repeat_, render.color_);
+            ++stats_.drawn_;
+            continue;
+        }
+
+        // 格子粒度的候选集合仍可能在视口外，精确检测一次
+        if (!camera.isInView(engine::utils::getSpriteBounds(transform, sprite))) continue;
+
         // 绘制时应用Render组件中的颜色调整参数
         renderer.drawSprite(camera, sprite.sprite_, position, size, transform.rotation_, render.color_);
+        ++stats_.drawn_;
+    }
+    stats_.culled_ = stats_.total_ - stats_.drawn_;
+}
+
+void RenderSystem::rebuildStaticGrid() {
+    static_grid_.clear();
+    auto view = registry_.view<component::StaticRenderTag, component::RenderComponent,
+                               component::TransformComponent, component::SpriteComponent>();
+    for (auto entity : view) {
+        static_grid_.update(entity, getBounds(entity));
+    }
+    static_dirty_ = false;
+    spdlog::debug("RenderSystem: static grid rebuilt, {} entities in {} cells.", static_grid_.size(), static_grid_.getCellCount());
+}
+
+void RenderSystem::updateDynamicGrid() {
+    // 组内的组件按顺序遍历并直接计算包围盒，不需要再按实体查找
+    for (auto [entity, render, sprite, transform] : dynamicGroup(registry_).each()) {
+        dynamic_grid_.update(entity, engine::utils::getSpriteBounds(transform, sprite));
+    }
+}
+
+engine::utils::Rect RenderSystem::getBounds(entt::entity entity) const {
+    return engine::utils::getSpriteBounds(registry_.get<component::TransformComponent>(entity),
+                                          registry_.get<component::SpriteComponent>(entity));
+}
+
+void RenderSystem::onStaticChanged(entt::registry&, entt::entity entity) {
+    // 实体在静态与动态之间切换时，先从动态网格中移除 (需要时会在下一帧重新加入)
+    dynamic_grid_.remove(entity);
+    static_dirty_ = true;
+}
+
+void RenderSystem::onRenderableDestroy(entt::registry& registry, entt::entity entity) {
+    dynamic_grid_.remove(entity);
+    if (registry.all_of<component::StaticRenderTag>(entity)) {
+        static_dirty_ = true;
     }
 }
 
-} // namespace engine::system 
\ No newline at end of file
+} // namespace engine::system
@@ -1,6 +1,10 @@
 #pragma once
 
-#include <entt/entt.hpp>
+#include "../spatial/spatial_grid.h"
+#include "../utils/math.h"
+#include <entt/entity/fwd.hpp>
+#include <entt/entity/entity.hpp>
+#include <vector>
 
 namespace engine::render {
     class Renderer;
@@ -9,22 +13,65 @@ namespace engine::render {
 
 namespace engine::system {
 
+/**
+ * @brief 渲染剔除统计 (上一帧)
+ */
+struct RenderStats {
+    int total_{};           ///< @brief 可渲染实体总数
+    int candidates_{};      ///< @brief 空间索引查询得到的候选数量
+    int drawn_{};           ///< @brief 实际绘制的数量
+    int culled_{};          ///< @brief 被剔除的数量 (total_ - drawn_)
+};
+
 /**
  * @brief 渲染系统
- * 
- * 负责遍历所有带有 TransformComponent 和 SpriteComponent 的实体，
- * 并使用 Renderer 将它们绘制到屏幕上。
+ *
+ * 负责绘制所有带有 RenderComponent、TransformComponent 和 SpriteComponent 的实体。
+ *
+ * 绘制前先用相机视口查询空间索引，只有可能可见的实体才进入排序和绘制：
+ * - 静态网格：带有 StaticRenderTag 的实体 (瓦片、装饰物)，只在增删时重建；
+ * - 动态网格：其余实体 (单位、投射物等)，每帧增量更新，所在格子不变时几乎没有开销；
+ * - 带有 ParallaxComponent 的实体 (图片层) 位置不在世界坐标系中，不参与网格查询，
+ *   按滚动因子与重复标志由 Renderer::drawParallax 平铺绘制 (只生成可见的块)。
+ *
+ * 动态实体通过拥有 RenderComponent 与 SpriteComponent 的组遍历 (排除静态实体与视差图层)，
+ * 这两个组件不能再被其它组拥有。
+ *
+ * @note 剔除统计以 RenderStats& 的形式放入注册表上下文，供调试UI读取。
  */
 class RenderSystem {
+    entt::registry& registry_;
+
+    engine::spatial::SpatialGrid static_grid_;      ///< @brief 静态实体的空间索引
+    engine::spatial::SpatialGrid dynamic_grid_;     ///< @brief 动态实体的空间索引
+    bool static_dirty_{true};                       ///< @brief 静态实体有增删，需要重建静态网格
+
+    std::vector<entt::entity> candidates_;          ///< @brief 本帧的候选实体 (复用容量)
+    RenderStats stats_;
+
 public:
+    explicit RenderSystem(entt::registry& registry);
+    ~RenderSystem();
+
     /**
      * @brief 更新渲染系统
-     * 
-     * @param registry entt::registry 的引用
+     *
      * @param renderer Renderer 的引用
      * @param camera Camera 的引用
      */
-    void update(entt::registry& registry, render::Renderer& renderer, const render::Camera& camera);
+    void update(render::Renderer& renderer, const render::Camera& camera);
+
+    [[nodiscard]] const RenderStats& getStats() const { return stats_; }    ///< @brief 上一帧的剔除统计
+
+    void updateDynamicGrid();           ///< @brief 同步动态实体的包围盒 (update 开始时调用；基准测试不创建渲染器，单独计时这一步)
+
+private:
+    void rebuildStaticGrid();           ///< @brief 重建静态网格
+    [[nodiscard]] engine::utils::Rect getBounds(entt::entity entity) const;  ///< @brief 实体的世界包围盒 (含旋转)
+
+    // 注册表信号回调
+    void onStaticChanged(entt::registry& registry, entt::entity entity);        ///< @brief 静态实体增删，标记重建
+    void onRenderableDestroy(entt::registry& registry, entt::entity entity);    ///< @brief 从动态网格中移除
 };
 
-} // namespace engine::system 
\ No newline at end of file
+} // namespace engine::system
@@ -6,6 +6,8 @@
 
 namespace engine::ui {
 
+glm::vec2 UIElement::render_origin_{0.0f, 0.0f};
+
 UIElement::UIElement(glm::vec2 position, glm::vec2 size)
     : position_(std::move(position)), size_(std::move(size)) {
 }   
@@ -21,6 +23,7 @@ void UIElement::update(float delta_time, engine::core::Context& context) {
             ++it;
         } else {
             it = children_.erase(it);
+            markDirty();
         }
     }
 }
@@ -41,6 +44,7 @@ void UIElement::addChild(std::unique_ptr<UIElement> child, int order_index) {
             child->setOrderIndex(order_index);
         }
         children_.push_back(std::move(child));
+        markDirty();
     }
 }
 
@@ -55,6 +59,7 @@ std::unique_ptr<UIElement> UIElement::removeChild(UIElement* child_ptr) {
         std::unique_ptr<UIElement> removed_child = std::move(*it);
         children_.erase(it);
         removed_child->setParent(nullptr);      // 清除父指针
+        markDirty();
         return removed_child;                   // 返回被移除的子元素（可以挂载到别处）
     }
     return nullptr; // 未找到子元素
@@ -69,6 +74,7 @@ std::unique_ptr<UIElement> UIElement::removeChildById(entt::id_type id) {
         std::unique_ptr<UIElement> removed_child = std::move(*it);
         children_.erase(it);
         removed_child->setParent(nullptr);      // 清除父指针
+        markDirty();
         return removed_child;                   // 返回被移除的子元素（可以挂载到别处）
     }
     return nullptr; // 未找到子元素
@@ -79,6 +85,7 @@ void UIElement::removeAllChildren() {
         child->setParent(nullptr); // 清除父指针
     }
     children_.clear();
+    markDirty();
 }
 
 UIElement* UIElement::getChildById(entt::id_type id) const {
@@ -93,10 +100,64 @@ UIElement* UIElement::getChildById(entt::id_type id) const {
 }
 
 glm::vec2 UIElement::getScreenPosition() const {
-    if (parent_) {
-        return parent_->getScreenPosition() + position_;
+    // 只有自身或祖先移动过才重新计算，否则直接返回缓存
+    if (transform_dirty_) {
+        // 根元素的位置已经是相对屏幕的绝对位置
+        screen_position_ = parent_ ? parent_->getScreenPosition() + position_ : position_;
+        transform_dirty_ = false;
+    }
+    return screen_position_;
+}
+
+glm::vec2 UIElement::getRenderPosition() const {
+    return getScreenPosition() - render_origin_;
+}
+
+void UIElement::setSize(glm::vec2 size) {
+    if (size == size_) return;
+    size_ = std::move(size);
+    markDirty();
+}
+
+void UIElement::setVisible(bool visible) {
+    if (visible == visible_) return;
+    visible_ = visible;
+    markDirty();
+}
+
+void UIElement::setParent(UIElement* parent) {
+    parent_ = parent;
+    markTransformDirty();
+}
+
+void UIElement::setPosition(glm::vec2 position) {
+    if (position == position_) return;
+    position_ = std::move(position);
+    markTransformDirty();
+    // 自身的缓存内容与位置无关，只需让父节点重新绘制
+    if (parent_) parent_->markDirty();
+}
+
+void UIElement::markDirty() {
+    // 一直传播到根节点 (层级很浅)，保证所有开启缓存的祖先都能感知到变化
+    for (auto* element = this; element; element = element->parent_) {
+        element->dirty_ = true;
+    }
+}
+
+void UIElement::clearDirty() {
+    dirty_ = false;
+    for (const auto& child : children_) {
+        if (child) child->clearDirty();
+    }
+}
+
+void UIElement::markTransformDirty() {
+    if (transform_dirty_) return;   // 已失效说明子树也已失效 (子树位置依赖于自身)
+    transform_dirty_ = true;
+    for (const auto& child : children_) {
+        if (child) child->markTransformDirty();
     }
-    return position_; // 根元素的位置已经是相对屏幕的绝对位置
 }
 
 void UIElement::sortChildrenByOrderIndex() {
@@ -104,6 +165,7 @@ void UIElement::sortChildrenByOrderIndex() {
     std::stable_sort(children_.begin(), children_.end(), [](const std::unique_ptr<UIElement>& a, const std::unique_ptr<UIElement>& b) {
         return a->getOrderIndex() < b->getOrderIndex();
     });
+    markDirty();
 }
 
 engine::utils::Rect UIElement::getBounds() const {
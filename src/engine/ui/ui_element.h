@@ -21,6 +21,11 @@ namespace engine::ui {
  * 组合模式
  * 组合模式的精髓在于，它允许我们将对象组合成树形结构，并且可以用同样的方式去对待单个对象（叶子节点）和对象组合（树枝节点）。
  * 无论你操作的是"叶子节点"（单个对象）还是"树枝节点"（包含子对象的组合对象），都可以用完全一样的代码来调用它们的方法，无需区分类型。
+ *
+ * 保留模式 (retained mode)：
+ * - 屏幕位置会被缓存，只有自身或祖先的位置变化时才重新计算；
+ * - 任何影响显示的修改都会调用 markDirty()，脏标记沿父链向上传播，
+ *   开启了渲染缓存的面板 (UIPanel) 据此判断是否需要重新光栅化其子树。
  */
 class UIElement {
 protected:
@@ -34,6 +39,12 @@ protected:
     UIElement* parent_ = nullptr;                           ///< @brief 指向父节点的非拥有指针
     std::vector<std::unique_ptr<UIElement>> children_;      ///< @brief 子元素列表(容器)
 
+    mutable glm::vec2 screen_position_{0.0f, 0.0f};         ///< @brief 缓存的屏幕位置
+    mutable bool transform_dirty_ = true;                   ///< @brief 屏幕位置缓存是否失效
+    bool dirty_ = true;                                     ///< @brief 显示内容是否有变化 (自身或子树)
+
+    static glm::vec2 render_origin_;                        ///< @brief 当前绘制的原点 (渲染到缓存纹理时为缓存面板的屏幕位置)
+
 public:
     /**
      * @brief 构造UIElement
@@ -69,10 +80,12 @@ public:
     UIElement* getChildById(entt::id_type id) const;                                    ///< @brief 根据ID获取子元素
     entt::id_type getId() const { return id_; }                                         ///< @brief 获取自身的ID
 
-    void setSize(glm::vec2 size) { size_ = std::move(size); }           ///< @brief 设置元素大小
-    void setVisible(bool visible) { visible_ = visible; }           ///< @brief 设置元素的可见性
-    void setParent(UIElement* parent) { parent_ = parent; }         ///< @brief 设置父节点
-    void setPosition(glm::vec2 position) { position_ = std::move(position); }   ///< @brief 设置元素位置(相对于父节点)
+    bool isDirty() const { return dirty_; }                                             ///< @brief 显示内容是否有变化
+
+    void setSize(glm::vec2 size);                                   ///< @brief 设置元素大小
+    void setVisible(bool visible);                                  ///< @brief 设置元素的可见性
+    void setParent(UIElement* parent);                              ///< @brief 设置父节点
+    void setPosition(glm::vec2 position);                           ///< @brief 设置元素位置(相对于父节点)
     void setNeedRemove(bool need_remove) { need_remove_ = need_remove; }    ///< @brief 设置元素是否需要移除
     void setOrderIndex(int order_index) { order_index_ = order_index; }     ///< @brief 设置元素的排序索引
     void setId(entt::id_type id) { id_ = id; }                              ///< @brief 设置元素的ID
@@ -82,8 +95,20 @@ public:
     // --- 辅助方法 ---
     engine::utils::Rect getBounds() const;                          ///< @brief 获取(计算)元素的边界(屏幕坐标)
     glm::vec2 getScreenPosition() const;                            ///< @brief 获取(计算)元素在屏幕上位置
+    glm::vec2 getRenderPosition() const;                            ///< @brief 获取绘制位置 (屏幕位置减去当前绘制原点)
     bool isPointInside(const glm::vec2& point) const;               ///< @brief 检查给定点是否在元素的边界内
 
+    // --- 保留模式 ---
+    void markDirty();                                               ///< @brief 标记显示内容变化，并通知所有祖先
+    void clearDirty();                                              ///< @brief 清除自身及子树的脏标记 (子树被重新绘制后调用)
+
+protected:
+    void markTransformDirty();                                      ///< @brief 使自身及子树的屏幕位置缓存失效
+    static void setRenderOrigin(const glm::vec2& origin) { render_origin_ = origin; }
+    static const glm::vec2& getRenderOrigin() { return render_origin_; }
+
+public:
+
     // --- 禁用拷贝和移动语义 ---
     UIElement(const UIElement&) = delete;
     UIElement& operator=(const UIElement&) = delete;
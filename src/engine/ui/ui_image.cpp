@@ -55,7 +55,7 @@ void UIImage::render(engine::core::Context& context) {
     }
 
     // 渲染自身
-    auto position = getScreenPosition();
+    auto position = getRenderPosition();
     if (size_.x == 0.0f && size_.y == 0.0f) {   // 如果尺寸为0，则使用纹理的原始尺寸
         context.getRenderer().drawUIImage(image_, position);
     } else {
@@ -66,17 +66,17 @@ public:
 
     // --- Setters & Getters ---
     const engine::render::Image& getImage() const { return image_; }
-    void setImage(engine::render::Image image) { image_ = std::move(image); }
+    void setImage(engine::render::Image image) { image_ = std::move(image); markDirty(); }
 
     std::string_view getTexturePath() const { return image_.getTexturePath(); }
     entt::id_type getTextureId() const { return image_.getTextureId(); }
-    void setTexture(std::string_view texture_path) { image_.setTexture(texture_path); }
+    void setTexture(std::string_view texture_path) { image_.setTexture(texture_path); markDirty(); }
 
     const std::optional<engine::utils::Rect>& getSourceRect() const { return image_.getSourceRect(); }
-    void setSourceRect(std::optional<engine::utils::Rect> source_rect) { image_.setSourceRect(std::move(source_rect)); }
+    void setSourceRect(std::optional<engine::utils::Rect> source_rect) { image_.setSourceRect(std::move(source_rect)); markDirty(); }
 
     bool isFlipped() const { return image_.isFlipped(); }
-    void setFlipped(bool flipped) { image_.setFlipped(flipped); }
+    void setFlipped(bool flipped) { image_.setFlipped(flipped); markDirty(); }
 };
 
 } // namespace engine::ui
\ No newline at end of file
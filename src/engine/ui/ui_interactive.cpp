@@ -39,16 +39,19 @@ void UIInteractive::addImage(entt::id_type name_id, engine::render::Image image)
 {
     // 可交互UI元素必须有一个size用于交互检测，因此如果参数列表中没有指定，则用图片大小作为size
     if (size_.x == 0.0f && size_.y == 0.0f) {
-        size_ = context_.getResourceManager().getTextureSize(image.getTextureId());
+        size_ = context_.getResourceManager().getTextureSize(image.getTextureId(), image.getTexturePath());
     }
     // 添加图片 (如果name_id已存在，则替换)
     images_.insert_or_assign(name_id, std::move(image));
+    markDirty();
 }
 
 void UIInteractive::setCurrentImage(entt::id_type name_id)
 {
     if (images_.find(name_id) != images_.end()) {
+        if (current_image_id_ == name_id) return;
         current_image_id_ = name_id;
+        markDirty();
     } else {
         spdlog::warn("Image '{}' not found.", name_id);
     }
@@ -101,7 +104,7 @@ void UIInteractive::render(engine::core::Context &context)
     if (!visible_ ) return;
 
     // 先渲染自身
-    context.getRenderer().drawUIImage(images_[current_image_id_], getScreenPosition(), size_);
+    context.getRenderer().drawUIImage(images_[current_image_id_], getRenderPosition(), size_);
 
     // 再渲染子元素（调用基类方法）
     UIElement::render(context);
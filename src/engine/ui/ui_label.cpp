@@ -26,7 +26,7 @@ UILabel::UILabel(engine::render::TextRenderer& text_renderer,
 void UILabel::render(engine::core::Context& context) {
     if (!visible_ || text_.empty()) return;
 
-    text_renderer_.drawUIText(text_, font_id_, font_size_, getScreenPosition(), text_fcolor_);
+    text_renderer_.drawUIText(text_, font_id_, font_size_, getRenderPosition(), text_fcolor_, font_path_);
 
     // 渲染子元素（调用基类方法）
     UIElement::render(context);
@@ -34,8 +34,10 @@ void UILabel::render(engine::core::Context& context) {
 
 void UILabel::setText(std::string_view text)
 {
+    if (text == text_) return;
     text_ = text;
     size_ = text_renderer_.getTextSize(text_, font_id_, font_size_, font_path_);
+    markDirty();
 }
 
 void UILabel::setFontPath(std::string_view font_path)
@@ -43,18 +45,21 @@ void UILabel::setFontPath(std::string_view font_path)
     font_path_ = font_path;
     font_id_ = entt::hashed_string(font_path.data());
     size_ = text_renderer_.getTextSize(text_, font_id_, font_size_, font_path_);
+    markDirty();
 }
 
 void UILabel::setFontSize(int font_size)
 {
     font_size_ = font_size;
     size_ = text_renderer_.getTextSize(text_, font_id_, font_size_, font_path_);
+    markDirty();
 }
 
 void UILabel::setTextFColor(engine::utils::FColor text_fcolor)
 {
     text_fcolor_ = std::move(text_fcolor);
     /* 颜色变化不影响尺寸 */
+    markDirty();
 }
 
 } // namespace engine::ui
\ No newline at end of file
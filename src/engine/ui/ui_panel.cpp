@@ -2,24 +2,80 @@
 #include "../core/context.h"
 #include "../render/renderer.h"
 #include <SDL3/SDL_pixels.h>
+#include <SDL3/SDL_render.h>
 #include <spdlog/spdlog.h>
 
 namespace engine::ui {
 
+void UIPanel::SDLTextureDeleter::operator()(SDL_Texture* texture) const {
+    if (!texture) return;
+    if (renderer_) {
+        renderer_->destroyTexture(texture);
+    } else {
+        SDL_DestroyTexture(texture);
+    }
+}
+
 UIPanel::UIPanel(glm::vec2 position, glm::vec2 size, std::optional<engine::utils::FColor> background_color)
     : UIElement(std::move(position), std::move(size)), background_color_(std::move(background_color))
 {
     spdlog::trace("UIPanel constructed successfully.");
 }
 
+UIPanel::~UIPanel() = default;
+
+void UIPanel::setRenderCached(bool cached) {
+    render_cached_ = cached;
+    if (!render_cached_) {
+        cache_texture_.reset();
+    }
+    markDirty();
+}
+
 void UIPanel::render(engine::core::Context& context) {
     if (!visible_) return;
 
+    if (!render_cached_) {
+        renderContent(context);
+        return;
+    }
+
+    // 只有子树内容变化时才重新光栅化，失败时退回直接绘制
+    if ((dirty_ || !cache_texture_) && !rebuildCache(context)) {
+        renderContent(context);
+        return;
+    }
+    context.getRenderer().drawUITexture(cache_texture_.get(), engine::utils::Rect(getRenderPosition(), cache_size_));
+}
+
+void UIPanel::renderContent(engine::core::Context& context) {
     if (background_color_) {
-        context.getRenderer().drawUIFilledRect(getBounds(), background_color_.value());
+        context.getRenderer().drawUIFilledRect(engine::utils::Rect(getRenderPosition(), size_), background_color_.value());
     }
 
     UIElement::render(context); // 调用基类渲染方法(绘制子节点)
 }
 
-} // namespace engine::ui 
\ No newline at end of file
+bool UIPanel::rebuildCache(engine::core::Context& context) {
+    auto& renderer = context.getRenderer();
+    // 尺寸变化时重建纹理
+    if (!cache_texture_ || cache_size_ != size_) {
+        cache_texture_ = std::unique_ptr<SDL_Texture, SDLTextureDeleter>(renderer.createRenderTarget(size_), SDLTextureDeleter{&renderer});
+        cache_size_ = size_;
+        if (!cache_texture_) return false;
+    }
+    if (!renderer.pushRenderTarget(cache_texture_.get())) return false;
+
+    // 以自身的屏幕位置作为绘制原点，子树的绘制位置即为相对于面板的位置
+    const auto previous_origin = getRenderOrigin();
+    setRenderOrigin(getScreenPosition());
+    renderContent(context);
+    setRenderOrigin(previous_origin);
+
+    renderer.popRenderTarget();
+    clearDirty();
+    spdlog::trace("UIPanel {} cache rebuilt.", id_);
+    return true;
+}
+
+} // namespace engine::ui
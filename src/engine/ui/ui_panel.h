@@ -2,8 +2,15 @@
 
 #include "ui_element.h"
 #include <optional>
+#include <memory>
 #include "../utils/math.h"
 
+struct SDL_Texture;
+
+namespace engine::render {
+class Renderer;
+}
+
 namespace engine::ui {
 
 /**
@@ -11,10 +18,22 @@ namespace engine::ui {
  *
  * Panel通常用于布局和组织。
  * 可以选择是否绘制背景色(纯色)。
+ * 可以开启渲染缓存：子树被光栅化到一张纹理中，只有子树内容变化(脏标记)时才重新绘制，
+ * 其余帧只需一次纹理绘制。适合内容很少变化的面板（如单位肖像栏）。
  */
 class UIPanel final : public UIElement {
+    /// @brief 缓存纹理的删除器 (通过渲染器销毁，录制命令时延迟到命令执行之后)
+    struct SDLTextureDeleter {
+        engine::render::Renderer* renderer_;    ///< @brief unique_ptr 默认构造时值初始化为空
+        void operator()(SDL_Texture* texture) const;
+    };
+
     std::optional<engine::utils::FColor> background_color_;    ///< @brief 可选背景色
 
+    bool render_cached_ = false;                                        ///< @brief 是否开启渲染缓存
+    std::unique_ptr<SDL_Texture, SDLTextureDeleter> cache_texture_;     ///< @brief 缓存的子树纹理
+    glm::vec2 cache_size_{0.0f, 0.0f};                                  ///< @brief 缓存纹理对应的面板尺寸
+
 public:
     /**
      * @brief 构造一个Panel
@@ -25,11 +44,19 @@ public:
      */
     explicit UIPanel(glm::vec2 position = {0.0f, 0.0f}, glm::vec2 size = {0.0f, 0.0f},
                      std::optional<engine::utils::FColor> background_color = std::nullopt);
+    ~UIPanel() override;
 
-    void setBackgroundColor(std::optional<engine::utils::FColor> background_color) { background_color_ = std::move(background_color); }
+    void setBackgroundColor(std::optional<engine::utils::FColor> background_color) { background_color_ = std::move(background_color); markDirty(); }
     const std::optional<engine::utils::FColor>& getBackgroundColor() const { return background_color_; }
 
+    void setRenderCached(bool cached);                                  ///< @brief 开启/关闭渲染缓存 (子元素超出面板范围的部分会被裁剪)
+    bool isRenderCached() const { return render_cached_; }
+
     void render(engine::core::Context& context) override;
+
+private:
+    void renderContent(engine::core::Context& context);                 ///< @brief 直接绘制背景与子元素
+    bool rebuildCache(engine::core::Context& context);                  ///< @brief 将子树重新光栅化到缓存纹理
 };
 
-} // namespace engine::ui
\ No newline at end of file
+} // namespace engine::ui
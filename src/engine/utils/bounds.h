@@ -0,0 +1,29 @@
+#pragma once
+
+#include "math.h"
+#include "../component/transform_component.h"
+#include "../component/sprite_component.h"
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+namespace engine::utils {
+
+/**
+ * @brief 计算精灵在世界坐标下的包围盒
+ * @param transform 变换组件
+ * @param sprite 精灵组件
+ * @return 包围盒 (有旋转时，用绕精灵中心旋转的外接圆的包围盒保守估计)
+ */
+inline Rect getSpriteBounds(const engine::component::TransformComponent& transform,
+                            const engine::component::SpriteComponent& sprite) {
+    const auto position = transform.position_ + sprite.offset_;
+    const auto size = glm::abs(sprite.size_ * transform.scale_);
+    if (transform.rotation_ == 0.0f) {
+        return {position, size};
+    }
+    const auto center = position + size * 0.5f;
+    const float radius = glm::length(size) * 0.5f;
+    return {center - glm::vec2(radius), glm::vec2(radius * 2.0f)};
+}
+
+} // namespace engine::utils
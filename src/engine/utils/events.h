@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <entt/entity/entity.hpp>
 
 namespace engine::scene {
@@ -44,4 +45,11 @@ struct PlaySoundEvent {
     entt::id_type sound_id_{entt::null};        ///< @brief 音效ID
 };
 
+/// @brief 存档写入完成事件 (由 SaveService 在主线程中加入事件队列)
+struct SaveCompletedEvent {
+    std::string path_;                          ///< @brief 存档路径
+    bool success_{false};                       ///< @brief 是否成功
+    std::string error_;                         ///< @brief 失败时的错误信息
+};
+
 } // namespace engine::utils
\ No newline at end of file
@@ -2,7 +2,6 @@
 
 #include <glm/vec2.hpp>
 #include <string_view>
-#include <random>
 
 namespace engine::utils {
 
@@ -79,19 +78,6 @@ struct FColor
     };
 }
 
-/**
- * @brief 生成指定范围内的随机整数 [min, max]
- * @param min 最小值（包含）
- * @param max 最大值（包含）
- * @return 随机整数
- */
- inline int randomInt(int min, int max) {
-    // static thread_local 表示该变量在每个线程中各自独立，互不影响，避免多线程下的竞争条件
-    static thread_local std::mt19937 generator{std::random_device{}()};
-    std::uniform_int_distribution<int> distribution(min, max);
-    return distribution(generator);
-}
-
 /**
  * @brief 根据等级和稀有度修改属性
  * @param base 基础属性
@@ -114,16 +100,4 @@ inline float distanceSquared(const glm::vec2& a, const glm::vec2& b) {
     return (a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y);
 }
 
-/**
- * @brief 打乱容器中元素的顺序（Fisher-Yates 洗牌算法）
- * @tparam RandomIt 随机访问迭代器类型
- * @param first 容器起始迭代器
- * @param last 容器结束迭代器
- */
-template<typename RandomIt>
-void shuffle(RandomIt first, RandomIt last) {
-    static thread_local std::mt19937 generator{std::random_device{}()};
-    std::shuffle(first, last, generator);
-}
-
 } // namespace engine::utils
\ No newline at end of file
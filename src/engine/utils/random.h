@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+namespace engine::utils {
+
+/**
+ * @brief 可指定种子的随机数生成器。
+ *
+ * 每个场景持有一个实例 (放在注册表上下文中)，模拟中用到的随机数都从这里取，
+ * 相同的种子与相同的输入可以得到完全相同的对局 (确定性模式与录像回放依赖于此)。
+ * 生成器的状态随场景快照一起保存，快速读档、重开关卡后随机序列也能复现。
+ */
+class Random final {
+    std::uint32_t seed_;
+    std::mt19937 generator_;
+
+public:
+    /// @brief 使用指定种子构造
+    explicit Random(std::uint32_t seed) : seed_(seed), generator_(seed) {}
+    /// @brief 使用随机种子构造
+    Random() : Random(std::random_device{}()) {}
+
+    /// @brief 重新设置种子 (随机序列从头开始)
+    void reseed(std::uint32_t seed) {
+        seed_ = seed;
+        generator_.seed(seed);
+    }
+
+    /**
+     * @brief 生成指定范围内的随机整数 [min, max]
+     * @param min 最小值（包含）
+     * @param max 最大值（包含）
+     * @return 随机整数
+     */
+    int randomInt(int min, int max) {
+        std::uniform_int_distribution<int> distribution(min, max);
+        return distribution(generator_);
+    }
+
+    /**
+     * @brief 打乱容器中元素的顺序
+     * @tparam RandomIt 随机访问迭代器类型
+     * @param first 容器起始迭代器
+     * @param last 容器结束迭代器
+     */
+    template <typename RandomIt>
+    void shuffle(RandomIt first, RandomIt last) {
+        std::shuffle(first, last, generator_);
+    }
+
+    [[nodiscard]] std::uint32_t getSeed() const { return seed_; }
+
+    /// @brief 读写快照 (保存生成器的完整状态)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(seed_, generator_);
+    }
+};
+
+} // namespace engine::utils
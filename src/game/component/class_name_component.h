@@ -13,6 +13,11 @@ namespace game::component {
 struct ClassNameComponent {
     entt::id_type class_id_{entt::null};
     std::string class_name_;                // 可以是中文，主要用于显示
+
+    template <typename Archive>
+    void serialize(Archive& archive) {      // 读写快照
+        archive(class_id_, class_name_);
+    }
 };
 
 }   // namespace game::component
\ No newline at end of file
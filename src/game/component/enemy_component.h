@@ -3,11 +3,12 @@
 namespace game::component {
 
 /**
- * @brief 敌人组件，包含目标节点ID和自身速度。
+ * @brief 敌人组件，包含目标节点ID、自身速度和到终点的剩余路程。
  */
 struct EnemyComponent {
     int target_waypoint_id_;
     float speed_;
+    float path_distance_{};     // 沿路径到终点的剩余路程（由 EnemyPathIndex 更新，用于玩家单位选择目标）
 };
 
 }   // namespace game::component
\ No newline at end of file
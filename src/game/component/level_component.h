@@ -0,0 +1,15 @@
+#pragma once
+
+namespace game::component {
+
+/**
+ * @brief 等级组件，保存单位的等级和稀有度。
+ * 等级和稀有度只在生成单位时参与属性计算，之后只有界面会读取，
+ * 因此与每帧读取的 StatsComponent 分开存放，不占用战斗与索敌遍历的缓存。
+ */
+struct LevelComponent {
+    int level_{1};
+    int rarity_{1};             // 稀有度，从1开始（例如1:普通，2:稀有，3:史诗，4:传说，5:神话...）
+};
+
+}   // namespace game::component
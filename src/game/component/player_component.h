@@ -1,10 +1,13 @@
 #pragma once
 
+#include "../defs/constants.h"
+
 namespace game::component {
 
-/// @brief 玩家组件，存储出击消耗
+/// @brief 玩家组件，存储出击消耗与选择攻击目标的优先级
 struct PlayerComponent {
     int cost_{};
+    game::defs::TargetPolicy target_policy_{game::defs::TargetPolicy::FIRST};
 };
 
 }   // namespace game::component
\ No newline at end of file
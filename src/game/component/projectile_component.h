@@ -15,6 +15,9 @@ struct ProjectileComponent {
     float arc_height_{};                    ///< @brief 弧度高度(即正弦函数振幅)
     float total_flight_time_{};             ///< @brief 总飞行时间
     float current_flight_time_{};           ///< @brief 当前飞行时间
+    float splash_radius_{};                 ///< @brief 溅射半径 (0 表示只命中目标)
+    float splash_falloff_{};                ///< @brief 溅射衰减 (边缘处减少的比例)
+    bool target_is_player_{false};          ///< @brief 目标是否为玩家单位 (溅射只影响与目标同阵营的单位)
 };
 
 /// @brief 投射物ID组件, 附加在远程攻击角色上
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../../engine/core/timer_handle.h"
 #include <entt/entity/entity.hpp>
 #include <string>
 
@@ -16,8 +17,14 @@ struct SkillComponent {
     std::string description_;                   ///< @brief 技能描述
     float cooldown_{0.0f};                      ///< @brief 技能冷却时间
     float duration_{0.0f};                      ///< @brief 技能持续时间
-    float cooldown_timer_{0.0f};                ///< @brief 技能冷却计时器
-    float duration_timer_{0.0f};                ///< @brief 技能持续计时器
+    engine::core::TimerHandle cooldown_timer_{};    ///< @brief 技能冷却计时器 (时间轮句柄)
+    engine::core::TimerHandle duration_timer_{};    ///< @brief 技能持续计时器 (时间轮句柄)
+
+    /// @brief 读写快照 (计时器句柄与时间轮一起保存，恢复后仍然有效)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(skill_id_, display_entity_, name_, description_, cooldown_, duration_, cooldown_timer_, duration_timer_);
+    }
 };
 
 }   // namespace game::component
\ No newline at end of file
@@ -50,6 +50,7 @@ struct PlayerBlueprint {
     bool healer_{false};
     int block_{0};
     int cost_{0};
+    game::defs::TargetPolicy target_policy_{game::defs::TargetPolicy::FIRST};
 };
 
 /// @brief 敌人蓝图, 用于创建敌人组件（EnemyComponent）
@@ -90,6 +91,12 @@ struct EnemyClassBlueprint {
     std::unordered_map<entt::id_type, AnimationBlueprint> animations_;
 };
 
+/// @brief 范围效果蓝图 (溅射伤害、治疗脉冲等)，半径为0时没有范围效果
+struct SplashBlueprint {
+    float radius_{0.0f};        ///< @brief 作用半径
+    float falloff_{0.0f};       ///< @brief 衰减：边缘处减少的比例 (0 表示不衰减，1 表示边缘处为0)
+};
+
 /// @brief 投射物蓝图, 用于创建投射物组件
 struct ProjectileBlueprint {
     entt::id_type id_{entt::null};
@@ -98,6 +105,7 @@ struct ProjectileBlueprint {
     float total_flight_time_{};
     SpriteBlueprint sprite_{};
     SoundBlueprint sounds_{};
+    SplashBlueprint splash_{};      ///< @brief 溅射 (命中点周围的其它单位受到衰减后的伤害)
 };
 
 /// @brief 特效蓝图, 生成特效实体时使用
@@ -127,6 +135,8 @@ struct SkillBlueprint {
     float cooldown_{0.0f};
     float duration_{0.0f};
     BuffBlueprint buff_;
+    SplashBlueprint pulse_{};       ///< @brief 治疗脉冲 (激活时治疗半径内的友军)
+    float pulse_heal_{0.0f};        ///< @brief 治疗脉冲中心处的治疗量 (施放者攻击力的倍数)
 };
 
 }   // namespace game::data
\ No newline at end of file
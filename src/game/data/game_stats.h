@@ -11,6 +11,7 @@ struct GameStats {
     float cost_{10.0f};                 ///< @brief 可用cost
     float cost_gen_per_second_{1.0f};   ///< @brief cost生成速率
     int home_hp_{5};                    ///< @brief 基地血量
+    int max_home_hp_{5};                ///< @brief 基地最大血量 (关卡配置)
     int enemy_count_{0};                ///< @brief 敌人(总)数量
     int enemy_arrived_count_{0};        ///< @brief 敌人到达数量
     int enemy_killed_count_{0};         ///< @brief 敌人击杀数量
@@ -1,4 +1,5 @@
 #include "level_config.h"
+#include <algorithm>
 #include <filesystem>   
 #include <fstream>
 #include <utility>
@@ -33,6 +34,7 @@ bool LevelConfig::loadFromFile(std::string_view level_json_path) {
             level_data.map_path_ = data["map_path"].get<std::string>();
             level_data.prep_time_ = data["prep_time"].get<float>();
             level_data.enemy_rarity_ = data["enemy_rarity"].get<int>();
+            level_data.home_hp_ = data.value("home_hp", level_data.home_hp_);
 
             int total_enemy_count = 0;
             if (data.contains("waves") && data["waves"].is_array()) {
@@ -41,6 +43,7 @@ bool LevelConfig::loadFromFile(std::string_view level_json_path) {
                     game::data::Wave wave_data;
                     wave_data.next_wave_interval_ = wave["next_wave_interval"].get<float>();
                     wave_data.spawn_interval_ = wave["spawn_interval"].get<float>();
+                    wave_data.spawn_count_ = std::max(1, wave.value("spawn_count", 1));
                     // 每个波次中，保存了敌人类型和对应的数量
                     for (const auto& [enemy_type, count] : wave["enemy_types"].items()) {
                         entt::id_type type_id = entt::hashed_string(enemy_type.c_str());
@@ -51,6 +54,18 @@ bool LevelConfig::loadFromFile(std::string_view level_json_path) {
                     level_data.waves_data_.waves_.push(std::move(wave_data)); // 将波次数据加入关卡数据
                 }
             }
+            // 预置单位 (可选)
+            if (data.contains("preset_units") && data["preset_units"].is_array()) {
+                for (const auto& unit : data["preset_units"]) {
+                    game::data::PresetUnit preset_unit;
+                    preset_unit.class_name_ = unit["class"].get<std::string>();
+                    preset_unit.class_id_ = entt::hashed_string(preset_unit.class_name_.c_str());
+                    preset_unit.count_ = unit.value("count", 1);
+                    preset_unit.level_ = unit.value("level", 1);
+                    preset_unit.rarity_ = unit.value("rarity", 1);
+                    level_data.preset_units_.push_back(std::move(preset_unit));
+                }
+            }
             level_data.total_enemy_count_ = total_enemy_count;
             spdlog::info("level {} total enemy count: {}", level_data.level_number_, total_enemy_count);
 
@@ -71,4 +86,11 @@ bool LevelConfig::loadFromFile(std::string_view level_json_path) {
     return true;
 }
 
+int LevelConfig::addLevel(game::data::LevelData level_data) {
+    level_data.level_number_ = getLevelCount() + 1;
+    spdlog::info("add level {}: '{}', total enemy count: {}", level_data.level_number_, level_data.name_, level_data.total_enemy_count_);
+    level_data_.push_back(std::move(level_data));
+    return getLevelCount();
+}
+
 }   // namespace game::data
\ No newline at end of file
@@ -14,6 +14,7 @@ class LevelConfig {
 
 public:
     bool loadFromFile(std::string_view level_json_path = "assets/data/level_config.json");  ///< @brief 加载关卡配置文件
+    int addLevel(game::data::LevelData level_data);     ///< @brief 添加一关 (例如程序生成的关卡)，返回其关卡编号
 
     // --- getters （获取指定关卡编号的对应数据） --- （关卡编号从1开始，数组角标从0开始，因此每次获取时需要减1）
     [[nodiscard]] game::data::LevelData& getLevelData(int level_number) { return level_data_[level_number - 1]; }
@@ -25,6 +26,8 @@ public:
     [[nodiscard]] bool isFinalLevel(int level_number) const { return level_number == getLevelCount(); }
     [[nodiscard]] int getEnemyLevel(int level_number) const { return level_data_[level_number - 1].enemy_level_; }
     [[nodiscard]] int getEnemyRarity(int level_number) const { return level_data_[level_number - 1].enemy_rarity_; }
+    [[nodiscard]] int getHomeHp(int level_number) const { return level_data_[level_number - 1].home_hp_; }
+    [[nodiscard]] const std::vector<game::data::PresetUnit>& getPresetUnits(int level_number) const { return level_data_[level_number - 1].preset_units_; }
 };
 
 }   // namespace game::data
\ No newline at end of file
@@ -10,12 +10,18 @@ namespace game::data {
 
 /**
  * @brief 单一波次数据
- * @note 包含下一波次间隔、本波次敌人生成间隔和“本波次敌人类型-数量”对
+ * @note 包含下一波次间隔、本波次敌人生成间隔、每次生成数量和“本波次敌人类型-数量”对
  */
 struct Wave {
     float next_wave_interval_{};    ///< @brief 下一波次间隔（单位：秒）
     float spawn_interval_{};        ///< @brief 本波次敌人生成间隔（单位：秒）
+    int spawn_count_{1};            ///< @brief 每个生成间隔生成的敌人数量（大规模波次使用，避免生成速度受帧率限制）
     std::vector<std::pair<entt::id_type, int>> enemy_types_; ///< @brief 敌人类型-数量对
+
+    template <typename Archive>
+    void serialize(Archive& archive) {  ///< @brief 读写快照
+        archive(next_wave_interval_, spawn_interval_, spawn_count_, enemy_types_);
+    }
 };
 
 /**
@@ -25,11 +31,28 @@ struct Wave {
 struct Waves {
     float next_wave_count_down_{};  ///< @brief 下一波次倒计时（单位：秒）
     std::queue<Wave> waves_;        ///< @brief 波次队列
+
+    template <typename Archive>
+    void serialize(Archive& archive) {  ///< @brief 读写快照
+        archive(next_wave_count_down_, waves_);
+    }
+};
+
+/**
+ * @brief 关卡开始时预先放置的玩家单位
+ * @note 依次放置在空闲的对应类型地点上（近战/远程），地点不足时多余的单位不放置
+ */
+struct PresetUnit {
+    entt::id_type class_id_{};      ///< @brief 职业ID
+    std::string class_name_;        ///< @brief 职业名称
+    int count_{1};                  ///< @brief 数量
+    int level_{1};                  ///< @brief 等级
+    int rarity_{1};                 ///< @brief 稀有度
 };
 
 /**
  * @brief 关卡数据，包含一关中的波次数据及其他必要信息
- * @note 关卡号、敌人等级、敌人稀有度、关卡名称、地图路径、准备时间、总敌人数量
+ * @note 关卡号、敌人等级、敌人稀有度、关卡名称、地图路径、准备时间、基地血量、总敌人数量、预置单位
  */
 struct LevelData {
     int level_number_{1};           ///< @brief 关卡号
@@ -38,8 +61,10 @@ struct LevelData {
     std::string name_;              ///< @brief 关卡名称
     std::string map_path_;          ///< @brief 地图路径
     float prep_time_{5.0f};         ///< @brief 开局准备时间（单位：秒）
+    int home_hp_{5};                ///< @brief 基地血量
     int total_enemy_count_{0};      ///< @brief 总敌人数量
     Waves waves_data_;              ///< @brief 波次数据
+    std::vector<PresetUnit> preset_units_;  ///< @brief 开局时预先放置的玩家单位
 };
 
 }
\ No newline at end of file
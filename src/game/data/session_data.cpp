@@ -1,12 +1,46 @@
 #include "session_data.h"
+#include "../../engine/core/save_service.h"
+#include "../../engine/serialization/binary_archive.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <filesystem>
+#include <iterator>
 #include <spdlog/spdlog.h>
 #include <nlohmann/json.hpp>
 #include <entt/core/hashed_string.hpp>
 
 namespace game::data {
 
+namespace {
+
+/// @brief 二进制存档文件头：魔数 + 版本号 (字段变化时递增版本号)
+constexpr std::array<char, 4> BINARY_MAGIC{'M', 'W', 'S', 'V'};
+constexpr std::uint32_t BINARY_VERSION = 1;
+
+} // namespace
+
+SessionData::SessionData(const SessionData& other)
+    : level_number_(other.level_number_),
+      point_(other.point_),
+      level_clear_(other.level_clear_),
+      unit_map_(other.unit_map_) {
+    mapUnitDataList();
+}
+
+SessionData& SessionData::operator=(const SessionData& other) {
+    if (this != &other) {
+        level_number_ = other.level_number_;
+        point_ = other.point_;
+        level_clear_ = other.level_clear_;
+        unit_map_ = other.unit_map_;
+        mapUnitDataList();
+    }
+    return *this;
+}
+
 bool SessionData::loadDefaultData(std::string_view path) {
     if (!std::filesystem::exists(path)) {
         spdlog::error("Session data file not found: {}", path);
@@ -48,25 +82,52 @@ bool SessionData::loadDefaultData(std::string_view path) {
 }
 
 bool SessionData::loadFromFile(std::string_view path) {
-    return loadDefaultData(path);
-}
-
-bool SessionData::saveToFile(std::string_view path) {
-    std::filesystem::path file_path = path;
-    // 如果父目录不存在，则自动创建
-    if (!file_path.parent_path().empty() && !std::filesystem::exists(file_path.parent_path())) {
-        try {
-            std::filesystem::create_directories(file_path.parent_path());
-        } catch (const std::exception& e) {
-            spdlog::error("not create directory {}: {}", file_path.parent_path().string(), e.what());
-            return false;
-        }
-    }
-    std::ofstream file(file_path);
+    std::ifstream file(std::filesystem::path(path), std::ios::binary);
     if (!file.is_open()) {
         spdlog::error("not open save file: {}", path);
         return false;
     }
+    // 以魔数开头的是二进制存档，否则按JSON读取
+    std::array<char, BINARY_MAGIC.size()> magic{};
+    if (!file.read(magic.data(), magic.size()) || magic != BINARY_MAGIC) {
+        file.close();
+        return loadDefaultData(path);
+    }
+    file.seekg(0);
+    std::vector<std::byte> buffer;
+    std::transform(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>(),
+                   std::back_inserter(buffer), [](char c) { return static_cast<std::byte>(c); });
+    file.close();
+    if (!decodeBinary(buffer)) {
+        spdlog::error("load binary save file failed: {}", path);
+        return false;
+    }
+    return true;
+}
+
+bool SessionData::saveToFile(std::string_view path, SaveFormat format) const {
+    std::string error;
+    if (!engine::core::SaveService::writeFileAtomic(path, encode(format), error)) {
+        spdlog::error("save file {} failed: {}", path, error);
+        return false;
+    }
+    spdlog::info("save file {} success", path);
+    return true;
+}
+
+void SessionData::saveToFileAsync(engine::core::SaveService& save_service, std::string path, SaveFormat format) const {
+    // 复制一份快照，之后游戏线程可以继续修改自身数据
+    save_service.submit(std::move(path), [snapshot = *this, format]() { return snapshot.encode(format); });
+}
+
+std::vector<std::byte> SessionData::encode(SaveFormat format) const {
+    std::vector<std::byte> buffer;
+    if (format == SaveFormat::BINARY) {
+        engine::serialization::BinaryOutputArchive archive(buffer);
+        archive.writeBytes(BINARY_MAGIC.data(), BINARY_MAGIC.size());
+        archive(BINARY_VERSION, level_number_, point_, level_clear_, unit_map_);
+        return buffer;
+    }
 
     nlohmann::json json;
     // 关卡基本信息：当前关卡、积分、是否通关
@@ -80,9 +141,32 @@ bool SessionData::saveToFile(std::string_view path) {
         json["unit"][name]["level"] = data.level_;
         json["unit"][name]["rarity"] = data.rarity_;
     }
-    file << json.dump(4);
-    file.close();
-    spdlog::info("save file {} success", path);
+    const auto text = json.dump(4);
+    buffer.resize(text.size());
+    std::memcpy(buffer.data(), text.data(), text.size());
+    return buffer;
+}
+
+bool SessionData::decodeBinary(const std::vector<std::byte>& buffer) {
+    // 先读到临时对象，读取失败时保留原有数据
+    SessionData data;
+    try {
+        engine::serialization::BinaryInputArchive archive(buffer);
+        std::array<char, BINARY_MAGIC.size()> magic{};
+        std::uint32_t version = 0;
+        archive.readBytes(magic.data(), magic.size());
+        archive(version);
+        if (version != BINARY_VERSION) {
+            spdlog::error("unsupported binary save version: {}", version);
+            return false;
+        }
+        archive(data.level_number_, data.point_, data.level_clear_, data.unit_map_);
+    } catch (const std::exception& e) {
+        spdlog::error("decode binary save failed: {}", e.what());
+        return false;
+    }
+    data.mapUnitDataList();
+    *this = std::move(data);
     return true;
 }
 
@@ -1,11 +1,16 @@
 #pragma once
 
+#include <cstddef>
 #include <string_view>
 #include <string>
 #include <unordered_map>
 #include <vector>
 #include <entt/entity/entity.hpp>
 
+namespace engine::core {
+    class SaveService;
+}
+
 
 namespace game::data {
 
@@ -21,6 +26,18 @@ struct UnitData {
     std::string class_;
     int level_{1};
     int rarity_{1};
+
+    /// @brief 读写二进制存档
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(name_id_, class_id_, name_, class_, level_, rarity_);
+    }
+};
+
+/// @brief 存档格式
+enum class SaveFormat {
+    JSON,       ///< @brief 可读的JSON文本 (默认)
+    BINARY,     ///< @brief 紧凑的二进制格式
 };
 
 /**
@@ -43,9 +60,26 @@ public:
     SessionData() = default;
     ~SessionData() = default;
 
+    // 复制时需要重新映射unit_data_list_ (指针指向各自的unit_map_)
+    SessionData(const SessionData& other);
+    SessionData& operator=(const SessionData& other);
+    SessionData(SessionData&&) = default;
+    SessionData& operator=(SessionData&&) = default;
+
     bool loadDefaultData(std::string_view path = "assets/data/default_session_data.json");  ///< @brief 加载默认数据
-    bool loadFromFile(std::string_view path);                                               ///< @brief 加载文件数据(读档)
-    bool saveToFile(std::string_view path);                                                 ///< @brief 保存文件数据(存档)
+    bool loadFromFile(std::string_view path);                                               ///< @brief 加载文件数据(读档，自动识别格式)
+    bool saveToFile(std::string_view path, SaveFormat format = SaveFormat::JSON) const;     ///< @brief 保存文件数据(同步存档)
+
+    /**
+     * @brief 后台存档：复制一份当前数据交给存档服务，编码与写入都在工作线程中完成
+     * @param save_service 存档服务 (完成后发送 engine::utils::SaveCompletedEvent)
+     * @param path 存档路径
+     * @param format 存档格式
+     */
+    void saveToFileAsync(engine::core::SaveService& save_service, std::string path, SaveFormat format = SaveFormat::JSON) const;
+
+    [[nodiscard]] std::vector<std::byte> encode(SaveFormat format) const;                   ///< @brief 编码为存档文件内容
+    bool decodeBinary(const std::vector<std::byte>& buffer);                                ///< @brief 从二进制数据读取 (二进制存档、录像的初始数据)
 
     void mapUnitDataList();     ///< @brief 将unit_map_中的数据映射到unit_data_list_中
 
@@ -0,0 +1,88 @@
+#include "stress_config.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <entt/core/hashed_string.hpp>
+
+namespace game::data {
+
+bool StressConfig::loadFromFile(std::string_view path) {
+    auto file_path = std::filesystem::path(path);
+    std::ifstream file(file_path);
+    if (!file.is_open()) {
+        spdlog::error("not open stress config file: {}", path);
+        return false;
+    }
+    try {
+        nlohmann::json json;
+        file >> json;
+        fromJson(json);
+    } catch (const std::exception& e) {
+        spdlog::error("load stress config failed: {}", e.what());
+        return false;
+    }
+    spdlog::info("stress config load complete: {} lanes, {} waves x {} enemies", lanes_, wave_count_, enemies_per_wave_);
+    return true;
+}
+
+void StressConfig::fromJson(const nlohmann::json& json) {
+    name_ = json.value("name", name_);
+    map_path_ = json.value("map_path", map_path_);
+    seed_ = json.value("seed", seed_);
+
+    if (json.contains("map")) {
+        const auto& map = json["map"];
+        map_columns_ = std::max(8, map.value("columns", map_columns_));
+        map_rows_ = std::max(4, map.value("rows", map_rows_));
+        ground_gid_ = map.value("ground_gid", ground_gid_);
+    }
+    if (json.contains("path")) {
+        const auto& path = json["path"];
+        lanes_ = std::max(1, path.value("lanes", lanes_));
+        waypoints_per_lane_ = std::max(2, path.value("waypoints_per_lane", waypoints_per_lane_));
+        branching_ = std::max(1, path.value("branching", branching_));
+        jitter_ = std::clamp(path.value("jitter", jitter_), 0.0f, 1.0f);
+    }
+    if (json.contains("placement")) {
+        const auto& placement = json["placement"];
+        melee_places_ = std::max(0, placement.value("melee", melee_places_));
+        ranged_places_ = std::max(0, placement.value("ranged", ranged_places_));
+    }
+    if (json.contains("waves")) {
+        const auto& waves = json["waves"];
+        enemy_level_ = waves.value("enemy_level", enemy_level_);
+        enemy_rarity_ = waves.value("enemy_rarity", enemy_rarity_);
+        prep_time_ = waves.value("prep_time", prep_time_);
+        home_hp_ = std::max(1, waves.value("home_hp", home_hp_));
+        wave_count_ = std::max(1, waves.value("count", wave_count_));
+        enemies_per_wave_ = std::max(1, waves.value("enemies_per_wave", enemies_per_wave_));
+        enemies_per_wave_growth_ = waves.value("enemies_per_wave_growth", enemies_per_wave_growth_);
+        spawn_interval_ = waves.value("spawn_interval", spawn_interval_);
+        spawn_count_ = std::max(1, waves.value("spawn_count", spawn_count_));
+        next_wave_interval_ = waves.value("next_wave_interval", next_wave_interval_);
+        if (waves.contains("enemy_types") && waves["enemy_types"].is_object()) {
+            enemy_weights_.clear();
+            for (const auto& [enemy_type, weight] : waves["enemy_types"].items()) {
+                if (weight.get<int>() > 0) {
+                    enemy_weights_.emplace_back(enemy_type, weight.get<int>());
+                }
+            }
+        }
+    }
+    if (json.contains("player_units") && json["player_units"].is_array()) {
+        player_units_.clear();
+        for (const auto& unit : json["player_units"]) {
+            PresetUnit preset_unit;
+            preset_unit.class_name_ = unit["class"].get<std::string>();
+            preset_unit.class_id_ = entt::hashed_string(preset_unit.class_name_.c_str());
+            preset_unit.count_ = std::max(0, unit.value("count", 1));
+            preset_unit.level_ = unit.value("level", 1);
+            preset_unit.rarity_ = unit.value("rarity", 1);
+            player_units_.push_back(std::move(preset_unit));
+        }
+    }
+}
+
+} // namespace game::data
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "level_data.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <nlohmann/json_fwd.hpp>
+
+namespace game::data {
+
+/**
+ * @brief 压力测试关卡的配置 (assets/data/stress_config.json)。
+ *
+ * 描述程序生成的地图 (路径网络、放置地点)、波次与开局预置的玩家单位，
+ * 由 StressLevelGenerator 生成地图文件与关卡数据，用于在远超正常关卡的规模下测试性能。
+ * 未出现在配置文件中的项使用默认值。
+ */
+class StressConfig final {
+public:
+    // --- 默认配置值 --- (与 engine::core::Config 相同，全部设置为公有)
+    std::string name_ = "Stress";
+    std::string map_path_ = "assets/maps/stress.tmj";  ///< @brief 生成的地图文件路径 (需要与 tileset 目录位于同一目录下)
+    std::uint32_t seed_ = 12345;                        ///< @brief 生成地图使用的随机数种子 (相同种子生成相同的地图)
+
+    // 地图 (单位：瓦片，瓦片大小 64)
+    int map_columns_ = 60;
+    int map_rows_ = 34;
+    int ground_gid_ = 43;                               ///< @brief 铺满地面的瓦片 (Tilemap.tsj 中的 gid)，0 表示不生成地面
+
+    // 路径网络：多条自左向右的路线，在同一个终点汇合
+    int lanes_ = 6;                                     ///< @brief 路线数量 (每条路线一个起点)
+    int waypoints_per_lane_ = 16;                       ///< @brief 每条路线上的节点数量
+    int branching_ = 2;                                 ///< @brief 每个节点最多可以前往的下一个节点数量 (同一路线 + 相邻路线)
+    float jitter_ = 0.3f;                               ///< @brief 节点纵向随机偏移 (相对于路线间距)
+
+    // 放置地点
+    int melee_places_ = 80;                             ///< @brief 近战地点数量 (位于路径上)
+    int ranged_places_ = 80;                            ///< @brief 远程地点数量 (位于路径两侧)
+
+    // 关卡与波次
+    int enemy_level_ = 1;
+    int enemy_rarity_ = 1;
+    float prep_time_ = 5.0f;
+    int home_hp_ = 100000;                              ///< @brief 基地血量 (足够大，测试过程中不会失败)
+    int wave_count_ = 5;
+    int enemies_per_wave_ = 1000;
+    int enemies_per_wave_growth_ = 0;                   ///< @brief 每一波比上一波增加的敌人数量
+    float spawn_interval_ = 0.1f;
+    int spawn_count_ = 10;                              ///< @brief 每个生成间隔生成的敌人数量
+    float next_wave_interval_ = 30.0f;
+    std::vector<std::pair<std::string, int>> enemy_weights_{{"slime", 4}, {"wolf", 3}, {"goblin", 2}, {"dark_witch", 1}};  ///< @brief 敌人类型-权重
+
+    // 开局预置的玩家单位 (依次占用空闲的对应类型地点)
+    std::vector<PresetUnit> player_units_;
+
+public:
+    StressConfig() = default;
+
+    [[nodiscard]] bool loadFromFile(std::string_view path = "assets/data/stress_config.json");  ///< @brief 从json配置文件加载数据
+
+private:
+    void fromJson(const nlohmann::json& json);
+};
+
+} // namespace game::data
@@ -19,6 +19,8 @@ constexpr glm::vec2 SKILL_DISPLAY_OFFSET = {0.0f, -96.0f};   ///< @brief 技能
 constexpr glm::vec2 HEALTH_BAR_SIZE = {48.0f, 8.0f};    ///< @brief 血量条大小
 constexpr float HEALTH_BAR_OFFSET_Y = 8.0f;             ///< @brief 血量条竖直方向偏移量（水平方向默认正中间）
 
+constexpr float FLOATING_TEXT_OFFSET_Y = -64.0f;        ///< @brief 战斗飘字的初始竖直偏移量（单位头顶）
+
 /// @brief 玩家类型枚举
 enum class PlayerType { 
     UNKNOWN,
@@ -27,4 +29,12 @@ enum class PlayerType {
     MIXED       ///< @brief 混合型，可以放在任意区域（暂不实现，未来可拓展）
 };
 
+/// @brief 玩家单位选择攻击目标的优先级 (只在攻击范围内的敌人中选择)
+enum class TargetPolicy {
+    FIRST,      ///< @brief 离终点最近 (剩余路程最短) 的敌人
+    LAST,       ///< @brief 离终点最远的敌人
+    STRONGEST,  ///< @brief 当前生命值最高的敌人
+    WEAKEST     ///< @brief 当前生命值最低的敌人
+};
+
 }   // namespace game::defs
\ No newline at end of file
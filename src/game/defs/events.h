@@ -21,6 +21,26 @@ struct HealEvent {
     float amount_{};                    ///< @brief 治疗量
 };
 
+/// @brief 范围攻击/治疗（命中）事件，半径内与目标同阵营的单位按距离衰减后受到伤害或治疗
+struct AreaEffectEvent {
+    entt::entity source_{entt::null};       ///< @brief 来源 (投射物或施放者)
+    entt::entity excluded_{entt::null};     ///< @brief 不受范围效果影响的实体 (已被直接命中的目标)
+    glm::vec2 center_{};                    ///< @brief 中心位置
+    float radius_{};                        ///< @brief 半径
+    float falloff_{};                       ///< @brief 衰减：边缘处减少的比例
+    float amount_{};                        ///< @brief 中心处的原始伤害或治疗量
+    bool heal_{false};                      ///< @brief 是否为治疗
+    bool affect_players_{false};            ///< @brief 影响玩家单位 (否则影响敌人)
+};
+
+/// @brief 战斗飘字事件 (同一目标在一次结算中受到的伤害或治疗合计为一条)
+struct CombatTextEvent {
+    glm::vec2 position_{};                  ///< @brief 单位位置
+    float amount_{};                        ///< @brief 实际伤害或治疗量
+    bool heal_{false};                      ///< @brief 是否为治疗
+    bool is_player_{false};                 ///< @brief 目标是否为玩家单位
+};
+
 /// @brief 发射投射物事件
 struct EmitProjectileEvent {
     entt::id_type id_{entt::null};          ///< @brief 投射物ID
@@ -100,6 +120,8 @@ struct RetreatEvent {
 struct RestartEvent {};
 struct BackToTitleEvent {};
 struct SaveEvent {};
+struct QuickSaveEvent {};           ///< @brief 快速存档(保存关卡内的全部状态到内存)
+struct QuickLoadEvent {};           ///< @brief 快速读档(恢复上一次快速存档)
 struct LevelClearEvent {};          ///< @brief 关卡通关事件(立刻切换场景)
 struct LevelClearDelayedEvent {     ///< @brief 关卡通关事件(延迟切换场景)
     float delay_time_{3.0f};
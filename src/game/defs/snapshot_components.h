@@ -0,0 +1,83 @@
+#pragma once
+
+#include "tags.h"
+#include "../component/blocked_by_component.h"
+#include "../component/blocker_component.h"
+#include "../component/class_name_component.h"
+#include "../component/cost_regen_component.h"
+#include "../component/enemy_component.h"
+#include "../component/level_component.h"
+#include "../component/place_occupied_component.h"
+#include "../component/player_component.h"
+#include "../component/projectile_component.h"
+#include "../component/skill_component.h"
+#include "../component/stats_component.h"
+#include "../component/target_component.h"
+#include "../component/unit_prep_component.h"
+#include "../../engine/component/animation_component.h"
+#include "../../engine/component/audio_component.h"
+#include "../../engine/component/name_component.h"
+#include "../../engine/component/parallax_component.h"
+#include "../../engine/component/render_component.h"
+#include "../../engine/component/sprite_component.h"
+#include "../../engine/component/static_render_tag.h"
+#include "../../engine/component/tilelayer_component.h"
+#include "../../engine/component/transform_component.h"
+#include "../../engine/component/velocity_component.h"
+#include <entt/core/type_traits.hpp>
+
+namespace game::defs {
+
+/**
+ * @brief 注册表快照包含的组件 (含标签) 列表，保存与恢复使用同一个列表，顺序即存档中的顺序。
+ *
+ * 新增组件或标签时必须加入此列表，否则重开关卡与快速读档后该组件会丢失。
+ * 含有字符串或容器的组件需提供 serialize() 成员 (见 engine::serialization::BinaryOutputArchive)。
+ */
+using SnapshotComponents = entt::type_list<
+    // --- 引擎组件 ---
+    engine::component::TransformComponent,
+    engine::component::VelocityComponent,
+    engine::component::SpriteComponent,
+    engine::component::RenderComponent,
+    engine::component::AnimationComponent,
+    engine::component::AudioComponent,
+    engine::component::NameComponent,
+    engine::component::ParallaxComponent,
+    engine::component::TileLayerComponent,
+    engine::component::StaticRenderTag,
+    // --- 游戏组件 ---
+    game::component::BlockedByComponent,
+    game::component::BlockerComponent,
+    game::component::ClassNameComponent,
+    game::component::CostRegenComponent,
+    game::component::EnemyComponent,
+    game::component::LevelComponent,
+    game::component::PlaceOccupiedComponent,
+    game::component::PlayerComponent,
+    game::component::ProjectileComponent,
+    game::component::ProjectileIDComponent,
+    game::component::SkillComponent,
+    game::component::StatsComponent,
+    game::component::TargetComponent,
+    game::component::UnitPrepComponent,
+    // --- 标签 ---
+    DeadTag,
+    FaceLeftTag,
+    MeleeUnitTag,
+    RangedUnitTag,
+    HealerTag,
+    AttackReadyTag,
+    InjuredTag,
+    ActionLockTag,
+    OneShotRemoveTag,
+    HasHealthBarTag,
+    MeleePlaceTag,
+    RangedPlaceTag,
+    ShowRangeTag,
+    SkillReadyTag,
+    SkillActiveTag,
+    PassiveSkillTag
+>;
+
+}   // namespace game::defs
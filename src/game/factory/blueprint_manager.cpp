@@ -1,5 +1,6 @@
 #include "blueprint_manager.h"
 #include "../../engine/resource/resource_manager.h"
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <nlohmann/json.hpp>
@@ -113,13 +114,16 @@ bool BlueprintManager::loadProjectileBlueprints(std::string_view projectile_json
             data::SpriteBlueprint sprite = parseSprite(data_json);
             // 解析 Sound
             data::SoundBlueprint sounds = parseSound(data_json);
+            // 解析溅射 (可选)
+            data::SplashBlueprint splash = data_json.contains("splash") ? parseSplash(data_json["splash"]) : data::SplashBlueprint{};
             // 解析其它数据，组合蓝图并插入容器
             projectile_blueprints_.emplace(id, data::ProjectileBlueprint{id, 
                 name, 
                 arc_height,
                 total_flight_time,
                 std::move(sprite),
-                std::move(sounds)}
+                std::move(sounds),
+                splash}
             );
         }
     } catch (const std::exception& e) {
@@ -175,6 +179,13 @@ bool BlueprintManager::loadSkillBlueprints(std::string_view skill_json_path) {
 
             // 解析 Buff
             game::data::BuffBlueprint buff = parseBuff(data_json);
+            // 解析治疗脉冲 (可选)
+            game::data::SplashBlueprint pulse{};
+            float pulse_heal = 0.0f;
+            if (data_json.contains("pulse")) {
+                pulse = parseSplash(data_json["pulse"]);
+                pulse_heal = data_json["pulse"].value("heal", 0.0f);
+            }
         
             // 解析完毕，组合蓝图并插入容器
             skill_blueprints_.emplace(id, data::SkillBlueprint{id,
@@ -184,6 +195,8 @@ bool BlueprintManager::loadSkillBlueprints(std::string_view skill_json_path) {
                 cooldown,
                 duration,
                 std::move(buff),
+                pulse,
+                pulse_heal,
             });
         }
     }
@@ -335,12 +348,22 @@ data::PlayerBlueprint BlueprintManager::parsePlayer(const nlohmann::json& json)
     if (json.contains("skill")) {
         skill_id = entt::hashed_string(json["skill"].get<std::string>().c_str());
     }
+    // 解析目标优先级 (可选，默认为离终点最近的敌人)
+    auto policy_str = json.value("target_policy", std::string("first"));
+    auto policy = policy_str == "last" ? game::defs::TargetPolicy::LAST :
+        policy_str == "strongest" ? game::defs::TargetPolicy::STRONGEST :
+        policy_str == "weakest" ? game::defs::TargetPolicy::WEAKEST :
+        game::defs::TargetPolicy::FIRST;
+    if (policy == game::defs::TargetPolicy::FIRST && policy_str != "first") {
+        spdlog::warn("unknown target_policy '{}', use 'first'", policy_str);
+    }
     // 解析其他数据并返回
     data::PlayerBlueprint player{type,
         skill_id,
         json["healer"].get<bool>(),
         json["block"].get<int>(),
-        json["cost"].get<int>()};
+        json["cost"].get<int>(),
+        policy};
     return player;
 }
 
@@ -365,4 +388,11 @@ data::BuffBlueprint BlueprintManager::parseBuff(const nlohmann::json& json) {
     };
 }
 
+data::SplashBlueprint BlueprintManager::parseSplash(const nlohmann::json& json) {
+    // 衰减限制在 [0, 1]，保证范围内的效果不为负
+    return data::SplashBlueprint{std::max(0.0f, json.value("radius", 0.0f)),
+        std::clamp(json.value("falloff", 0.0f), 0.0f, 1.0f)
+    };
+}
+
 }   // namespace game::factory
\ No newline at end of file
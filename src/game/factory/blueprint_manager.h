@@ -59,6 +59,7 @@ private:
     data::EnemyBlueprint parseEnemy(const nlohmann::json& json);
     data::DisplayInfoBlueprint parseDisplayInfo(const nlohmann::json& json);
     data::BuffBlueprint parseBuff(const nlohmann::json& json);
+    data::SplashBlueprint parseSplash(const nlohmann::json& json);
 };
 
 }   // namespace game::factory
\ No newline at end of file
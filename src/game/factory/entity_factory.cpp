@@ -10,6 +10,7 @@
 #include "../defs/tags.h"
 #include "../../engine/component/audio_component.h"
 #include "../component/stats_component.h"
+#include "../component/level_component.h"
 #include "../component/enemy_component.h"
 #include "../component/class_name_component.h"
 #include "../component/player_component.h"
@@ -22,86 +23,140 @@
 #include <spdlog/spdlog.h>
 #include <glm/gtc/constants.hpp>
 #include <glm/trigonometric.hpp>
+#include <cmath>
+#include <iterator>
 
 using namespace entt::literals;
 
 namespace game::factory {
 
 EntityFactory::EntityFactory(entt::registry& registry, 
-    BlueprintManager& blueprint_manager)
-    : registry_(registry), blueprint_manager_(blueprint_manager) {}
+    BlueprintManager& blueprint_manager,
+    std::pmr::memory_resource* resource)
+    : registry_(registry), blueprint_manager_(blueprint_manager), resource_(resource) {
+    compilePrefabs();
+}
 
 entt::entity EntityFactory::createPlayerUnit(entt::id_type class_id, const glm::vec2& position, int level, int rarity) {
-    auto entity = registry_.create();
-    const auto& blueprint = blueprint_manager_.getPlayerClassBlueprint(class_id);
-    // --- 添加组件 ---
-    // 添加Transform组件
-    addTransformComponent(entity, position);
-
-    // 添加Sprite组件
-    addSpriteComponent(entity, blueprint.sprite_);
-
-    // 添加Animation组件
-    addAnimationComponent(entity, blueprint.animations_, blueprint.sprite_, "idle"_hs);
-
-    // 添加Audio组件
-    addAudioComponent(entity, blueprint.sounds_);
-
-    // 添加Stats组件
-    addStatsComponent(entity, blueprint.stats_, level, rarity);
-    
-    // 添加Player组件
-    addPlayerComponent(entity, blueprint.player_, rarity);
-
-    // 添加Skill组件
-    addSkillComponent(entity, blueprint.player_.skill_id_);
-
-    // 添加ProjectileID组件
-    addProjectileIDComponent(entity, blueprint.projectile_id_);
+    entt::entity entity{entt::null};
+    spawnPlayerBatch(class_id, {&entity, 1}, {&position, 1}, level, rarity);
+    return entity;
+}
 
-    // 补充其他必要组件
-    registry_.emplace<game::component::ClassNameComponent>(entity, class_id, blueprint.display_info_.name_);
-    registry_.emplace<engine::component::RenderComponent>(entity);
-    registry_.emplace<game::defs::HasHealthBarTag>(entity);
+entt::entity EntityFactory::createEnemyUnit(entt::id_type class_id, const glm::vec2& position, int target_waypoint_id, int level, int rarity) {
+    entt::entity entity{entt::null};
+    spawnEnemyBatch(class_id, {&entity, 1}, {&position, 1}, {&target_waypoint_id, 1}, level, rarity);
+    return entity;
+}
 
-    // 未来可添加其它组件
+void EntityFactory::spawnEnemyBatch(entt::id_type class_id, std::span<entt::entity> entities, std::span<const glm::vec2> positions,
+                                    std::span<const int> target_waypoint_ids, int level, int rarity) {
+    if (entities.empty()) return;
+    if (positions.size() != entities.size() || target_waypoint_ids.size() != entities.size()) {
+        spdlog::error("spawnEnemyBatch: {} entities but {} positions and {} waypoints", entities.size(), positions.size(), target_waypoint_ids.size());
+        return;
+    }
+    const auto& prefab = getEnemyPrefab(class_id);
+    // 一次创建全部实体 (与逐个创建得到的实体相同)
+    registry_.create(entities.begin(), entities.end());
+    const std::span<const entt::entity> created{entities};
+
+    // 变换、精灵、动画 (默认动画为“walk”)、音效
+    insertUnitComponents(created, positions, prefab);
+
+    // 属性与等级 (同一批的等级和稀有度相同，只计算一次)
+    registry_.insert<game::component::StatsComponent>(created.begin(), created.end(), makeStatsComponent(prefab.stats_, level, rarity));
+    registry_.insert<game::component::LevelComponent>(created.begin(), created.end(), game::component::LevelComponent{level, rarity});
+
+    // 敌人组件 (目标路径点各不相同)、速度、远程或近战标签
+    enemy_buffer_.clear();
+    for (auto waypoint_id : target_waypoint_ids) {
+        enemy_buffer_.push_back({waypoint_id, prefab.speed_});
+    }
+    registry_.insert<game::component::EnemyComponent>(created.begin(), created.end(), enemy_buffer_.begin());
+    registry_.insert<engine::component::VelocityComponent>(created.begin(), created.end(), engine::component::VelocityComponent{glm::vec2(0, 0)});
+    if (prefab.ranged_) {
+        registry_.insert<game::defs::RangedUnitTag>(created.begin(), created.end());
+    } else {
+        registry_.insert<game::defs::MeleeUnitTag>(created.begin(), created.end());
+    }
 
-    return entity;
+    // 投射物ID、名称、渲染 (使用默认主图层)、血量条
+    insertUnitTail(created, prefab);
 }
 
-entt::entity EntityFactory::createEnemyUnit(entt::id_type class_id, const glm::vec2& position, int target_waypoint_id, int level, int rarity) {
-    auto entity = registry_.create();
-    const auto& blueprint = blueprint_manager_.getEnemyClassBlueprint(class_id);
-    // --- 添加组件 ---
-    // 添加Transform组件
-    addTransformComponent(entity, position);
+void EntityFactory::spawnPlayerBatch(entt::id_type class_id, std::span<entt::entity> entities, std::span<const glm::vec2> positions,
+                                     int level, int rarity) {
+    if (entities.empty()) return;
+    if (positions.size() != entities.size()) {
+        spdlog::error("spawnPlayerBatch: {} entities but {} positions", entities.size(), positions.size());
+        return;
+    }
+    const auto& prefab = getPlayerPrefab(class_id);
+    registry_.create(entities.begin(), entities.end());
+    const std::span<const entt::entity> created{entities};
 
-    // 添加Sprite组件
-    addSpriteComponent(entity, blueprint.sprite_);
+    // 变换、精灵、动画 (默认动画为“idle”)、音效
+    insertUnitComponents(created, positions, prefab);
 
-    // 添加Animation组件 (默认动画为“walk”)
-    addAnimationComponent(entity, blueprint.animations_, blueprint.sprite_, "walk"_hs);
+    // 属性与等级
+    registry_.insert<game::component::StatsComponent>(created.begin(), created.end(), makeStatsComponent(prefab.stats_, level, rarity));
+    registry_.insert<game::component::LevelComponent>(created.begin(), created.end(), game::component::LevelComponent{level, rarity});
 
-    // 添加Audio组件
-    addAudioComponent(entity, blueprint.sounds_);
+    // 玩家组件与类型标签 (近战、远程、治疗)
+    const auto& player = prefab.player_;
+    const auto cost = static_cast<int>(std::round(player.cost_ * (0.9f + 0.1f * rarity)));
+    registry_.insert<game::component::PlayerComponent>(created.begin(), created.end(), game::component::PlayerComponent{cost, player.target_policy_});
+    if (player.type_ == game::defs::PlayerType::MELEE) {
+        registry_.insert<game::defs::MeleeUnitTag>(created.begin(), created.end());    // 近战单位标签
+        // 近战类型添加阻挡者组件
+        registry_.insert<game::component::BlockerComponent>(created.begin(), created.end(), game::component::BlockerComponent{player.block_});
+    } else if (player.type_ == game::defs::PlayerType::RANGED) {
+        registry_.insert<game::defs::RangedUnitTag>(created.begin(), created.end());   // 远程单位标签
+        if (player.healer_) {
+            registry_.insert<game::defs::HealerTag>(created.begin(), created.end());   // 治疗单位标签
+        }
+    }
 
-    // 添加Stats组件
-    addStatsComponent(entity, blueprint.stats_, level, rarity);
-    
-    // 添加Enemy组件
-    addEnemyComponent(entity, blueprint.enemy_, target_waypoint_id);
-    
-    // 添加ProjectileID组件
-    addProjectileIDComponent(entity, blueprint.projectile_id_);
+    // 技能 (冷却计时器由TimerSystem在组件创建时调度)；被动技能添加PassiveSkillTag与SkillReadyTag
+    registry_.insert<game::component::SkillComponent>(created.begin(), created.end(), prefab.skill_);
+    if (prefab.passive_skill_) {
+        registry_.insert<game::defs::PassiveSkillTag>(created.begin(), created.end());
+        registry_.insert<game::defs::SkillReadyTag>(created.begin(), created.end());
+    }
 
-    // 补充其他必要组件
-    registry_.emplace<game::component::ClassNameComponent>(entity, class_id, blueprint.display_info_.name_);
-    registry_.emplace<engine::component::RenderComponent>(entity);  // 使用默认主图层
-    registry_.emplace<game::defs::HasHealthBarTag>(entity);
+    // 投射物ID、名称、渲染、血量条
+    insertUnitTail(created, prefab);
+}
 
-    // 未来可添加其它组件
+void EntityFactory::reserveEnemies(std::size_t count) {
+    if (count == 0) return;
+    // 在当前数量的基础上预留 (已经足够时不会重新分配)
+    const auto reserve = [count](auto& storage) { storage.reserve(storage.size() + count); };
+    reserve(registry_.storage<entt::entity>());
+    reserve(registry_.storage<engine::component::TransformComponent>());
+    reserve(registry_.storage<engine::component::SpriteComponent>());
+    reserve(registry_.storage<engine::component::AnimationComponent>());
+    reserve(registry_.storage<engine::component::AudioComponent>());
+    reserve(registry_.storage<game::component::StatsComponent>());
+    reserve(registry_.storage<game::component::LevelComponent>());
+    reserve(registry_.storage<game::component::EnemyComponent>());
+    reserve(registry_.storage<engine::component::VelocityComponent>());
+    reserve(registry_.storage<game::component::ProjectileIDComponent>());
+    reserve(registry_.storage<game::component::ClassNameComponent>());
+    reserve(registry_.storage<engine::component::RenderComponent>());
+}
 
-    return entity;
+void EntityFactory::compilePrefabs() {
+    enemy_prefabs_.clear();
+    player_prefabs_.clear();
+    for (const auto& [class_id, blueprint] : blueprint_manager_.enemy_class_blueprints_) {
+        enemy_prefabs_.emplace(class_id, compileEnemyPrefab(blueprint));
+    }
+    for (const auto& [class_id, blueprint] : blueprint_manager_.player_class_blueprints_) {
+        player_prefabs_.emplace(class_id, compilePlayerPrefab(blueprint));
+    }
+    spdlog::trace("EntityFactory: {} enemy prefabs, {} player prefabs compiled", enemy_prefabs_.size(), player_prefabs_.size());
 }
 
 entt::entity EntityFactory::createProjectile(entt::id_type id, const glm::vec2& start_position, const glm::vec2& target_position, entt::entity target, float damage) {
@@ -118,7 +173,10 @@ entt::entity EntityFactory::createProjectile(entt::id_type id, const glm::vec2&
         start_position,
         blueprint.arc_height_, 
         blueprint.total_flight_time_,
-        0.0f);
+        0.0f,
+        blueprint.splash_.radius_,
+        blueprint.splash_.falloff_,
+        registry_.valid(target) && registry_.all_of<game::component::PlayerComponent>(target));
     // 添加SpriteComponent
     addSpriteComponent(entity, blueprint.sprite_);
     // 添加TransformComponent
@@ -219,16 +277,17 @@ void EntityFactory::addSpriteComponent(entt::entity entity, const data::SpriteBl
     }
 }
 
-void EntityFactory::addAnimationComponent(entt::entity entity, 
+engine::memory::HashMap<entt::id_type, engine::component::Animation> EntityFactory::buildAnimations(
         const std::unordered_map<entt::id_type, data::AnimationBlueprint>& animation_blueprints,
-        const data::SpriteBlueprint& sprite_blueprint,
-        entt::id_type default_animation_id) {
-    // 先创建map容器  
-    std::unordered_map<entt::id_type, engine::component::Animation> animations;
+        const data::SpriteBlueprint& sprite_blueprint) const {
+    // 先创建map容器 (所有容器都从场景内存分配)
+    engine::memory::HashMap<entt::id_type, engine::component::Animation> animations(resource_);
+    animations.reserve(animation_blueprints.size());
     // 针对每一个动画，
     for (const auto& [anim_id, anim_blueprint] : animation_blueprints) {
         // 创建动画帧容器
-        std::vector<engine::component::AnimationFrame> frames;
+        engine::memory::Vector<engine::component::AnimationFrame> frames(resource_);
+        frames.reserve(anim_blueprint.frames_.size());
         // 依次读取蓝图中的每一个帧索引
         for (const auto& frame_index : anim_blueprint.frames_) {
             engine::utils::Rect source_rect = sprite_blueprint.src_rect_;
@@ -238,11 +297,10 @@ void EntityFactory::addAnimationComponent(entt::entity entity,
             // 创建动画帧并插入动画帧容器
             frames.emplace_back(source_rect, anim_blueprint.ms_per_frame_);
         }
-        // 将创建好的动画帧容器插入动画map容器 (可直接使用蓝图中的事件信息)
-        animations.emplace(anim_id, engine::component::Animation(std::move(frames), anim_blueprint.events_));
+        // 将创建好的动画帧容器插入动画map容器 (事件信息复制自蓝图)
+        animations.emplace(anim_id, engine::component::Animation(std::move(frames), copyEvents(anim_blueprint.events_)));
     }
-    // 通过动画map容器创建动画组件
-    registry_.emplace<engine::component::AnimationComponent>(entity, std::move(animations), default_animation_id);
+    return animations;
 }
 
 void EntityFactory::addOneAnimationComponent(entt::entity entity, 
@@ -251,7 +309,8 @@ void EntityFactory::addOneAnimationComponent(entt::entity entity,
                                              entt::id_type animation_id,
                                              bool loop) {
     // 创建动画帧容器
-    std::vector<engine::component::AnimationFrame> frames;
+    engine::memory::Vector<engine::component::AnimationFrame> frames(resource_);
+    frames.reserve(animation_blueprint.frames_.size());
     // 依次读取动画蓝图中每一个动画帧，并插入容器
     for (const auto& frame_index : animation_blueprint.frames_) {
         engine::utils::Rect source_rect = sprite_blueprint.src_rect_;
@@ -260,90 +319,159 @@ void EntityFactory::addOneAnimationComponent(entt::entity entity,
         frames.emplace_back(source_rect, animation_blueprint.ms_per_frame_);
     }
     // 创建动画map容器
-    std::unordered_map<entt::id_type, engine::component::Animation> animations;
+    engine::memory::HashMap<entt::id_type, engine::component::Animation> animations(resource_);
     // 将创建好的动画帧容器插入动画map容器 (只有一个动画)
-    animations.emplace(animation_id, engine::component::Animation(std::move(frames), animation_blueprint.events_, loop));
+    animations.emplace(animation_id, engine::component::Animation(std::move(frames), copyEvents(animation_blueprint.events_), loop));
     // 通过动画map容器创建动画组件
     registry_.emplace<engine::component::AnimationComponent>(entity, std::move(animations), animation_id);
 }
 
 
-void EntityFactory::addStatsComponent(entt::entity entity, const data::StatsBlueprint& stats, int level, int rarity) {
+engine::memory::HashMap<int, entt::id_type> EntityFactory::copyEvents(const std::unordered_map<int, entt::id_type>& events) const {
+    engine::memory::HashMap<int, entt::id_type> result(resource_);
+    result.insert(events.begin(), events.end());
+    return result;
+}
+
+game::component::StatsComponent EntityFactory::makeStatsComponent(const data::StatsBlueprint& stats, int level, int rarity) {
     // 计算等级和稀有度对属性的影响 (未来可改成数据驱动方便调整)
     auto hp = engine::utils::statModify(stats.hp_, level, rarity);
     auto atk = engine::utils::statModify(stats.atk_, level, rarity);
     auto def = engine::utils::statModify(stats.def_, level, rarity);
-    
-    registry_.emplace_or_replace<game::component::StatsComponent>(entity, 
+    return game::component::StatsComponent{
         hp, 
         hp, 
         atk, 
         def, 
         stats.range_,
         stats.atk_interval_,
-        0.0f,
-        level,
-        rarity);
-}
-
-void EntityFactory::addPlayerComponent(entt::entity entity, const data::PlayerBlueprint& player, int rarity) {
-    auto cost = static_cast<int>(std::round(player.cost_ * (0.9f + 0.1f * rarity)));
-    registry_.emplace<game::component::PlayerComponent>(entity, cost);
-    // 添加类型标签(近战、远程、治疗)
-    if (player.type_ == game::defs::PlayerType::MELEE) {
-        registry_.emplace<game::defs::MeleeUnitTag>(entity);    // 近战单位标签
-        // 近战类型添加阻挡者组件
-        registry_.emplace<game::component::BlockerComponent>(entity, player.block_);
-    } else if (player.type_ == game::defs::PlayerType::RANGED) {
-        registry_.emplace<game::defs::RangedUnitTag>(entity);    // 远程单位标签
-        if (player.healer_) {
-            registry_.emplace<game::defs::HealerTag>(entity);    // 治疗单位标签
-        }
-    }
-    // TODO: 未来添加技能组件
-}
-
-void EntityFactory::addEnemyComponent(entt::entity entity, const data::EnemyBlueprint& enemy, int target_waypoint_id) {
-    registry_.emplace<game::component::EnemyComponent>(entity, target_waypoint_id, enemy.speed_);
-    registry_.emplace<engine::component::VelocityComponent>(entity, glm::vec2(0, 0));
-    if (enemy.ranged_) {    // 添加远程或近战标签备用
-        registry_.emplace<game::defs::RangedUnitTag>(entity);
-    } else {
-        registry_.emplace<game::defs::MeleeUnitTag>(entity);
-    }
+        engine::core::TimerHandle{}};   // 攻击计时器由TimerSystem在组件创建时调度
 }
 
 void EntityFactory::addAudioComponent(entt::entity entity, const data::SoundBlueprint& sounds) {
     if (sounds.sounds_.empty()) return;
     // 将sounds_中的键值对转换为audio_map中的键值对
-    std::unordered_map<entt::id_type, entt::id_type> audio_map;
+    engine::memory::HashMap<entt::id_type, entt::id_type> audio_map(resource_);
+    audio_map.reserve(sounds.sounds_.size());
     for (const auto& [sound_key, sound_id] : sounds.sounds_) {
         audio_map.emplace(sound_key, sound_id);
     }
     registry_.emplace<engine::component::AudioComponent>(entity, std::move(audio_map));
 }
 
-void EntityFactory::addProjectileIDComponent(entt::entity entity, entt::id_type id) {
-    if (id == entt::null) return;
-    registry_.emplace<game::component::ProjectileIDComponent>(entity, id);
+// --- 预制体 ---
+
+EnemyPrefab EntityFactory::compileEnemyPrefab(const data::EnemyClassBlueprint& blueprint) const {
+    EnemyPrefab prefab;
+    prefab.class_id_ = blueprint.class_id_;
+    prefab.sprite_ = engine::component::SpriteComponent(engine::component::Sprite(blueprint.sprite_.path_, blueprint.sprite_.src_rect_),
+                                                        blueprint.sprite_.size_, blueprint.sprite_.offset_);
+    prefab.face_left_ = !blueprint.sprite_.face_right_;
+    prefab.animation_ = engine::component::AnimationComponent(buildAnimations(blueprint.animations_, blueprint.sprite_), "walk"_hs);
+    prefab.audio_.sounds_ = engine::memory::HashMap<entt::id_type, entt::id_type>(blueprint.sounds_.sounds_.begin(), blueprint.sounds_.sounds_.end(), 0, resource_);
+    prefab.has_audio_ = !blueprint.sounds_.sounds_.empty();
+    prefab.stats_ = blueprint.stats_;
+    prefab.speed_ = blueprint.enemy_.speed_;
+    prefab.ranged_ = blueprint.enemy_.ranged_;
+    prefab.projectile_id_ = blueprint.projectile_id_;
+    prefab.class_name_ = {blueprint.class_id_, blueprint.display_info_.name_};
+    return prefab;
 }
 
-void EntityFactory::addSkillComponent(entt::entity entity, entt::id_type skill_id) {
-    const auto& skill = blueprint_manager_.getSkillBlueprint(skill_id);
-    registry_.emplace<game::component::SkillComponent>(entity, 
-        skill_id, 
+PlayerPrefab EntityFactory::compilePlayerPrefab(const data::PlayerClassBlueprint& blueprint) const {
+    PlayerPrefab prefab;
+    prefab.class_id_ = blueprint.class_id_;
+    prefab.sprite_ = engine::component::SpriteComponent(engine::component::Sprite(blueprint.sprite_.path_, blueprint.sprite_.src_rect_),
+                                                        blueprint.sprite_.size_, blueprint.sprite_.offset_);
+    prefab.face_left_ = !blueprint.sprite_.face_right_;
+    prefab.animation_ = engine::component::AnimationComponent(buildAnimations(blueprint.animations_, blueprint.sprite_), "idle"_hs);
+    prefab.audio_.sounds_ = engine::memory::HashMap<entt::id_type, entt::id_type>(blueprint.sounds_.sounds_.begin(), blueprint.sounds_.sounds_.end(), 0, resource_);
+    prefab.has_audio_ = !blueprint.sounds_.sounds_.empty();
+    prefab.stats_ = blueprint.stats_;
+    prefab.player_ = blueprint.player_;
+    const auto& skill = blueprint_manager_.getSkillBlueprint(blueprint.player_.skill_id_);
+    prefab.skill_ = game::component::SkillComponent{
+        blueprint.player_.skill_id_, 
         entt::null,
         skill.name_, 
         skill.description_, 
         skill.cooldown_, 
         skill.duration_,
-        skill.cooldown_ / 2.0f,         // 初始技能冷却时间为技能冷却时间的一半
-        0.0f);
-    // 如果是被动技能，则添加PassiveSkillTag与SkillReadyTag
-    if (skill.passive_) {
-        registry_.emplace<game::defs::PassiveSkillTag>(entity);
-        registry_.emplace<game::defs::SkillReadyTag>(entity);
+        engine::core::TimerHandle{},    // 冷却计时器由TimerSystem在组件创建时调度
+        engine::core::TimerHandle{}};
+    prefab.passive_skill_ = skill.passive_;
+    prefab.projectile_id_ = blueprint.projectile_id_;
+    prefab.class_name_ = {blueprint.class_id_, blueprint.display_info_.name_};
+    return prefab;
+}
+
+const EnemyPrefab& EntityFactory::getEnemyPrefab(entt::id_type class_id) {
+    if (auto it = enemy_prefabs_.find(class_id); it != enemy_prefabs_.end()) {
+        return it->second;
+    }
+    // 构造之后才载入的蓝图 (找不到时蓝图管理器会报错并返回默认蓝图)
+    return enemy_prefabs_.emplace(class_id, compileEnemyPrefab(blueprint_manager_.getEnemyClassBlueprint(class_id))).first->second;
+}
+
+const PlayerPrefab& EntityFactory::getPlayerPrefab(entt::id_type class_id) {
+    if (auto it = player_prefabs_.find(class_id); it != player_prefabs_.end()) {
+        return it->second;
+    }
+    return player_prefabs_.emplace(class_id, compilePlayerPrefab(blueprint_manager_.getPlayerClassBlueprint(class_id))).first->second;
+}
+
+engine::component::AnimationComponent EntityFactory::cloneAnimation(const engine::component::AnimationComponent& prototype) const {
+    // 逐个复制动画，帧与事件容器都从 resource_ 分配
+    engine::memory::HashMap<entt::id_type, engine::component::Animation> animations(resource_);
+    animations.reserve(prototype.animations_.size());
+    for (const auto& [anim_id, animation] : prototype.animations_) {
+        animations.emplace(anim_id, engine::component::Animation(
+            engine::memory::Vector<engine::component::AnimationFrame>(animation.frames_, resource_),
+            engine::memory::HashMap<int, entt::id_type>(animation.events_, resource_),
+            animation.loop_));
+    }
+    return engine::component::AnimationComponent(std::move(animations), prototype.current_animation_id_);
+}
+
+template <typename Prefab>
+void EntityFactory::insertUnitComponents(std::span<const entt::entity> entities, std::span<const glm::vec2> positions, const Prefab& prefab) {
+    // 变换 (位置各不相同)
+    transform_buffer_.clear();
+    for (const auto& position : positions) {
+        transform_buffer_.emplace_back(position);
+    }
+    registry_.insert<engine::component::TransformComponent>(entities.begin(), entities.end(), transform_buffer_.begin());
+
+    // 精灵，图片朝左时添加FaceLeftTag
+    registry_.insert<engine::component::SpriteComponent>(entities.begin(), entities.end(), prefab.sprite_);
+    if (prefab.face_left_) {
+        registry_.insert<game::defs::FaceLeftTag>(entities.begin(), entities.end());
+    }
+
+    // 动画与音效含有容器，先在 resource_ 中复制，再移动到存储中 (直接复制会回到默认内存资源)
+    animation_buffer_.clear();
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        animation_buffer_.push_back(cloneAnimation(prefab.animation_));
+    }
+    registry_.insert<engine::component::AnimationComponent>(entities.begin(), entities.end(), std::make_move_iterator(animation_buffer_.begin()));
+    if (prefab.has_audio_) {
+        audio_buffer_.clear();
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            audio_buffer_.push_back({engine::memory::HashMap<entt::id_type, entt::id_type>(prefab.audio_.sounds_, resource_)});
+        }
+        registry_.insert<engine::component::AudioComponent>(entities.begin(), entities.end(), std::make_move_iterator(audio_buffer_.begin()));
+    }
+}
+
+template <typename Prefab>
+void EntityFactory::insertUnitTail(std::span<const entt::entity> entities, const Prefab& prefab) {
+    if (prefab.projectile_id_ != entt::null) {
+        registry_.insert<game::component::ProjectileIDComponent>(entities.begin(), entities.end(),
+                                                                 game::component::ProjectileIDComponent{prefab.projectile_id_});
     }
+    registry_.insert<game::component::ClassNameComponent>(entities.begin(), entities.end(), prefab.class_name_);
+    registry_.insert<engine::component::RenderComponent>(entities.begin(), entities.end(), engine::component::RenderComponent{});  // 使用默认主图层
+    registry_.insert<game::defs::HasHealthBarTag>(entities.begin(), entities.end());
 }
 
 }   // namespace game::factory
\ No newline at end of file
@@ -1,8 +1,17 @@
 #pragma once
 
+#include "unit_prefab.h"
 #include "../data/entity_blueprint.h"
+#include "../component/enemy_component.h"
+#include "../component/stats_component.h"
+#include "../../engine/component/transform_component.h"
+#include "../../engine/memory/pmr.h"
+#include <cstddef>
 #include <entt/entity/fwd.hpp>
+#include <memory_resource>
+#include <span>
 #include <unordered_map>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 namespace game::factory {
@@ -14,15 +23,33 @@ class BlueprintManager;
  * 实体工厂通过蓝图管理器获取蓝图数据，并创建不同类型的实体。
  * 
  * 广义的工厂模式
+ * @note 组件中的容器 (动画帧、音效表等) 从构造时传入的内存资源分配，通常是场景内存。
+ *
+ * 玩家与敌人单位由预制体生成：构造时把每个职业/敌人蓝图编译为预制体 (见 unit_prefab.h)，
+ * 批量生成时先一次创建全部实体，再对每种组件做一次范围插入，而不是逐个实体逐个组件地添加。
+ * 单个单位的创建函数也使用同一条路径 (数量为1的批)。
  */
 class EntityFactory {
 private:
     entt::registry& registry_;
     BlueprintManager& blueprint_manager_;
+    std::pmr::memory_resource* resource_;   ///< @brief 组件容器使用的内存资源 (非拥有)
+
+    std::unordered_map<entt::id_type, EnemyPrefab> enemy_prefabs_;     ///< @brief 敌人类型ID -> 预制体
+    std::unordered_map<entt::id_type, PlayerPrefab> player_prefabs_;   ///< @brief 玩家职业ID -> 预制体
+
+    // --- 批量生成时的临时数组 (容量在批之间复用) ---
+    std::vector<engine::component::TransformComponent> transform_buffer_;
+    std::vector<engine::component::AnimationComponent> animation_buffer_;
+    std::vector<engine::component::AudioComponent> audio_buffer_;
+    std::vector<game::component::EnemyComponent> enemy_buffer_;
 
 public:
     /// @brief 实体工厂构造函数, 需要传入注册表和蓝图管理器。通过蓝图数据创建不同实体
-    EntityFactory(entt::registry& registry, BlueprintManager& blueprint_manager);
+    EntityFactory(entt::registry& registry, BlueprintManager& blueprint_manager,
+                  std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    std::pmr::memory_resource* getMemoryResource() const { return resource_; }  ///< @brief 获取组件容器使用的内存资源
 
     /**
      * @brief 创建玩家单位
@@ -45,6 +72,38 @@ public:
      */
     entt::entity createEnemyUnit(entt::id_type class_id, const glm::vec2& position, int target_waypoint_id, int level = 1, int rarity = 1);
 
+    /**
+     * @brief 批量生成同一类型的敌人 (用于波次生成)
+     * @param class_id 敌人类型ID
+     * @param entities 输出：生成的实体 (长度即生成数量)
+     * @param positions 每个敌人的位置 (长度与 entities 相同)
+     * @param target_waypoint_ids 每个敌人的目标路径点ID (长度与 entities 相同)
+     * @param level 等级
+     * @param rarity 稀有度
+     */
+    void spawnEnemyBatch(entt::id_type class_id, std::span<entt::entity> entities, std::span<const glm::vec2> positions,
+                         std::span<const int> target_waypoint_ids, int level = 1, int rarity = 1);
+
+    /**
+     * @brief 批量生成同一职业的玩家单位
+     * @param class_id 职业ID
+     * @param entities 输出：生成的实体 (长度即生成数量)
+     * @param positions 每个单位的位置 (长度与 entities 相同)
+     * @param level 等级
+     * @param rarity 稀有度
+     */
+    void spawnPlayerBatch(entt::id_type class_id, std::span<entt::entity> entities, std::span<const glm::vec2> positions,
+                          int level = 1, int rarity = 1);
+
+    /**
+     * @brief 为即将生成的敌人预留实体与组件存储的容量 (在波次开始时调用，避免生成时扩容)
+     * @param count 即将生成的敌人数量
+     */
+    void reserveEnemies(std::size_t count);
+
+    /// @brief 把蓝图管理器中的全部职业/敌人蓝图编译为预制体 (构造时调用，载入新的蓝图后可再次调用)
+    void compilePrefabs();
+
     /**
      * @brief 创建投射物
      * @param id 投射物ID
@@ -98,21 +157,35 @@ private:
     // --- 组件创建函数 ---
     void addTransformComponent(entt::entity entity, const glm::vec2& position, const glm::vec2& scale = glm::vec2(1.0f), float rotation = 0.0f);
     void addSpriteComponent(entt::entity entity, const data::SpriteBlueprint& sprite, const bool is_flipped = false);
-    void addAnimationComponent(entt::entity entity,         ///< @brief 正常动画组件添加（多个动画）
-        const std::unordered_map<entt::id_type, data::AnimationBlueprint>& animation_blueprints, 
-        const data::SpriteBlueprint& sprite_blueprint,
-        entt::id_type default_animation_id);
     void addOneAnimationComponent(entt::entity entity,      ///< @brief 单个动画组件添加（组件中只包含一个动画），用于创建特效
         const data::AnimationBlueprint& animation_blueprint, 
         const data::SpriteBlueprint& sprite_blueprint,
         entt::id_type animation_id,
         bool loop = false);
-    void addStatsComponent(entt::entity entity, const data::StatsBlueprint& stats, int level = 1, int rarity = 1);
-    void addPlayerComponent(entt::entity entity, const data::PlayerBlueprint& player, int rarity);
-    void addEnemyComponent(entt::entity entity, const data::EnemyBlueprint& enemy, int target_waypoint_id);
     void addAudioComponent(entt::entity entity, const data::SoundBlueprint& sounds);
-    void addProjectileIDComponent(entt::entity entity, entt::id_type id);
-    void addSkillComponent(entt::entity entity, entt::id_type skill_id);
+    /// @brief 把蓝图中的动画事件复制到使用 resource_ 的容器中
+    engine::memory::HashMap<int, entt::id_type> copyEvents(const std::unordered_map<int, entt::id_type>& events) const;
+    /// @brief 由动画蓝图生成动画集合 (计算每一帧的源矩形)
+    engine::memory::HashMap<entt::id_type, engine::component::Animation> buildAnimations(
+        const std::unordered_map<entt::id_type, data::AnimationBlueprint>& animation_blueprints,
+        const data::SpriteBlueprint& sprite_blueprint) const;
+    /// @brief 计算等级和稀有度对属性的影响，生成属性组件
+    static game::component::StatsComponent makeStatsComponent(const data::StatsBlueprint& stats, int level, int rarity);
+
+    // --- 预制体 ---
+    [[nodiscard]] EnemyPrefab compileEnemyPrefab(const data::EnemyClassBlueprint& blueprint) const;
+    [[nodiscard]] PlayerPrefab compilePlayerPrefab(const data::PlayerClassBlueprint& blueprint) const;
+    const EnemyPrefab& getEnemyPrefab(entt::id_type class_id);      ///< @brief 获取预制体，未编译时按蓝图编译
+    const PlayerPrefab& getPlayerPrefab(entt::id_type class_id);
+    /// @brief 复制动画原型，容器使用 resource_
+    [[nodiscard]] engine::component::AnimationComponent cloneAnimation(const engine::component::AnimationComponent& prototype) const;
+
+    /// @brief 插入玩家与敌人共有的前几个组件 (变换、精灵、动画、音效)
+    template <typename Prefab>
+    void insertUnitComponents(std::span<const entt::entity> entities, std::span<const glm::vec2> positions, const Prefab& prefab);
+    /// @brief 插入玩家与敌人共有的其余组件 (投射物ID、名称、渲染、血量条)
+    template <typename Prefab>
+    void insertUnitTail(std::span<const entt::entity> entities, const Prefab& prefab);
     // TODO: 未来添加其他组件创建函数
 };
 
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "../data/entity_blueprint.h"
+#include "../component/class_name_component.h"
+#include "../component/skill_component.h"
+#include "../../engine/component/animation_component.h"
+#include "../../engine/component/audio_component.h"
+#include "../../engine/component/sprite_component.h"
+#include <entt/entity/entity.hpp>
+
+namespace game::factory {
+
+/**
+ * @brief 敌人预制体：由敌人类型蓝图在载入时编译，批量生成时直接复制其中的组件。
+ *
+ * 动画帧的源矩形、音效表等只在编译时计算一次。含有容器的组件 (动画、音效) 只是原型，
+ * 生成时逐个复制到实体工厂的内存资源中 (复制构造会回到默认资源，因此不能直接复制)。
+ * 与等级、稀有度有关的属性每批计算一次。
+ */
+struct EnemyPrefab {
+    entt::id_type class_id_{entt::null};
+    engine::component::SpriteComponent sprite_;         ///< @brief 精灵 (不翻转)
+    bool face_left_{false};                             ///< @brief 图片朝左 (添加 FaceLeftTag)
+    engine::component::AnimationComponent animation_;   ///< @brief 动画原型 (默认动画为“walk”)
+    engine::component::AudioComponent audio_;           ///< @brief 音效原型
+    bool has_audio_{false};                             ///< @brief 是否有音效 (没有时不添加音效组件)
+    data::StatsBlueprint stats_;
+    float speed_{0.0f};                                 ///< @brief 移动速度
+    bool ranged_{false};                                ///< @brief 远程 (否则为近战)
+    entt::id_type projectile_id_{entt::null};
+    game::component::ClassNameComponent class_name_;
+};
+
+/**
+ * @brief 玩家职业预制体 (见 EnemyPrefab)
+ */
+struct PlayerPrefab {
+    entt::id_type class_id_{entt::null};
+    engine::component::SpriteComponent sprite_;
+    bool face_left_{false};
+    engine::component::AnimationComponent animation_;   ///< @brief 动画原型 (默认动画为“idle”)
+    engine::component::AudioComponent audio_;
+    bool has_audio_{false};
+    data::StatsBlueprint stats_;
+    data::PlayerBlueprint player_;                      ///< @brief 类型、阻挡数、费用等
+    game::component::SkillComponent skill_;             ///< @brief 技能原型 (计时器由 TimerSystem 在组件创建时调度)
+    bool passive_skill_{false};                         ///< @brief 被动技能 (添加 PassiveSkillTag 与 SkillReadyTag)
+    entt::id_type projectile_id_{entt::null};
+    game::component::ClassNameComponent class_name_;
+};
+
+}   // namespace game::factory
@@ -0,0 +1,284 @@
+#include "stress_level_generator.h"
+#include "../data/stress_config.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <glm/geometric.hpp>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <entt/core/hashed_string.hpp>
+
+namespace game::loader {
+
+namespace {
+    constexpr int TILE_SIZE = 64;                   ///< @brief 瓦片大小 (与现有地图相同)
+    constexpr int TILEMAP_FIRST_GID = 1;            ///< @brief tileset/Tilemap.tsj 的 firstgid
+    constexpr int BUILDINGS_FIRST_GID = 709;        ///< @brief tileset/buildings.tsj 的 firstgid (与 level1.tmj 相同)
+    constexpr int MELEE_PLACE_GID = BUILDINGS_FIRST_GID + 10;   ///< @brief 近战地点瓦片 (melee_place.png)
+    constexpr int RANGED_PLACE_GID = BUILDINGS_FIRST_GID + 11;  ///< @brief 远程地点瓦片 (range_place.png)
+    constexpr float OFFSCREEN_MARGIN = 48.0f;       ///< @brief 起点与终点位于地图外的距离
+    constexpr float PLACE_SPACING = 80.0f;          ///< @brief 地点中心之间的最小距离
+    constexpr float RANGED_OFFSET_MIN = 96.0f;      ///< @brief 远程地点与路径的距离范围
+    constexpr float RANGED_OFFSET_MAX = 160.0f;
+    constexpr int PLACE_ATTEMPTS = 16;              ///< @brief 每个地点的尝试次数 (找不到合适位置时放弃)
+}
+
+StressLevelGenerator::StressLevelGenerator(const game::data::StressConfig& config)
+    : config_(config), random_(config.seed_) {}
+
+bool StressLevelGenerator::generate(game::data::LevelData& level_data) {
+    random_.reseed(config_.seed_);     // 每次生成都从头开始，相同配置得到相同地图
+
+    std::vector<Segment> segments;
+    auto path_layer = buildPathLayer(segments);
+    int next_object_id = config_.lanes_ * config_.waypoints_per_lane_ + 2;  // 路径节点之后的对象ID
+    auto placement_layer = buildPlacementLayer(segments, next_object_id);
+    const auto place_count = placement_layer["objects"].size();
+
+    // 组装 Tiled 地图 (只包含 LevelLoader 用到的字段)
+    nlohmann::ordered_json map;
+    map["backgroundcolor"] = "#47aba9";
+    map["compressionlevel"] = -1;
+    map["height"] = config_.map_rows_;
+    map["infinite"] = false;
+    auto& layers = map["layers"] = nlohmann::ordered_json::array();
+    if (config_.ground_gid_ > 0) {
+        layers.push_back(buildGroundLayer());
+    }
+    layers.push_back(std::move(path_layer));
+    layers.push_back(std::move(placement_layer));
+    map["nextlayerid"] = 4;
+    map["nextobjectid"] = next_object_id;
+    map["orientation"] = "orthogonal";
+    map["renderorder"] = "right-down";
+    map["tiledversion"] = "1.11.2";
+    map["tileheight"] = TILE_SIZE;
+    map["tilesets"] = nlohmann::ordered_json::array({
+        {{"firstgid", TILEMAP_FIRST_GID}, {"source", "tileset/Tilemap.tsj"}},
+        {{"firstgid", BUILDINGS_FIRST_GID}, {"source", "tileset/buildings.tsj"}},
+    });
+    map["tilewidth"] = TILE_SIZE;
+    map["type"] = "map";
+    map["version"] = "1.10";
+    map["width"] = config_.map_columns_;
+
+    auto map_path = std::filesystem::path(config_.map_path_);
+    std::ofstream file(map_path);
+    if (!file.is_open()) {
+        spdlog::error("not open stress map file for writing: {}", config_.map_path_);
+        return false;
+    }
+    file << map.dump();
+    file.close();
+
+    // 关卡数据
+    level_data.name_ = config_.name_;
+    level_data.map_path_ = config_.map_path_;
+    level_data.enemy_level_ = config_.enemy_level_;
+    level_data.enemy_rarity_ = config_.enemy_rarity_;
+    level_data.prep_time_ = config_.prep_time_;
+    level_data.home_hp_ = config_.home_hp_;
+    level_data.waves_data_ = buildWaves(level_data.total_enemy_count_);
+    level_data.waves_data_.next_wave_count_down_ = config_.prep_time_;
+    level_data.preset_units_ = config_.player_units_;
+
+    spdlog::info("stress level generated: {} waypoints, {} places, {} enemies in {} waves -> {}",
+                 config_.lanes_ * config_.waypoints_per_lane_ + 1, place_count, level_data.total_enemy_count_,
+                 level_data.waves_data_.waves_.size(), config_.map_path_);
+    return true;
+}
+
+nlohmann::ordered_json StressLevelGenerator::buildGroundLayer() const {
+    const auto tile_count = static_cast<std::size_t>(config_.map_columns_) * static_cast<std::size_t>(config_.map_rows_);
+    return {
+        {"data", std::vector<int>(tile_count, config_.ground_gid_)},
+        {"height", config_.map_rows_},
+        {"id", 1},
+        {"name", "ground"},
+        {"opacity", 1},
+        {"type", "tilelayer"},
+        {"visible", true},
+        {"width", config_.map_columns_},
+        {"x", 0},
+        {"y", 0},
+    };
+}
+
+nlohmann::ordered_json StressLevelGenerator::buildPathLayer(std::vector<Segment>& segments) {
+    const int lanes = config_.lanes_;
+    const int count = config_.waypoints_per_lane_;
+    const float map_width = static_cast<float>(config_.map_columns_ * TILE_SIZE);
+    const float map_height = static_cast<float>(config_.map_rows_ * TILE_SIZE);
+    const float lane_spacing = map_height / static_cast<float>(lanes);
+    const float step = (map_width + 2.0f * OFFSCREEN_MARGIN) / static_cast<float>(count);
+    // 节点ID：路线 lane 上第 index 个节点为 1 + lane * count + index，终点在最后
+    auto node_id = [count](int lane, int index) { return 1 + lane * count + index; };
+    const int end_id = lanes * count + 1;
+
+    // 节点坐标：起点在地图左侧外，其余节点纵向随机偏移
+    std::vector<glm::vec2> positions(static_cast<std::size_t>(end_id) + 1);
+    for (int lane = 0; lane < lanes; ++lane) {
+        const float lane_y = lane_spacing * (static_cast<float>(lane) + 0.5f);
+        for (int index = 0; index < count; ++index) {
+            const float offset = index == 0 ? 0.0f : randomFloat(-0.5f, 0.5f) * config_.jitter_ * lane_spacing;
+            positions[node_id(lane, index)] = {-OFFSCREEN_MARGIN + step * static_cast<float>(index), lane_y + offset};
+        }
+    }
+    positions[end_id] = {map_width + OFFSCREEN_MARGIN, map_height * 0.5f};
+
+    auto objects = nlohmann::ordered_json::array();
+    auto add_node = [&](int id, const std::vector<int>& next_ids, bool start) {
+        auto properties = nlohmann::ordered_json::array();
+        for (std::size_t i = 0; i < next_ids.size(); ++i) {
+            // 属性名以 next 开头即可 (next, next1, next2 ...)
+            properties.push_back({{"name", i == 0 ? std::string("next") : "next" + std::to_string(i)},
+                                  {"type", "object"}, {"value", next_ids[i]}});
+            segments.push_back({positions[id], positions[next_ids[i]]});
+        }
+        if (start) {
+            properties.push_back({{"name", "start"}, {"type", "bool"}, {"value", true}});
+        }
+        objects.push_back({
+            {"height", 0}, {"id", id}, {"name", ""}, {"point", true}, {"properties", std::move(properties)},
+            {"rotation", 0}, {"type", ""}, {"visible", true}, {"width", 0},
+            {"x", positions[id].x}, {"y", positions[id].y},
+        });
+    };
+
+    for (int lane = 0; lane < lanes; ++lane) {
+        for (int index = 0; index < count; ++index) {
+            std::vector<int> next_ids;
+            if (index == count - 1) {
+                next_ids.push_back(end_id);     // 所有路线汇合到终点
+            } else {
+                next_ids.push_back(node_id(lane, index + 1));
+                // 分叉：随机连接相邻路线的下一个节点
+                std::vector<int> neighbors;
+                if (lane > 0) neighbors.push_back(node_id(lane - 1, index + 1));
+                if (lane < lanes - 1) neighbors.push_back(node_id(lane + 1, index + 1));
+                random_.shuffle(neighbors.begin(), neighbors.end());
+                const auto extra = std::min(neighbors.size(), static_cast<std::size_t>(config_.branching_ - 1));
+                next_ids.insert(next_ids.end(), neighbors.begin(), neighbors.begin() + static_cast<std::ptrdiff_t>(extra));
+            }
+            add_node(node_id(lane, index), next_ids, index == 0);
+        }
+    }
+    add_node(end_id, {}, false);    // 终点没有下一个节点 (properties 为空数组)
+
+    return {
+        {"draworder", "topdown"},
+        {"id", 2},
+        {"name", "path"},
+        {"objects", std::move(objects)},
+        {"opacity", 1},
+        {"type", "objectgroup"},
+        {"visible", true},
+        {"x", 0},
+        {"y", 0},
+    };
+}
+
+nlohmann::ordered_json StressLevelGenerator::buildPlacementLayer(const std::vector<Segment>& segments, int& next_object_id) {
+    const float map_width = static_cast<float>(config_.map_columns_ * TILE_SIZE);
+    const float map_height = static_cast<float>(config_.map_rows_ * TILE_SIZE);
+    const float half_tile = TILE_SIZE * 0.5f;
+    std::vector<glm::vec2> centers;
+    auto objects = nlohmann::ordered_json::array();
+    int skipped_count = 0;
+
+    // 在随机路径段上找一个位置：近战地点在路径上，远程地点在路径一侧
+    auto place = [&](int gid, bool on_path) {
+        for (int attempt = 0; attempt < PLACE_ATTEMPTS; ++attempt) {
+            const auto& segment = segments[random_.randomInt(0, static_cast<int>(segments.size()) - 1)];
+            const auto direction = segment.to_ - segment.from_;
+            auto center = segment.from_ + direction * randomFloat(0.15f, 0.85f);
+            if (!on_path && glm::length(direction) > 0.0f) {
+                const auto normal = glm::normalize(glm::vec2(-direction.y, direction.x));
+                const float side = random_.randomInt(0, 1) == 0 ? -1.0f : 1.0f;
+                center += normal * side * randomFloat(RANGED_OFFSET_MIN, RANGED_OFFSET_MAX);
+            }
+            if (center.x < half_tile || center.x > map_width - half_tile ||
+                center.y < half_tile || center.y > map_height - half_tile) continue;
+            const bool overlapped = std::any_of(centers.begin(), centers.end(), [&](const glm::vec2& other) {
+                return glm::length(other - center) < PLACE_SPACING;
+            });
+            if (overlapped) continue;
+
+            centers.push_back(center);
+            // 图片对象的坐标为左下角
+            objects.push_back({
+                {"gid", gid}, {"height", TILE_SIZE}, {"id", next_object_id++}, {"name", ""}, {"rotation", 0},
+                {"type", ""}, {"visible", true}, {"width", TILE_SIZE},
+                {"x", center.x - half_tile}, {"y", center.y + half_tile},
+            });
+            return;
+        }
+        ++skipped_count;
+    };
+
+    if (!segments.empty()) {
+        for (int i = 0; i < config_.melee_places_; ++i) place(MELEE_PLACE_GID, true);
+        for (int i = 0; i < config_.ranged_places_; ++i) place(RANGED_PLACE_GID, false);
+    }
+    if (skipped_count > 0) {
+        spdlog::warn("stress map has no room for {} places, map too small", skipped_count);
+    }
+
+    return {
+        {"draworder", "topdown"},
+        {"id", 3},
+        {"name", "placement"},
+        {"objects", std::move(objects)},
+        {"opacity", 1},
+        {"type", "objectgroup"},
+        {"visible", true},
+        {"x", 0},
+        {"y", 0},
+    };
+}
+
+game::data::Waves StressLevelGenerator::buildWaves(int& total_enemy_count) const {
+    game::data::Waves waves;
+    total_enemy_count = 0;
+    int weight_sum = 0;
+    for (const auto& [enemy_type, weight] : config_.enemy_weights_) weight_sum += weight;
+    if (weight_sum <= 0) {
+        spdlog::error("stress config has no enemy types");
+        return waves;
+    }
+
+    for (int i = 0; i < config_.wave_count_; ++i) {
+        const int count = std::max(1, config_.enemies_per_wave_ + config_.enemies_per_wave_growth_ * i);
+        game::data::Wave wave;
+        wave.next_wave_interval_ = config_.next_wave_interval_;
+        wave.spawn_interval_ = config_.spawn_interval_;
+        wave.spawn_count_ = config_.spawn_count_;
+        // 按权重分配数量，余数给第一个类型
+        int assigned = 0;
+        for (const auto& [enemy_type, weight] : config_.enemy_weights_) {
+            const int type_count = count * weight / weight_sum;
+            if (type_count <= 0) continue;
+            wave.enemy_types_.emplace_back(entt::hashed_string(enemy_type.c_str()), type_count);
+            assigned += type_count;
+        }
+        if (assigned < count) {
+            if (wave.enemy_types_.empty()) {
+                const auto& enemy_type = config_.enemy_weights_.front().first;
+                wave.enemy_types_.emplace_back(entt::hashed_string(enemy_type.c_str()), 0);
+            }
+            wave.enemy_types_.front().second += count - assigned;
+        }
+        total_enemy_count += count;
+        waves.waves_.push(std::move(wave));
+    }
+    return waves;
+}
+
+float StressLevelGenerator::randomFloat(float min, float max) {
+    // 整数随机数换算为浮点数，足够生成地图
+    constexpr int STEPS = 1 << 16;
+    return min + (max - min) * static_cast<float>(random_.randomInt(0, STEPS)) / static_cast<float>(STEPS);
+}
+
+} // namespace game::loader
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../data/level_data.h"
+#include "../../engine/utils/random.h"
+#include <vector>
+#include <glm/vec2.hpp>
+#include <nlohmann/json_fwd.hpp>
+
+namespace game::data {
+    class StressConfig;
+}
+
+namespace game::loader {
+
+/**
+ * @brief 压力测试关卡生成器。
+ *
+ * 按 StressConfig 生成 Tiled 地图文件 (.tmj) 与对应的关卡数据：
+ * 1. 路径网络：多条自左向右的路线，节点可以分叉到相邻路线，最后汇合到同一个终点 (EntityBuilderMW 的路径格式)。
+ * 2. 放置地点：近战地点位于路径上，远程地点位于路径两侧 (buildings.tsj 中的地点瓦片)。
+ * 3. 波次：按敌人类型权重分配每一波的敌人数量。
+ * 生成的地图由 LevelLoader 正常载入，游戏中的其余流程与普通关卡相同。
+ */
+class StressLevelGenerator final {
+    const game::data::StressConfig& config_;
+    engine::utils::Random random_;
+
+public:
+    explicit StressLevelGenerator(const game::data::StressConfig& config);
+
+    // 删除复制/移动操作
+    StressLevelGenerator(const StressLevelGenerator&) = delete;
+    StressLevelGenerator& operator=(const StressLevelGenerator&) = delete;
+    StressLevelGenerator(StressLevelGenerator&&) = delete;
+    StressLevelGenerator& operator=(StressLevelGenerator&&) = delete;
+
+    /**
+     * @brief 生成地图文件并返回关卡数据
+     * @param level_data 输出的关卡数据 (关卡编号由 LevelConfig::addLevel 设置)
+     * @return 地图文件是否写入成功
+     */
+    [[nodiscard]] bool generate(game::data::LevelData& level_data);
+
+private:
+    /// @brief 路径段 (用于在路径附近放置地点)
+    struct Segment {
+        glm::vec2 from_;
+        glm::vec2 to_;
+    };
+
+    nlohmann::ordered_json buildGroundLayer() const;
+    nlohmann::ordered_json buildPathLayer(std::vector<Segment>& segments);
+    nlohmann::ordered_json buildPlacementLayer(const std::vector<Segment>& segments, int& next_object_id);
+    game::data::Waves buildWaves(int& total_enemy_count) const;
+
+    float randomFloat(float min, float max);
+};
+
+} // namespace game::loader
@@ -33,6 +33,9 @@ void EndScene::init() {
 
 void EndScene::render() {
     engine::scene::Scene::render();
+}
+
+void EndScene::renderImGui() {
     debug_ui_system_->updateEnd(*this);
 }
 
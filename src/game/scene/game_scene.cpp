@@ -19,6 +19,7 @@
 #include "../system/projectile_system.h"
 #include "../system/effect_system.h"
 #include "../system/health_bar_system.h"
+#include "../system/floating_text_system.h"
 #include "../system/game_rule_system.h"
 #include "../system/place_unit_system.h"
 #include "../system/render_range_system.h"
@@ -26,9 +27,18 @@
 #include "../system/selection_system.h"
 #include "../system/skill_system.h"
 #include "../ui/units_portrait_ui.h"
+#include "../component/place_occupied_component.h"
+#include "../defs/snapshot_components.h"
+#include "../defs/tags.h"
 #include "../../engine/audio/audio_player.h"
+#include "../../engine/component/render_component.h"
+#include "../../engine/component/sprite_component.h"
+#include "../../engine/component/transform_component.h"
 #include "../../engine/core/context.h"
+#include "../../engine/core/ecs_telemetry.h"
 #include "../../engine/core/game_state.h"
+#include "../../engine/core/replay_manager.h"
+#include "../../engine/core/timing_wheel.h"
 #include "../../engine/system/render_system.h"
 #include "../../engine/system/movement_system.h"
 #include "../../engine/system/animation_system.h"
@@ -36,9 +46,16 @@
 #include "../../engine/system/audio_system.h"
 #include "../../engine/loader/level_loader.h"
 #include "../../engine/ui/ui_manager.h"
+#include "../../engine/resource/resource_manager.h"
+#include "../../engine/resource/resource_scope.h"
+#include "../../engine/input/input_manager.h"
+#include "../../engine/serialization/registry_snapshot.h"
+#include "../../engine/utils/events.h"
+#include <SDL3/SDL_timer.h>
 #include <entt/core/hashed_string.hpp>
 #include <entt/signal/sigh.hpp>
 #include <spdlog/spdlog.h>
+#include <utility>
 
 using namespace entt::literals;
 
@@ -50,10 +67,12 @@ GameScene::GameScene(engine::core::Context& context,
     std::shared_ptr<game::data::UIConfig> ui_config,
     std::shared_ptr<game::data::LevelConfig> level_config)
     : engine::scene::Scene("GameScene", context),
+      timing_wheel_(std::make_unique<engine::core::TimingWheel>()),
       blueprint_manager_(blueprint_manager),
       session_data_(session_data),
       ui_config_(ui_config),
-      level_config_(level_config)
+      level_config_(level_config),
+      resource_scope_(std::make_unique<engine::resource::ResourceScope>("GameScene"))
 {
     spdlog::info("GameScene build complete");
 }
@@ -62,6 +81,8 @@ GameScene::~GameScene() {
 }
 
 void GameScene::init() {
+    // 初始化期间获取的资源（地图、图块、UI、音效等）都由本场景的资源作用域持有，clean() 时归还
+    engine::resource::ResourceScopeRecorder scope_recorder(context_.getResourceManager(), *resource_scope_);
     if (!initSessionData()) {
         spdlog::error("init session_data_ failed");
         return;
@@ -106,6 +127,20 @@ void GameScene::init() {
         spdlog::error("init enemy spawner failed"); 
         return; 
     }
+    if (!initPresetUnits()) {
+        spdlog::error("init preset units failed");
+        return;
+    }
+    if (!initReplay()) {
+        spdlog::error("init replay failed");
+        return;
+    }
+    if (!initTelemetry()) {
+        spdlog::error("init telemetry failed");
+        return;
+    }
+    // 保存关卡加载完成时的状态，重开关卡时直接恢复
+    saveSnapshot(restart_snapshot_);
 
     context_.getGameState().setState(engine::core::State::Playing);
     context_.getAudioPlayer().playMusic("battle_bgm"_hs);
@@ -113,6 +148,11 @@ void GameScene::init() {
 }
 
 void GameScene::update(float delta_time) {
+    // 结算上一次事件分发中收到的攻击与治疗 (按目标合并，需在快照与其它系统之前，与事件分发时直接结算的结果相同)
+    combat_resolve_system_->update();
+    // 重开关卡、快速存读档在帧开始时处理
+    processSnapshotRequests();
+
     auto& dispatcher = context_.getDispatcher();
 
     // 事件总线处理完一下内容
@@ -120,7 +160,7 @@ void GameScene::update(float delta_time) {
     // 引擎层音频系统，接受播放音效事件;
     // 游戏层动画状态系统，处理动画播放完毕，根据状态发送切换动画事件，如果是一次性动画实体，添加死亡标签;
     // 游戏层动画事件系统，处理动画事件，发送动画事件(攻击事件，治疗事件，发射投射物事件等)，各发送音效事件到事件总线;
-    // 游戏层战斗结算系统，处理攻击事件，治疗事件，修改实体状态(血量等)，发送玩家移除单位事件，敌人添加死亡标签，发送特效事件到事件总线等;
+    // 游戏层战斗结算系统，收集攻击事件，治疗事件 (下一帧开始时按目标合并结算)，修改实体状态(血量等)，发送玩家移除单位事件，敌人添加死亡标签，发送特效事件到事件总线等;
     // 游戏层面投射物系统，处理投射物事件，创建投射物实体
     // 游戏层面特效系统，处理特效事件，创建特效实体
     // 游戏层游戏规则系统，处理敌人到达基地事件，处理玩家升级事件，加入特效和音频事件，处理玩家撤退事件，移除单位事件;
@@ -143,13 +183,16 @@ void GameScene::update(float delta_time) {
         selection_system_->update();
         units_portrait_ui_->update(delta_time);
         Scene::update(delta_time);
+        telemetry_->sample(registry_, dispatcher, context_.getResourceManager());
         return;
     }
 
     // 注意系统更新的顺序
+    // 推进时间轮，到期的计时器依次触发:
     // 冷却时间到了加上可攻击标签(AttackReadyTag);
     // 技能冷却到了加上可释放标签(SkillReadyTag)，发送技能准备就绪事件，等待UI系统触发添加技能激活事件;
     // 技能持续时间到了移除技能激活标签(SkillActiveTag)，发送技能持续结束事件;
+    // 通关延迟结束发送通关事件；波次倒计时与波次内生成间隔到了生成敌人;
     timer_system_->update(delta_time);
     // 更新当前场景的cost
     game_rule_system_->update(delta_time);
@@ -159,7 +202,7 @@ void GameScene::update(float delta_time) {
     // 玩家攻击性角色设置目标组件(TargetComponent);
     // 远程敌人角色设置目标组件(TargetComponent);
     // 玩家治疗者角色设置目标组件(TargetComponent);
-    set_target_system_->update(registry_);
+    set_target_system_->update();
     // 排除“被阻挡的敌人”和“动作锁定敌人”，根据下一个目标节点计算速度向量
     follow_path_system_->update(registry_, dispatcher, waypoint_nodes_);
     // 解决敌我双方朝向问题
@@ -172,8 +215,10 @@ void GameScene::update(float delta_time) {
     projectile_system_->update(delta_time);
     // 移动
     movement_system_->update(registry_, delta_time);
+    // 战斗飘字上升并淡出 (不是实体，不参与其它系统)
+    floating_text_system_->update(delta_time);
     // 有动画事件(比如:攻击事件)加入事件总线，有动画完毕事件加入事件总线
-    animation_system_->update(delta_time);
+    animation_system_->update(delta_time, context_.getCamera());
     // 准备放置单位在世界移动颜色变化和鼠标跟随
     place_unit_system_->update(delta_time);
     // 让RenderComponent的深度depth等于TransformComponent的y坐标
@@ -181,12 +226,14 @@ void GameScene::update(float delta_time) {
     // 处理鼠标在玩家单位上或者敌人单位上的悬停事件
     selection_system_->update();
 
-    // 场景中其他更新函数
-    enemy_spawner_->update(delta_time);
+    // 场景中其他更新函数 (生成由时间轮驱动，这里只同步波次倒计时)
+    enemy_spawner_->update();
     // 场景中头像UI更新
     units_portrait_ui_->update(delta_time);
     // UI更新等
     Scene::update(delta_time);
+    // 统计本帧结束时的注册表规模与排队中的事件 (事件在场景更新之后才分发)
+    telemetry_->sample(registry_, dispatcher, context_.getResourceManager());
 }
 
 void GameScene::render() {
@@ -194,11 +241,15 @@ void GameScene::render() {
     auto& camera = context_.getCamera();
     
     // 注意渲染顺序，保证正确的遮盖关系
-    render_system_->update(registry_, renderer, camera);
+    render_system_->update(renderer, camera);
     health_bar_system_->update(registry_, renderer, camera);
+    floating_text_system_->render(renderer, camera);
     render_range_system_->update(registry_, renderer, camera);
 
     Scene::render();
+}
+
+void GameScene::renderImGui() {
     // 当场景栈中只有GameScene时才渲染调试UI, 不然上层有其它场景时会冲突
     if (context_.getGameState().isPlaying() || context_.getGameState().isPaused()) {
         debug_ui_system_->update();     // 调试UI的显示优先级最高，最后渲染
@@ -210,6 +261,20 @@ void GameScene::clean() {
     // 断开所有事件连接
     dispatcher.disconnect(this);
     // 断开输入信号连接
+    auto& input_manager = context_.getInputManager();
+    input_manager.onAction("quick_save"_hs).disconnect<&GameScene::onQuickSaveAction>(this);
+    input_manager.onAction("quick_load"_hs).disconnect<&GameScene::onQuickLoadAction>(this);
+    endReplay();
+    // 归还本关卡资源的引用，超出预算的部分会被淘汰
+    context_.getResourceManager().releaseScope(*resource_scope_);
+    // 敌人队列与实体工厂的预制体都使用场景内存，需在 Scene::clean() 释放场景内存之前销毁
+    // (先销毁持有实体工厂引用的对象，再销毁实体工厂)
+    enemy_spawner_.reset();
+    projectile_system_.reset();
+    effect_system_.reset();
+    place_unit_system_.reset();
+    skill_system_.reset();
+    entity_factory_.reset();
     Scene::clean();
 }
 
@@ -233,6 +298,7 @@ bool GameScene::initLevelConfig() {
     }
     waves_ = level_config_->getWavesData(level_number_);
     game_stats_.enemy_count_ = level_config_->getTotalEnemyCount(level_number_);
+    game_stats_.home_hp_ = game_stats_.max_home_hp_ = level_config_->getHomeHp(level_number_);
     return true;
 }
 
@@ -268,13 +334,18 @@ bool GameScene::initEventConnections() {
     dispatcher.sink<game::defs::RestartEvent>().connect<&GameScene::onRestart>(this);
     dispatcher.sink<game::defs::BackToTitleEvent>().connect<&GameScene::onBackToTitle>(this);
     dispatcher.sink<game::defs::SaveEvent>().connect<&GameScene::onSave>(this);
+    dispatcher.sink<game::defs::QuickSaveEvent>().connect<&GameScene::onQuickSave>(this);
+    dispatcher.sink<game::defs::QuickLoadEvent>().connect<&GameScene::onQuickLoad>(this);
     dispatcher.sink<game::defs::LevelClearEvent>().connect<&GameScene::onLevelClear>(this);
     dispatcher.sink<game::defs::GameEndEvent>().connect<&GameScene::onGameEndEvent>(this);
     return true;
 }
 
 bool GameScene::initInputConnections() {
-    // 未来可添加输入控制，记得在close函数中断开
+    // 记得在clean函数中断开
+    auto& input_manager = context_.getInputManager();
+    input_manager.onAction("quick_save"_hs).connect<&GameScene::onQuickSaveAction>(this);
+    input_manager.onAction("quick_load"_hs).connect<&GameScene::onQuickLoadAction>(this);
     return true;
 }
 
@@ -290,7 +361,7 @@ bool GameScene::initEntityFactory() {
             return false;
         }
     }
-    entity_factory_ = std::make_unique<game::factory::EntityFactory>(registry_, *blueprint_manager_);
+    entity_factory_ = std::make_unique<game::factory::EntityFactory>(registry_, *blueprint_manager_, getMemoryResource());
     spdlog::info("entity_factory_ init complete");
     return true;
 }
@@ -306,6 +377,9 @@ bool GameScene::initRegistryContext() {
     registry_.ctx().emplace<game::data::GameStats&>(game_stats_);
     registry_.ctx().emplace<game::data::Waves&>(waves_);
     registry_.ctx().emplace<int&>(level_number_);
+    registry_.ctx().emplace<engine::core::TimingWheel&>(*timing_wheel_);
+    registry_.ctx().emplace<engine::utils::Random&>(random_);
+    registry_.ctx().emplace<engine::memory::LinearArena&>(arena_);    // 场景内存统计 (调试UI)
     registry_.ctx().emplace_as<entt::entity&>("selected_unit"_hs, selected_unit_);
     registry_.ctx().emplace_as<entt::entity&>("hovered_unit"_hs, hovered_unit_);
     registry_.ctx().emplace_as<bool&>("show_save_panel"_hs, show_save_panel_);
@@ -325,7 +399,7 @@ bool GameScene::initUnitsPortraitUI() {
 bool GameScene::initSystems() {
     auto& dispatcher = context_.getDispatcher();
     // 系统初始化需要在可能的依赖模块(如实体工厂)初始化之后
-    render_system_ = std::make_unique<engine::system::RenderSystem>();
+    render_system_ = std::make_unique<engine::system::RenderSystem>(registry_);
     movement_system_ = std::make_unique<engine::system::MovementSystem>();
     animation_system_ = std::make_unique<engine::system::AnimationSystem>(registry_, dispatcher);
     ysort_system_ = std::make_unique<engine::system::YSortSystem>();
@@ -334,9 +408,9 @@ bool GameScene::initSystems() {
     follow_path_system_ = std::make_unique<game::system::FollowPathSystem>();
     remove_dead_system_ = std::make_unique<game::system::RemoveDeadSystem>();
     block_system_ = std::make_unique<game::system::BlockSystem>();
-    set_target_system_ = std::make_unique<game::system::SetTargetSystem>();
+    set_target_system_ = std::make_unique<game::system::SetTargetSystem>(registry_, waypoint_nodes_);
     attack_starter_system_ = std::make_unique<game::system::AttackStarterSystem>();
-    timer_system_ = std::make_unique<game::system::TimerSystem>(registry_, dispatcher);
+    timer_system_ = std::make_unique<game::system::TimerSystem>(registry_, dispatcher, *timing_wheel_);
     orientation_system_ = std::make_unique<game::system::OrientationSystem>();
     animation_state_system_ = std::make_unique<game::system::AnimationStateSystem>(registry_, dispatcher);
     animation_event_system_ = std::make_unique<game::system::AnimationEventSystem>(registry_, dispatcher);
@@ -344,6 +418,13 @@ bool GameScene::initSystems() {
     projectile_system_ = std::make_unique<game::system::ProjectileSystem>(registry_, dispatcher, *entity_factory_);
     effect_system_ = std::make_unique<game::system::EffectSystem>(registry_, dispatcher, *entity_factory_);
     health_bar_system_ = std::make_unique<game::system::HealthBarSystem>();
+    try {
+        // 飘字系统需要创建位图字体图集，字体缺失等情况下会抛出异常
+        floating_text_system_ = std::make_unique<game::system::FloatingTextSystem>(dispatcher, context_.getRenderer(), context_.getResourceManager());
+    } catch (const std::exception& e) {
+        spdlog::error("create FloatingTextSystem failed: {}", e.what());
+        return false;
+    }
     game_rule_system_ = std::make_unique<game::system::GameRuleSystem>(registry_, dispatcher);
     place_unit_system_ = std::make_unique<game::system::PlaceUnitSystem>(registry_, *entity_factory_, context_);
     render_range_system_ = std::make_unique<game::system::RenderRangeSystem>();
@@ -354,15 +435,199 @@ bool GameScene::initSystems() {
     return true;
 }
 
+bool GameScene::initTelemetry() {
+    telemetry_ = std::make_unique<engine::core::EcsTelemetry>();
+    telemetry_->trackComponents(game::defs::SnapshotComponents{});
+    // 每帧都可能大量排队的事件，其余事件只计入总数
+    telemetry_->trackEvents<game::defs::AttackEvent,
+                            game::defs::HealEvent,
+                            game::defs::AreaEffectEvent,
+                            game::defs::CombatTextEvent,
+                            game::defs::EmitProjectileEvent,
+                            game::defs::EnemyDeadEffectEvent,
+                            game::defs::EffectEvent,
+                            game::defs::EnemyArriveHomeEvent,
+                            game::defs::RemovePlayerUnitEvent,
+                            game::defs::SkillReadyEvent,
+                            game::defs::SkillActiveEvent,
+                            game::defs::SkillDurationEndEvent,
+                            engine::utils::PlayAnimationEvent,
+                            engine::utils::AnimationFinishedEvent,
+                            engine::utils::AnimationEvent,
+                            engine::utils::PlaySoundEvent>();
+    registry_.ctx().emplace<engine::core::EcsTelemetry&>(*telemetry_);
+    spdlog::info("telemetry init complete");
+    return true;
+}
+
 bool GameScene::initEnemySpawner() {
     enemy_spawner_ = std::make_unique<game::spawner::EnemySpawner>(registry_, *entity_factory_);
     spdlog::info("enemy_spawner_ init complete");
     return true;
 }
 
+bool GameScene::initPresetUnits() {
+    const auto& preset_units = level_config_->getPresetUnits(level_number_);
+    if (preset_units.empty()) return true;
+
+    // 收集空闲的放置地点 (按载入顺序依次使用)
+    std::vector<entt::entity> melee_places;
+    std::vector<entt::entity> ranged_places;
+    for (auto entity : registry_.view<game::defs::MeleePlaceTag>(entt::exclude<game::component::PlaceOccupiedComponent>)) {
+        melee_places.push_back(entity);
+    }
+    for (auto entity : registry_.view<game::defs::RangedPlaceTag>(entt::exclude<game::component::PlaceOccupiedComponent>)) {
+        ranged_places.push_back(entity);
+    }
+    std::size_t melee_index = 0;
+    std::size_t ranged_index = 0;
+
+    int placed_count = 0;
+    int skipped_count = 0;
+    for (const auto& preset_unit : preset_units) {
+        const auto& blueprint = blueprint_manager_->getPlayerClassBlueprint(preset_unit.class_id_);
+        const bool is_melee = blueprint.player_.type_ == game::defs::PlayerType::MELEE;
+        auto& places = is_melee ? melee_places : ranged_places;
+        auto& index = is_melee ? melee_index : ranged_index;
+        for (int i = 0; i < preset_unit.count_; ++i) {
+            if (index >= places.size()) {
+                skipped_count += preset_unit.count_ - i;
+                break;
+            }
+            // 与手动放置相同：单位位于地点中心，地点添加占用组件
+            auto place_entity = places[index++];
+            const auto& transform = registry_.get<engine::component::TransformComponent>(place_entity);
+            const auto& sprite = registry_.get<engine::component::SpriteComponent>(place_entity);
+            auto position = transform.position_ + sprite.size_ * transform.scale_ / 2.0f;
+            auto unit_entity = entity_factory_->createPlayerUnit(preset_unit.class_id_, position, preset_unit.level_, preset_unit.rarity_);
+            registry_.emplace<game::component::PlaceOccupiedComponent>(place_entity, unit_entity);
+
+            // 渲染图层修正：确保玩家所在图层大于放置点图标的图层
+            const auto& render_place = registry_.get<engine::component::RenderComponent>(place_entity);
+            if (render_place.layer > engine::component::RenderComponent::MAIN_LAYER) {
+                registry_.get<engine::component::RenderComponent>(unit_entity).layer = render_place.layer + 1;
+            }
+            // 被动技能立刻释放
+            if (registry_.all_of<game::defs::PassiveSkillTag>(unit_entity)) {
+                context_.getDispatcher().enqueue(game::defs::SkillActiveEvent{unit_entity});
+            }
+            ++placed_count;
+        }
+    }
+    if (skipped_count > 0) {
+        spdlog::warn("not enough free places, {} preset units skipped", skipped_count);
+    }
+    spdlog::info("{} preset units placed", placed_count);
+    return true;
+}
+
+bool GameScene::initReplay() {
+    auto& replay_manager = context_.getReplayManager();
+    // 需要录制的界面(ImGui)事件。肖像UI派发的PrepUnitEvent由输入触发，回放输入即可复现，不需要录制
+    replay_manager.registerEvent<game::defs::UpgradeUnitEvent>();
+    replay_manager.registerEvent<game::defs::RetreatEvent>();
+    replay_manager.registerEvent<game::defs::SkillActiveEvent>();
+    replay_manager.registerEvent<game::defs::RestartEvent>();
+    replay_manager.registerEvent<game::defs::BackToTitleEvent>();
+    replay_manager.registerEvent<game::defs::QuickSaveEvent>();
+    replay_manager.registerEvent<game::defs::QuickLoadEvent>();
+    replay_manager.registerEvent<game::defs::LevelClearEvent>();
+
+    // 回放时使用录像的种子；确定性模式下录制本局 (初始数据为会话数据)
+    if (replay_manager.hasLoadedReplay()) {
+        random_.reseed(replay_manager.getReplaySeed());
+        replay_manager.startReplay();
+    } else {
+        random_.reseed(replay_manager.nextSeed());
+        if (replay_manager.isDeterministic()) {
+            replay_manager.startRecording(random_.getSeed(), session_data_->encode(game::data::SaveFormat::BINARY));
+        }
+    }
+    spdlog::info("random seed: {}", random_.getSeed());
+    return true;
+}
+
+void GameScene::endReplay() {
+    // 一局结束 (通关、失败或离开场景)：保存录像，或结束回放
+    auto& replay_manager = context_.getReplayManager();
+    if (replay_manager.isRecording()) {
+        replay_manager.stopRecording(context_.getSaveService(), replay_manager.getReplayPath());
+    } else {
+        replay_manager.stop();
+    }
+}
+
+// --- 快照相关函数 ---
+void GameScene::processSnapshotRequests() {
+    if (quick_save_requested_) {
+        quick_save_requested_ = false;
+        saveSnapshot(quick_save_snapshot_);
+    }
+    if (pending_snapshot_) {
+        const auto* snapshot = std::exchange(pending_snapshot_, nullptr);
+        const bool is_restart = (snapshot == &restart_snapshot_);
+        if (restoreSnapshot(*snapshot) && is_restart) {
+            context_.getGameState().setState(engine::core::State::Playing);
+        }
+    }
+}
+
+void GameScene::saveSnapshot(std::vector<std::byte>& buffer) {
+    const auto start_ns = SDL_GetTicksNS();
+    buffer.clear();     // 保留容量，重复保存时不再分配
+    engine::serialization::BinaryOutputArchive archive(buffer);
+    engine::serialization::saveRegistry(registry_, archive, game::defs::SnapshotComponents{});
+    // 注册表之外的关卡状态：计时器 (组件中保存了句柄)、波次、资源统计、随机数生成器、已出击单位的肖像
+    archive(*timing_wheel_, *enemy_spawner_, *game_rule_system_, game_stats_, waves_, random_, units_portrait_ui_->getRemovedPortraits());
+    spdlog::info("GameScene: snapshot saved ({} bytes) in {} us", buffer.size(), (SDL_GetTicksNS() - start_ns) / 1000);
+}
+
+bool GameScene::restoreSnapshot(const std::vector<std::byte>& buffer) {
+    const auto start_ns = SDL_GetTicksNS();
+    std::vector<entt::id_type> removed_portraits;
+    // 计时器随时间轮一起恢复，恢复期间不能为重新构造的组件调度新的计时器
+    timer_system_->disconnectSignals();
+    try {
+        // 组件中的容器从场景内存重新分配 (旧组件归还的内存会被复用)
+        engine::serialization::BinaryInputArchive archive(buffer, getMemoryResource());
+        engine::serialization::loadRegistry(registry_, archive, game::defs::SnapshotComponents{});
+        archive(*timing_wheel_, *enemy_spawner_, *game_rule_system_, game_stats_, waves_, random_, removed_portraits);
+    } catch (const std::exception& e) {
+        timer_system_->connectSignals();
+        spdlog::error("GameScene: failed to restore snapshot: {}", e.what());
+        return false;
+    }
+    timer_system_->connectSignals();
+
+    // 丢弃旧状态下产生、尚未分发的事件 (其中的实体已不存在或已被复用)
+    context_.getDispatcher().clear();
+    selected_unit_ = entt::null;
+    hovered_unit_ = entt::null;
+    floating_text_system_->clear();
+    units_portrait_ui_->rebuild(removed_portraits);
+    spdlog::info("GameScene: snapshot restored ({} bytes) in {} us", buffer.size(), (SDL_GetTicksNS() - start_ns) / 1000);
+    return true;
+}
+
+// --- 输入回调函数 ---
+bool GameScene::onQuickSaveAction() {
+    context_.getDispatcher().enqueue<game::defs::QuickSaveEvent>();
+    return true;
+}
+
+bool GameScene::onQuickLoadAction() {
+    context_.getDispatcher().enqueue<game::defs::QuickLoadEvent>();
+    return true;
+}
+
 // --- 场景相关函数 ---
 void GameScene::onRestart() {
     spdlog::info("restart level");
+    if (!restart_snapshot_.empty()) {
+        pending_snapshot_ = &restart_snapshot_;
+        return;
+    }
+    // 关卡初始化失败时没有快照，重新创建场景
     requestReplaceScene(std::make_unique<game::scene::GameScene>(
         context_, 
         blueprint_manager_,
@@ -384,8 +649,21 @@ void GameScene::onSave() {
     /* 用ImGui快速实现逻辑，未来再完善游戏内UI */
 }
 
+void GameScene::onQuickSave() {
+    quick_save_requested_ = true;
+}
+
+void GameScene::onQuickLoad() {
+    if (quick_save_snapshot_.empty()) {
+        spdlog::warn("GameScene: no quick save to load");
+        return;
+    }
+    pending_snapshot_ = &quick_save_snapshot_;
+}
+
 void GameScene::onLevelClear() {
     spdlog::info("level clear success");
+    endReplay();
     // 奖励点数 = 击杀数 + 基地血量 * 5
     const auto point = game_stats_.enemy_killed_count_ + game_stats_.home_hp_ * 5;
     session_data_->setLevelClear(true);
@@ -408,6 +686,7 @@ void GameScene::onLevelClear() {
 
 void GameScene::onGameEndEvent(const game::defs::GameEndEvent& event) {
     spdlog::info("game end, is_win: {}", event.is_win_);
+    endReplay();
     requestPushScene(std::make_unique<game::scene::EndScene>(context_, event.is_win_));
 }
 
@@ -9,6 +9,8 @@
 #include "../system/fwd.h"
 #include "../../engine/scene/scene.h"
 #include "../../engine/system/fwd.h"
+#include "../../engine/utils/random.h"
+#include <cstddef>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -22,6 +24,15 @@ namespace game::ui {
     class UnitsPortraitUI;
 }
 
+namespace engine::resource {
+    class ResourceScope;
+}
+
+namespace engine::core {
+    class TimingWheel;
+    class EcsTelemetry;
+}
+
 namespace game::factory {
     class EntityFactory;
     class BlueprintManager;
@@ -35,6 +46,8 @@ namespace game::scene {
 
 class GameScene final: public engine::scene::Scene {
 private:
+    std::unique_ptr<engine::core::TimingWheel> timing_wheel_;          // 时间轮，调度场景内的计时器 (需晚于各系统析构，因此放在最前)
+
     std::unique_ptr<engine::system::RenderSystem> render_system_;
     std::unique_ptr<engine::system::MovementSystem> movement_system_;
     std::unique_ptr<engine::system::AnimationSystem> animation_system_;
@@ -54,6 +67,7 @@ private:
     std::unique_ptr<game::system::ProjectileSystem> projectile_system_;
     std::unique_ptr<game::system::EffectSystem> effect_system_;
     std::unique_ptr<game::system::HealthBarSystem> health_bar_system_;
+    std::unique_ptr<game::system::FloatingTextSystem> floating_text_system_;
     std::unique_ptr<game::system::GameRuleSystem> game_rule_system_;
     std::unique_ptr<game::system::PlaceUnitSystem> place_unit_system_;
     std::unique_ptr<game::system::RenderRangeSystem> render_range_system_;
@@ -68,8 +82,11 @@ private:
     std::vector<int> start_points_;                                     // 起点ID列表
     game::data::GameStats game_stats_;                                  // 关卡内游戏统计数据
     game::data::Waves waves_;                                           // 关卡波次数据
+    engine::utils::Random random_;                                      // 场景的随机数生成器 (确定性模式下使用固定种子)
 
     std::unique_ptr<game::factory::EntityFactory> entity_factory_;      // 实体工厂，负责创建和管理实体
+    std::unique_ptr<engine::resource::ResourceScope> resource_scope_;   // 资源作用域，持有本关卡用到的资源，clean() 时归还
+    std::unique_ptr<engine::core::EcsTelemetry> telemetry_;             // ECS运行统计，每帧采样 (调试UI)
 
     // 管理数据的实例很可能同时被多个场景使用，因此使用共享指针
     std::shared_ptr<game::factory::BlueprintManager> blueprint_manager_;// 蓝图管理器，负责管理蓝图数据
@@ -83,6 +100,12 @@ private:
     entt::entity hovered_unit_{entt::null};         // 游戏中鼠标悬浮的单位
     bool show_save_panel_{false};                   // 是否显示保存面板
 
+    // --- 快照 (注册表及场景状态的二进制副本) ---
+    std::vector<std::byte> restart_snapshot_;       // 关卡加载完成时的快照，重开关卡时直接恢复，不再重新解析关卡
+    std::vector<std::byte> quick_save_snapshot_;    // 快速存档
+    const std::vector<std::byte>* pending_snapshot_{nullptr};  // 下一帧开始时要恢复的快照
+    bool quick_save_requested_{false};              // 下一帧开始时是否保存快速存档
+
 public:
     /**
      * @brief 构造函数
@@ -103,6 +126,7 @@ public:
     void init() override;
     void update(float delta_time) override;
     void render() override;
+    void renderImGui() override;
     void clean() override;
 
 private:
@@ -117,11 +141,27 @@ private:
     [[nodiscard]] bool initSystems();
     [[nodiscard]] bool initEnemySpawner();
     [[nodiscard]] bool initUnitsPortraitUI();
+    [[nodiscard]] bool initPresetUnits();       ///< @brief 放置关卡配置中的预置单位 (压力测试关卡等)
+    [[nodiscard]] bool initReplay();
+    [[nodiscard]] bool initTelemetry();
+
+    // 快照相关函数 (只在帧开始时调用，此时上一帧的事件已全部分发)
+    void processSnapshotRequests();                                 ///< @brief 处理快速存档与恢复请求
+    void saveSnapshot(std::vector<std::byte>& buffer);              ///< @brief 保存注册表与场景状态 (覆盖缓冲区内容，保留容量)
+    [[nodiscard]] bool restoreSnapshot(const std::vector<std::byte>& buffer);  ///< @brief 恢复快照
+
+    void endReplay();       ///< @brief 一局结束时保存录像或结束回放
+
+    // 输入回调函数
+    bool onQuickSaveAction();
+    bool onQuickLoadAction();
 
     // 场景相关函数
     void onRestart();
     void onBackToTitle();
     void onSave();
+    void onQuickSave();
+    void onQuickLoad();
     void onLevelClear();
     void onGameEndEvent(const game::defs::GameEndEvent& event);
 };
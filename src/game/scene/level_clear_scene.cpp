@@ -51,6 +51,9 @@ void LevelClearScene::init() {
 
 void LevelClearScene::render() {
     engine::scene::Scene::render();
+}
+
+void LevelClearScene::renderImGui() {
     debug_ui_system_->updateLevelClear(*this);
 }
 
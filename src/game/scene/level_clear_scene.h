@@ -37,6 +37,7 @@ public:
 
     void init() override;
     void render() override;
+    void renderImGui() override;
 
 private:
     // 按钮回调函数
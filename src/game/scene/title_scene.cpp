@@ -6,6 +6,7 @@
 #include "../../engine/core/context.h"
 #include "../../engine/core/time.h"
 #include "../../engine/core/game_state.h"
+#include "../../engine/core/replay_manager.h"
 #include "../../engine/audio/audio_player.h"
 #include "../../engine/utils/events.h"
 #include "../../engine/system/render_system.h"
@@ -56,7 +57,7 @@ void TitleScene::init() {
 
 void TitleScene::update(float delta_time) {
     engine::scene::Scene::update(delta_time);
-    animation_system_->update(delta_time);
+    animation_system_->update(delta_time, context_.getCamera());
     movement_system_->update(registry_, delta_time);
     ysort_system_->update(registry_);
 }
@@ -65,9 +66,12 @@ void TitleScene::render() {
     auto& renderer = context_.getRenderer();
     auto& camera = context_.getCamera();
 
-    render_system_->update(registry_, renderer, camera);
+    render_system_->update(renderer, camera);
 
     engine::scene::Scene::render();
+}
+
+void TitleScene::renderImGui() {
     debug_ui_system_->updateTitle(*this);
 }
 
@@ -128,7 +132,7 @@ bool TitleScene::initSystems() {
     // 初始化系统
     auto& dispatcher = context_.getDispatcher();
     debug_ui_system_ = std::make_unique<game::system::DebugUISystem>(registry_, context_);
-    render_system_ = std::make_unique<engine::system::RenderSystem>();
+    render_system_ = std::make_unique<engine::system::RenderSystem>(registry_);
     ysort_system_ = std::make_unique<engine::system::YSortSystem>();
     animation_system_ = std::make_unique<engine::system::AnimationSystem>(registry_, dispatcher);
     movement_system_ = std::make_unique<engine::system::MovementSystem>();
@@ -180,6 +184,26 @@ void TitleScene::onLoadGameClick() {
     /* 用ImGui快速实现逻辑，未来再完善游戏内UI */
 }
 
+void TitleScene::onReplayClick() {
+    auto& replay_manager = context_.getReplayManager();
+    if (!replay_manager.loadReplay(replay_manager.getReplayPath())) return;
+    // 录像开始时的会话数据 (关卡、角色等)，回放不影响当前会话
+    auto session_data = std::make_shared<game::data::SessionData>();
+    if (!session_data->decodeBinary(replay_manager.getReplayHeader())) {
+        spdlog::error("replay header is not valid session data");
+        replay_manager.stop();
+        return;
+    }
+    requestReplaceScene(std::make_unique<game::scene::GameScene>(
+        context_,
+        blueprint_manager_,
+        session_data,
+        ui_config_,
+        level_config_
+        )
+    );
+}
+
 void TitleScene::onQuitClick() {
     quit();
 }
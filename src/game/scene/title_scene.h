@@ -40,6 +40,7 @@ public:
     void init() override;
     void update(float delta_time) override;
     void render() override;
+    void renderImGui() override;
 
 private:
     // 初始化函数(init函数中调用)
@@ -56,6 +57,7 @@ private:
     void onStartGameClick();
     void onConfirmRoleClick();
     void onLoadGameClick();
+    void onReplayClick();
     void onQuitClick();
 };
 
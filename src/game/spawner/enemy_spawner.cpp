@@ -3,78 +3,127 @@
 #include "../data/waypoint_node.h"
 #include "../data/level_config.h"
 #include "../factory/entity_factory.h"
-#include "../../engine/utils/math.h"
+#include "../../engine/utils/random.h"
+#include "../../engine/core/timing_wheel.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
+#include <entt/core/hashed_string.hpp>
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <span>
+
+using namespace entt::literals;
 
 namespace game::spawner {
 
 EnemySpawner::EnemySpawner(entt::registry& registry, game::factory::EntityFactory& entity_factory)
- : registry_(registry), entity_factory_(entity_factory) {}
+ : registry_(registry), entity_factory_(entity_factory), timing_wheel_(registry.ctx().get<engine::core::TimingWheel&>()),
+   enemy_types_(entity_factory.getMemoryResource()),
+   start_points_(registry.ctx().get<std::vector<int>&>()),
+   waypoint_nodes_(registry.ctx().get<std::unordered_map<int, game::data::WaypointNode>&>()),
+   level_config_(*registry.ctx().get<std::shared_ptr<game::data::LevelConfig>&>()),
+   level_number_(registry.ctx().get<int&>()) {
+    timing_wheel_.connect<&EnemySpawner::onWaveTimer>("next_wave"_hs, this);
+    timing_wheel_.connect<&EnemySpawner::onSpawnTimer>("enemy_spawn"_hs, this);
+    // 第一波的倒计时即关卡的准备时间
+    auto& waves = registry_.ctx().get<game::data::Waves&>();
+    if (!waves.waves_.empty()) {
+        wave_timer_ = timing_wheel_.schedule(waves.next_wave_count_down_, "next_wave"_hs);
+    }
+}
 
-EnemySpawner::~EnemySpawner() {}
+EnemySpawner::~EnemySpawner() {
+    timing_wheel_.cancel(wave_timer_);
+    timing_wheel_.cancel(spawn_timer_);
+    timing_wheel_.disconnect("next_wave"_hs);
+    timing_wheel_.disconnect("enemy_spawn"_hs);
+}
 
-void EnemySpawner::update(float delta_time) {
+void EnemySpawner::update() {
     auto& waves = registry_.ctx().get<game::data::Waves&>();
-    // 如果“关卡波次队列”不为空，则考虑添加敌人
-    if (!waves.waves_.empty()) {
-        waves.next_wave_count_down_ -= delta_time;
-        // 如果已经到了新的一波，则弹出并载入敌人波次队列
-        if (waves.next_wave_count_down_ <= 0.0f) {
-            auto& wave = waves.waves_.front();
-            // 更新下一波次倒数计时器
-            waves.next_wave_count_down_ = wave.next_wave_interval_;
-            // 更新本波次敌人生成间隔与生成计时器
-            spawn_interval_ = wave.spawn_interval_;
-            spawn_timer_ = 0.0f;
-            // 先把所有敌人依次加入“当前波次队列”
-            for (auto& enemy_type : wave.enemy_types_) {
-                auto [class_id, count] = enemy_type;
-                for (int i = 0; i < count; ++i) {
-                    enemy_types_.push_back(class_id);
-                }
-            }
-            // 打乱队列，确保敌人生成顺序随机
-            engine::utils::shuffle(enemy_types_.begin(), enemy_types_.end());
-            
-            // 本波次数据处理完毕，弹出关卡波次队列头
-            waves.waves_.pop();
-            spdlog::info("start new wave enemy spawn");
+    waves.next_wave_count_down_ = timing_wheel_.remaining(wave_timer_);
+}
+
+void EnemySpawner::onWaveTimer(entt::entity) {
+    auto& waves = registry_.ctx().get<game::data::Waves&>();
+    if (waves.waves_.empty()) return;
+    // 到了新的一波，弹出并载入敌人波次队列
+    auto& wave = waves.waves_.front();
+    // 更新本波次敌人生成间隔与数量，并重新开始生成计时
+    spawn_interval_ = wave.spawn_interval_;
+    spawn_count_ = wave.spawn_count_;
+    timing_wheel_.cancel(spawn_timer_);
+    // 先把所有敌人依次加入“当前波次队列”
+    std::size_t wave_enemy_count = 0;
+    for (auto& enemy_type : wave.enemy_types_) {
+        auto [class_id, count] = enemy_type;
+        for (int i = 0; i < count; ++i) {
+            enemy_types_.push_back(class_id);
         }
+        wave_enemy_count += static_cast<std::size_t>(std::max(count, 0));
     }
-
-    // 如果“当前波次队列”不为空，则按“敌人生成间隔”生成敌人
+    // 预留本波次敌人的组件存储，生成时不再扩容
+    entity_factory_.reserveEnemies(wave_enemy_count);
+    // 打乱队列，确保敌人生成顺序随机
+    registry_.ctx().get<engine::utils::Random&>().shuffle(enemy_types_.begin(), enemy_types_.end());
     if (!enemy_types_.empty()) {
-        spawn_timer_ += delta_time;
-        if (spawn_timer_ >= spawn_interval_) {
-            spawn_timer_ = 0.0f;
-            spawnEnemy();       // 生成一个敌人
-        }
+        spawn_timer_ = timing_wheel_.schedule(spawn_interval_, "enemy_spawn"_hs);
+    }
+
+    // 还有后续波次时，调度下一波次计时器
+    const auto next_wave_interval = wave.next_wave_interval_;
+    waves.waves_.pop();
+    if (!waves.waves_.empty()) {
+        wave_timer_ = timing_wheel_.schedule(next_wave_interval, "next_wave"_hs);
     }
+    waves.next_wave_count_down_ = timing_wheel_.remaining(wave_timer_);
+    spdlog::info("start new wave enemy spawn");
 }
 
-void EnemySpawner::spawnEnemy() {
-    // 获取上下文数据
-    auto& start_points = registry_.ctx().get<std::vector<int>&>();
-    auto& waypoint_nodes = registry_.ctx().get<std::unordered_map<int, game::data::WaypointNode>&>();
-    auto& level_config = registry_.ctx().get<std::shared_ptr<game::data::LevelConfig>&>();
-    auto& level_number = registry_.ctx().get<int&>();
+void EnemySpawner::onSpawnTimer(entt::entity) {
+    if (enemy_types_.empty()) return;
+    // 生成一批敌人 (默认一个)
+    spawnEnemies(spawn_count_);
+    // “当前波次队列”不为空时，按“敌人生成间隔”继续生成
+    if (!enemy_types_.empty()) {
+        spawn_timer_ = timing_wheel_.schedule(spawn_interval_, "enemy_spawn"_hs);
+    }
+}
 
-    // 随机选择起点
-    auto random_index = engine::utils::randomInt(0, start_points.size() - 1);
-    auto start_index = start_points[random_index];
-    auto position = waypoint_nodes[start_index].position_;
-    auto level = level_config->getEnemyLevel(level_number);
-    auto rarity = level_config->getEnemyRarity(level_number);
+void EnemySpawner::spawnEnemies(int count) {
+    const auto level = level_config_.getEnemyLevel(level_number_);
+    const auto rarity = level_config_.getEnemyRarity(level_number_);
+    auto& random = registry_.ctx().get<engine::utils::Random&>();
 
-    // 弹出敌人类型
-    auto enemy_type = enemy_types_.front();
-    enemy_types_.pop_front();
+    // 依次随机选择起点并弹出敌人类型 (随机数的使用顺序与逐个生成时相同)
+    batch_types_.clear();
+    batch_positions_.clear();
+    batch_waypoints_.clear();
+    for (int i = 0; i < count && !enemy_types_.empty(); ++i) {
+        auto random_index = random.randomInt(0, static_cast<int>(start_points_.size()) - 1);
+        auto start_index = start_points_[random_index];
+        batch_types_.push_back(enemy_types_.front());
+        batch_positions_.push_back(waypoint_nodes_.at(start_index).position_);
+        batch_waypoints_.push_back(start_index);
+        enemy_types_.pop_front();
+    }
 
-    // 创建敌人
-    entity_factory_.createEnemyUnit(enemy_type, position, start_index, level, rarity);
-    spdlog::info("create enemy: type {}, position: {}, {}", enemy_type, position.x, position.y);
+    // 相同类型的连续敌人一起生成 (保持出队顺序，实体的创建顺序与逐个生成时相同)
+    const std::size_t total = batch_types_.size();
+    batch_entities_.resize(total);
+    std::size_t first = 0;
+    while (first < total) {
+        std::size_t last = first + 1;
+        while (last < total && batch_types_[last] == batch_types_[first]) ++last;
+        const std::size_t batch_size = last - first;
+        entity_factory_.spawnEnemyBatch(batch_types_[first],
+            std::span(batch_entities_).subspan(first, batch_size),
+            std::span<const glm::vec2>(batch_positions_).subspan(first, batch_size),
+            std::span<const int>(batch_waypoints_).subspan(first, batch_size),
+            level, rarity);
+        spdlog::info("create enemy: type {}, count {}", batch_types_[first], batch_size);
+        first = last;
+    }
 }
 
 }   // namespace game::spawner
\ No newline at end of file
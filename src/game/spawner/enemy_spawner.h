@@ -1,39 +1,80 @@
 #pragma once
 
+#include "../../engine/core/timer_handle.h"
+#include "../../engine/memory/pmr.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
-#include <deque>    // 双端队列：两端都可以入队或出队
+#include <glm/vec2.hpp>
 
 namespace game::factory {
     class EntityFactory;
 }
 
+namespace game::data {
+    struct WaypointNode;
+    class LevelConfig;
+}
+
+namespace engine::core {
+    class TimingWheel;
+}
+
 namespace game::spawner {
 
 /**
  * @brief 敌人生成器，根据波次数据生成敌人
+ * @note 波次倒计时与波次内的生成间隔都由场景的时间轮调度，到期时才会被唤醒。
+ * 每个生成间隔内的敌人按类型成批生成 (见 EntityFactory::spawnEnemyBatch)，波次开始时预留组件存储的容量。
  */
 class EnemySpawner {
     entt::registry& registry_;
     game::factory::EntityFactory& entity_factory_;
+    engine::core::TimingWheel& timing_wheel_;
 
-    float spawn_timer_{0.0f};               ///< @brief 波次内生成计时器 (单位：秒)
+    engine::core::TimerHandle wave_timer_{};    ///< @brief 下一波次计时器
+    engine::core::TimerHandle spawn_timer_{};   ///< @brief 波次内生成计时器
     float spawn_interval_{0.0f};            ///< @brief 波次内生成间隔 (单位：秒)
-    std::deque<entt::id_type> enemy_types_; ///< @brief 波次内敌人队列 (使用双端队列是为了支持随机打乱顺序)
+    int spawn_count_{1};                    ///< @brief 每个生成间隔生成的敌人数量
+    engine::memory::Deque<entt::id_type> enemy_types_;  ///< @brief 波次内敌人队列 (双端队列，支持随机打乱顺序；使用场景内存)
+
+    // --- 场景上下文中的数据 (构造时取得，地址在场景生命周期内不变) ---
+    const std::vector<int>& start_points_;                                          ///< @brief 起点ID列表
+    const std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes_;      ///< @brief 路径节点
+    const game::data::LevelConfig& level_config_;                                   ///< @brief 关卡配置
+    const int& level_number_;                                                       ///< @brief 当前关卡 (重开或读档时可能改变)
+
+    // --- 一次生成的敌人 (容量复用) ---
+    std::vector<entt::id_type> batch_types_;
+    std::vector<glm::vec2> batch_positions_;
+    std::vector<int> batch_waypoints_;
+    std::vector<entt::entity> batch_entities_;
 
 public:
     /**
      * @brief 构造函数
      * @param registry entt注册表
-     * @param entity_factory 实体工厂
+     * @param entity_factory 实体工厂 (敌人队列与它使用同一个内存资源)
      */
     EnemySpawner(entt::registry& registry, game::factory::EntityFactory& entity_factory);
     ~EnemySpawner();
 
-    void update(float delta_time);
+    void update();      ///< @brief 同步下一波次倒计时 (供UI显示)
+
+    /// @brief 读写快照 (计时器句柄需与时间轮一起保存)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(wave_timer_, spawn_timer_, spawn_interval_, spawn_count_, enemy_types_);
+    }
 
 private:
-    void spawnEnemy();
+    void spawnEnemies(int count);   ///< @brief 从队列中取出至多 count 个敌人，相同类型的连续敌人成批生成
+
+    // 时间轮回调函数
+    void onWaveTimer(entt::entity entity);     ///< @brief 下一波次开始
+    void onSpawnTimer(entt::entity entity);    ///< @brief 生成间隔到达
 };
 
 }   // namespace game::spawner
\ No newline at end of file
@@ -13,105 +13,232 @@
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <glm/common.hpp>
+#include <algorithm>
+#include <cmath>
 #include <spdlog/spdlog.h>
 
 using namespace entt::literals;
 
 namespace game::system {
 
+namespace {
+    constexpr float UNIT_CELL_SIZE = 128.0f;     ///< @brief 单位网格的格子边长 (与常见的溅射半径相近)
+}
+
 CombatResolveSystem::CombatResolveSystem(entt::registry& registry, entt::dispatcher& dispatcher)
-    : registry_(registry), dispatcher_(dispatcher) {
+    : registry_(registry), dispatcher_(dispatcher), unit_grid_(UNIT_CELL_SIZE) {
     dispatcher_.sink<game::defs::AttackEvent>().connect<&CombatResolveSystem::onAttackEvent>(this);
     dispatcher_.sink<game::defs::HealEvent>().connect<&CombatResolveSystem::onHealEvent>(this);
+    dispatcher_.sink<game::defs::AreaEffectEvent>().connect<&CombatResolveSystem::onAreaEffectEvent>(this);
+    registry_.on_destroy<game::component::StatsComponent>().connect<&CombatResolveSystem::onUnitDestroy>(this);
 }
 
 CombatResolveSystem::~CombatResolveSystem() {
     dispatcher_.disconnect(this);
+    registry_.on_destroy<game::component::StatsComponent>().disconnect(this);
+}
+
+void CombatResolveSystem::update() {
+    // 范围效果先展开为普通的攻击/治疗，与直接命中的一起按目标结算
+    if (!pending_areas_.empty()) {
+        expandAreaEffects();
+    }
+    if (pending_hits_.empty()) return;
+    // 按目标分组，同一目标内保持收到事件的顺序
+    std::sort(pending_hits_.begin(), pending_hits_.end(), [](const PendingHit& a, const PendingHit& b) {
+        if (a.target_ != b.target_) return entt::to_integral(a.target_) < entt::to_integral(b.target_);
+        return a.order_ < b.order_;
+    });
+
+    int killed_count = 0;
+    const auto* first = pending_hits_.data();
+    const auto* end = first + pending_hits_.size();
+    while (first != end) {
+        const auto* last = first + 1;
+        while (last != end && last->target_ == first->target_) ++last;
+        if (resolveTarget(first, last)) ++killed_count;
+        first = last;
+    }
+    pending_hits_.clear();
+
+    // 更新统计信息，通关判定每次结算只做一次
+    if (killed_count == 0) return;
+    auto& game_stats = registry_.ctx().get<game::data::GameStats&>();
+    game_stats.enemy_killed_count_ += killed_count;       // 敌人击杀数量增加
+    if ((game_stats.enemy_killed_count_ + game_stats.enemy_arrived_count_) >= game_stats.enemy_count_) {
+        spdlog::warn("all enemy dead");
+        // 通关成功
+        dispatcher_.enqueue(game::defs::LevelClearDelayedEvent{});
+    }
 }
 
 void CombatResolveSystem::onAttackEvent(const game::defs::AttackEvent& event) {
-    // 如果目标无效或标记死亡，直接返回
-    if (!registry_.valid(event.target_) || registry_.all_of<game::defs::DeadTag>(event.target_)) return;
-    // 根据伤害公式，让目标扣血
-    auto& target_stats = registry_.get<game::component::StatsComponent>(event.target_);
-    float damage = calculateEffectiveDamage(event.damage_, target_stats.def_);
-    target_stats.hp_ -= damage;
+    pending_hits_.push_back({event.target_, static_cast<std::uint32_t>(pending_hits_.size()), event.damage_, false});
+}
 
-    // 如果目标是玩家
-    if (registry_.all_of<game::component::PlayerComponent>(event.target_)) {
-        spdlog::info("player ID: {} get hurt ID: {}, remaining health: {}", 
-            entt::to_integral(event.target_), entt::to_integral(event.attacker_), target_stats.hp_);
-        // 死亡情况
+void CombatResolveSystem::onHealEvent(const game::defs::HealEvent& event) {
+    pending_hits_.push_back({event.target_, static_cast<std::uint32_t>(pending_hits_.size()), event.amount_, true});
+}
+
+void CombatResolveSystem::onAreaEffectEvent(const game::defs::AreaEffectEvent& event) {
+    if (event.radius_ <= 0.0f || event.amount_ <= 0.0f) return;
+    pending_areas_.push_back(event);
+}
+
+void CombatResolveSystem::onUnitDestroy(entt::registry&, entt::entity entity) {
+    unit_grid_.remove(entity);
+}
+
+void CombatResolveSystem::syncUnitGrid() {
+    // 单位只按位置 (脚下的点) 登记，死亡的单位在销毁时移除，展开时再按标签过滤
+    auto view = registry_.view<engine::component::TransformComponent, game::component::StatsComponent>();
+    for (auto entity : view) {
+        const auto& transform = view.get<engine::component::TransformComponent>(entity);
+        unit_grid_.update(entity, engine::utils::Rect{transform.position_, glm::vec2(0.0f)});
+    }
+}
+
+void CombatResolveSystem::expandAreaEffects() {
+    syncUnitGrid();
+    for (const auto& area : pending_areas_) {
+        // 1. 网格查询：只访问覆盖范围的格子
+        candidates_.clear();
+        unit_grid_.query(engine::utils::Rect{area.center_ - glm::vec2(area.radius_), glm::vec2(area.radius_ * 2.0f)}, candidates_);
+
+        // 2. 按阵营过滤，位置复制到连续数组中
+        candidate_positions_.clear();
+        candidate_entities_.clear();
+        for (auto entity : candidates_) {
+            if (entity == area.excluded_ || registry_.all_of<game::defs::DeadTag>(entity)) continue;
+            const bool is_player = registry_.all_of<game::component::PlayerComponent>(entity);
+            if (is_player != area.affect_players_) continue;
+            if (!is_player && !registry_.all_of<game::component::EnemyComponent>(entity)) continue;
+            candidate_positions_.push_back(registry_.get<engine::component::TransformComponent>(entity).position_);
+            candidate_entities_.push_back(entity);
+        }
+
+        // 3. 距离衰减：连续数组上的纯计算，无分支，便于编译器向量化
+        const auto count = candidate_positions_.size();
+        candidate_scales_.resize(count);
+        const float radius_sq = area.radius_ * area.radius_;
+        const float falloff_per_unit = area.falloff_ / area.radius_;
+        const glm::vec2* positions = candidate_positions_.data();
+        float* scales = candidate_scales_.data();
+        for (std::size_t i = 0; i < count; ++i) {
+            const float dx = positions[i].x - area.center_.x;
+            const float dy = positions[i].y - area.center_.y;
+            const float distance_sq = dx * dx + dy * dy;
+            const float scale = 1.0f - falloff_per_unit * std::sqrt(distance_sq);
+            scales[i] = distance_sq <= radius_sq ? scale : 0.0f;
+        }
+
+        // 4. 范围内的单位加入本次结算
+        for (std::size_t i = 0; i < count; ++i) {
+            if (scales[i] <= 0.0f) continue;
+            pending_hits_.push_back({candidate_entities_[i], static_cast<std::uint32_t>(pending_hits_.size()),
+                                     area.amount_ * scales[i], area.heal_});
+        }
+    }
+    pending_areas_.clear();
+}
+
+bool CombatResolveSystem::resolveTarget(const PendingHit* first, const PendingHit* last) {
+    const auto target = first->target_;
+    // 如果目标无效，全部忽略
+    if (!registry_.valid(target)) return false;
+    const bool is_player = registry_.all_of<game::component::PlayerComponent>(target);
+    const bool is_enemy = !is_player && registry_.all_of<game::component::EnemyComponent>(target);
+    // 已标记死亡的目标不再受到攻击 (治疗只对玩家有效)
+    const bool already_dead = registry_.all_of<game::defs::DeadTag>(target);
+    if (already_dead && !is_player) return false;
+    auto& target_stats = registry_.get<game::component::StatsComponent>(target);
+
+    bool died = false;
+    bool hurt = false;
+    int hit_count = 0;
+    int heal_count = 0;
+    float heal_amount = 0.0f;
+    float damage_amount = 0.0f;
+    for (const auto* hit = first; hit != last; ++hit) {
+        if (hit->heal_) {
+            if (!is_player) continue;
+            // 根据治疗量，让目标回血 (满血为止)
+            target_stats.hp_ = std::min(target_stats.hp_ + hit->amount_, target_stats.max_hp_);
+            heal_amount += hit->amount_;
+            ++heal_count;
+            continue;
+        }
+        // 敌人死亡后 (已添加死亡标签) 不再受到攻击
+        if (already_dead || (is_enemy && died)) continue;
+        // 根据伤害公式，让目标扣血
+        const float damage = calculateEffectiveDamage(hit->amount_, target_stats.def_);
+        target_stats.hp_ -= damage;
+        damage_amount += damage;
+        ++hit_count;
+        if (!is_player && !is_enemy) continue;
         if (target_stats.hp_ <= 0) {
             target_stats.hp_ = 0;
-            // 发送移除单位事件
-            dispatcher_.enqueue(game::defs::RemovePlayerUnitEvent{event.target_});
-            spdlog::info("player ID: {} died", entt::to_integral(event.target_));
-            // NOTE: 可添加死亡特效, 统计信息等
-        // 受伤情况
+            died = true;
         } else if (target_stats.hp_ < target_stats.max_hp_) {
-            registry_.emplace_or_replace<game::defs::InjuredTag>(event.target_);
+            hurt = true;
         }
-        return;
     }
 
-    // 如果目标是敌人
-    if (registry_.all_of<game::component::EnemyComponent>(event.target_)) {
-        spdlog::info("enemy ID: {} get hurt ID: {}, remaining health: {}", 
-            entt::to_integral(event.target_), entt::to_integral(event.attacker_), target_stats.hp_);
-        // 死亡情况
-        if (target_stats.hp_ <= 0) {
-            target_stats.hp_ = 0;
-            registry_.emplace<game::defs::DeadTag>(event.target_);
-            spdlog::info("enemy ID: {} died", entt::to_integral(event.target_));
-
-            // 发送死亡特效事件，需要先获取class_id、位置和是否翻转
-            const auto [class_name, transform, sprite] = registry_.get<game::component::ClassNameComponent, 
-                engine::component::TransformComponent, 
-                engine::component::SpriteComponent>(event.target_);
-            dispatcher_.enqueue(game::defs::EnemyDeadEffectEvent{class_name.class_id_, transform.position_, sprite.sprite_.is_flipped_});
-
-            // 更新统计信息
-            auto& game_stats = registry_.ctx().get<game::data::GameStats&>();
-            game_stats.enemy_killed_count_++;       // 敌人击杀数量+1
-            if ((game_stats.enemy_killed_count_ + game_stats.enemy_arrived_count_) >= game_stats.enemy_count_) {
-                spdlog::warn("all enemy dead");
-                // 通关成功
-                dispatcher_.enqueue(game::defs::LevelClearDelayedEvent{});
-            }
+    if (hit_count > 0 && (is_player || is_enemy)) {
+        spdlog::info("{} ID: {} get hurt {} times, remaining health: {}",
+            is_player ? "player" : "enemy", entt::to_integral(target), hit_count, target_stats.hp_);
+    }
+    if (hurt) {
+        registry_.emplace_or_replace<game::defs::InjuredTag>(target);
+    }
+    // 战斗飘字：同一目标本次结算的伤害、治疗各合计为一条
+    if (hit_count > 0 && (is_player || is_enemy)) {
+        const auto& transform = registry_.get<engine::component::TransformComponent>(target);
+        dispatcher_.enqueue(game::defs::CombatTextEvent{transform.position_, damage_amount, false, is_player});
+    }
 
-            // 如果敌人被阻挡，减少阻挡者的阻挡计数
-            if (auto blocked_by = registry_.try_get<game::component::BlockedByComponent>(event.target_); blocked_by) {
-                auto blocker_entity = blocked_by->entity_;
-                if (registry_.valid(blocker_entity)) {
-                    auto& blocker = registry_.get<game::component::BlockerComponent>(blocker_entity);
-                    blocker.current_count_ = glm::max(0, blocker.current_count_ - 1);
-                }
+    // 如果目标是玩家
+    if (is_player) {
+        // 死亡情况：发送移除单位事件
+        if (died) {
+            dispatcher_.enqueue(game::defs::RemovePlayerUnitEvent{target});
+            spdlog::info("player ID: {} died", entt::to_integral(target));
+            // NOTE: 可添加死亡特效, 统计信息等
+        }
+        if (heal_count > 0) {
+            spdlog::info("target ID: {} healed {} times, heal amount: {}", entt::to_integral(target), heal_count, heal_amount);
+            // 如果治疗后满血，移除受伤标签
+            if (target_stats.hp_ >= target_stats.max_hp_) {
+                registry_.remove<game::defs::InjuredTag>(target);
             }
-        // 受伤情况
-        } else if (target_stats.hp_ < target_stats.max_hp_) {
-            registry_.emplace_or_replace<game::defs::InjuredTag>(event.target_);
+            // 添加治疗特效与飘字 (同一目标的多次治疗只显示一次)
+            const auto& transform = registry_.get<engine::component::TransformComponent>(target);
+            dispatcher_.enqueue(game::defs::EffectEvent{"heal"_hs, transform.position_, false});
+            dispatcher_.enqueue(game::defs::CombatTextEvent{transform.position_, heal_amount, true, true});
         }
-        return;
+        return false;
     }
-}
 
-void CombatResolveSystem::onHealEvent(const game::defs::HealEvent& event) {
-    if (!registry_.valid(event.target_)) return;
-    if (!registry_.all_of<game::component::PlayerComponent>(event.target_)) return;
-    // 根据治疗量，让目标回血
-    auto& target_stats = registry_.get<game::component::StatsComponent>(event.target_);
-    target_stats.hp_ += event.amount_;
-    spdlog::info("healer ID: {}, target ID: {}, heal amount: {}", 
-        entt::to_integral(event.healer_), entt::to_integral(event.target_), event.amount_);
-    // 如果治疗后满血，移除受伤标签
-    if (target_stats.hp_ >= target_stats.max_hp_) {
-        target_stats.hp_ = target_stats.max_hp_;
-        registry_.remove<game::defs::InjuredTag>(event.target_);
+    // 如果目标是敌人
+    if (!is_enemy || !died) return false;
+    registry_.emplace<game::defs::DeadTag>(target);
+    spdlog::info("enemy ID: {} died", entt::to_integral(target));
+
+    // 发送死亡特效事件，需要先获取class_id、位置和是否翻转
+    const auto [class_name, transform, sprite] = registry_.get<game::component::ClassNameComponent, 
+        engine::component::TransformComponent, 
+        engine::component::SpriteComponent>(target);
+    dispatcher_.enqueue(game::defs::EnemyDeadEffectEvent{class_name.class_id_, transform.position_, sprite.sprite_.is_flipped_});
+
+    // 如果敌人被阻挡，减少阻挡者的阻挡计数
+    if (auto blocked_by = registry_.try_get<game::component::BlockedByComponent>(target); blocked_by) {
+        auto blocker_entity = blocked_by->entity_;
+        if (registry_.valid(blocker_entity)) {
+            auto& blocker = registry_.get<game::component::BlockerComponent>(blocker_entity);
+            blocker.current_count_ = glm::max(0, blocker.current_count_ - 1);
+        }
     }
-    // 添加治疗特效
-    const auto& transform = registry_.get<engine::component::TransformComponent>(event.target_);
-    dispatcher_.enqueue(game::defs::EffectEvent{"heal"_hs, transform.position_, false});
+    return true;
 }
 
 // --- 辅助函数 ---
@@ -1,27 +1,72 @@
 #pragma once
+#include <cstdint>
+#include <vector>
+#include <entt/entity/entity.hpp>
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
+#include <glm/vec2.hpp>
 #include "../defs/events.h"
+#include "../../engine/spatial/spatial_grid.h"
 
 namespace game::system {
 
 /**
  * @brief 战斗结算系统，用于处理战斗结算
- * 
+ *
  * 根据接受到的事件（攻击/治疗），执行相应的结算操作。
+ * 事件回调只记录事件，结算在 update() 中按目标合并进行：
+ * 同一目标的所有攻击/治疗按收到的顺序连续结算，组件查找、死亡判定与通关判定每个目标只做一次，
+ * 结果 (血量、死亡、受伤标签、击杀统计) 与逐个事件结算相同。
+ *
+ * 范围攻击/治疗 (溅射投射物、治疗脉冲) 在结算前展开为普通的攻击/治疗：
+ * 单位按位置登记在空间网格中 (只在有范围效果的帧增量同步)，每个范围效果只查询覆盖的格子，
+ * 距离与衰减在连续数组上一次算完，因此开销与范围内的单位数量有关，而与单位总数无关。
  */
 class CombatResolveSystem {
+    /// @brief 待结算的攻击或治疗
+    struct PendingHit {
+        entt::entity target_{entt::null};
+        std::uint32_t order_{};     ///< @brief 收到事件的顺序 (同一目标按此顺序结算)
+        float amount_{};            ///< @brief 攻击力或治疗量
+        bool heal_{false};          ///< @brief 是否为治疗
+    };
+
     entt::registry& registry_;
     entt::dispatcher& dispatcher_;
+    std::vector<PendingHit> pending_hits_;  ///< @brief 上一次事件分发中收到的攻击/治疗 (容量在帧间复用)
+    std::vector<game::defs::AreaEffectEvent> pending_areas_;   ///< @brief 上一次事件分发中收到的范围效果
+
+    // --- 范围效果 ---
+    engine::spatial::SpatialGrid unit_grid_;        ///< @brief 单位位置的空间索引
+    std::vector<entt::entity> candidates_;          ///< @brief 网格查询得到的候选单位 (以下数组复用容量)
+    std::vector<glm::vec2> candidate_positions_;    ///< @brief 与目标同阵营的候选单位位置
+    std::vector<entt::entity> candidate_entities_;  ///< @brief 与位置一一对应的实体
+    std::vector<float> candidate_scales_;           ///< @brief 距离衰减后的比例 (范围外为0)
 
 public:
     CombatResolveSystem(entt::registry& registry, entt::dispatcher& dispatcher);
     ~CombatResolveSystem();
 
+    /// @brief 结算上一次事件分发中收到的攻击与治疗 (在每帧开始、其它系统更新之前调用)
+    void update();
+
 private:
     // 事件回调函数
     void onAttackEvent(const game::defs::AttackEvent& event);
     void onHealEvent(const game::defs::HealEvent& event);
+    void onAreaEffectEvent(const game::defs::AreaEffectEvent& event);
+    void onUnitDestroy(entt::registry& registry, entt::entity entity);     ///< @brief 从单位网格中移除
+
+    void syncUnitGrid();                ///< @brief 同步单位位置到空间网格 (位置所在格子不变时几乎没有开销)
+    void expandAreaEffects();           ///< @brief 将范围效果展开为范围内每个单位的攻击/治疗
+
+    /**
+     * @brief 结算同一目标的所有攻击/治疗
+     * @param first 第一个待结算项
+     * @param last 最后一个待结算项的下一个位置
+     * @return 目标 (敌人) 是否在本次结算中死亡
+     */
+    bool resolveTarget(const PendingHit* first, const PendingHit* last);
 
     /**
      * @brief 计算最终伤害（公式可修改）
@@ -30,4 +75,4 @@ private:
     float calculateEffectiveDamage(float attacker_atk, float target_def);
 };
 
-} // namespace game::system
\ No newline at end of file
+} // namespace game::system
@@ -1,5 +1,6 @@
 #include "debug_ui_system.h"
 #include "../component/stats_component.h"
+#include "../component/level_component.h"
 #include "../component/class_name_component.h"
 #include "../component/blocker_component.h"
 #include "../component/skill_component.h"
@@ -14,13 +15,25 @@
 #include "../scene/level_clear_scene.h"
 #include "../scene/end_scene.h"
 #include "../../engine/audio/audio_player.h"
+#include "../../engine/audio/voice_manager.h"
 #include "../../engine/component/name_component.h"
 #include "../../engine/core/context.h"
+#include "../../engine/core/ecs_telemetry.h"
 #include "../../engine/core/game_state.h"
+#include "../../engine/core/replay_manager.h"
+#include "../../engine/core/save_service.h"
 #include "../../engine/core/time.h"
+#include "../../engine/core/timing_wheel.h"
+#include "../../engine/memory/allocation_counter.h"
+#include "../../engine/memory/frame_arena.h"
+#include "../../engine/memory/pmr.h"
 #include "../../engine/render/renderer.h"
 #include "../../engine/resource/resource_manager.h"
+#include "../../engine/system/render_system.h"
+#include "../../engine/utils/events.h"
 #include "../../engine/utils/math.h"
+#include <filesystem>
+#include <format>
 #include <imgui.h>
 #include <imgui_impl_sdl3.h>
 #include <imgui_impl_sdlrenderer3.h>
@@ -33,16 +46,46 @@ using namespace entt::literals;
 
 namespace game::system {
 
+namespace {
+
+/// @brief 存档槽位的文件路径
+std::string slotPath(int slot, game::data::SaveFormat format) {
+    return std::format("assets/save/SLOT_{}.{}", slot, format == game::data::SaveFormat::BINARY ? "sav" : "json");
+}
+
+/// @brief 读档时选择槽位中较新的存档文件 (同一槽位可能同时有JSON和二进制存档)
+std::string newestSlotPath(int slot) {
+    namespace fs = std::filesystem;
+    const auto json_path = slotPath(slot, game::data::SaveFormat::JSON);
+    const auto binary_path = slotPath(slot, game::data::SaveFormat::BINARY);
+    std::error_code ec;
+    if (!fs::exists(binary_path, ec)) return json_path;
+    if (!fs::exists(json_path, ec)) return binary_path;
+    return fs::last_write_time(binary_path, ec) > fs::last_write_time(json_path, ec) ? binary_path : json_path;
+}
+
+} // namespace
+
 DebugUISystem::DebugUISystem(entt::registry& registry, engine::core::Context& context)
     : registry_(registry), context_(context) {
     context_.getDispatcher().sink<game::defs::UIPortraitHoverEnterEvent>().connect<&DebugUISystem::onUIPortraitHoverEnterEvent>(this);
     context_.getDispatcher().sink<game::defs::UIPortraitHoverLeaveEvent>().connect<&DebugUISystem::onUIPortraitHoverLeaveEvent>(this);
+    context_.getDispatcher().sink<engine::utils::SaveCompletedEvent>().connect<&DebugUISystem::onSaveCompletedEvent>(this);
 }
 
 DebugUISystem::~DebugUISystem() {
     context_.getDispatcher().disconnect(this);
 }
 
+template <typename Event>
+void DebugUISystem::enqueueUIEvent(const Event& event) {
+    auto& replay_manager = context_.getReplayManager();
+    // 回放时界面事件由录像重新派发，忽略实际的界面操作
+    if (replay_manager.isReplaying()) return;
+    replay_manager.recordEvent(event);
+    context_.getDispatcher().enqueue(event);
+}
+
 void DebugUISystem::update() {
     beginFrame();
     renderHoveredPortrait();
@@ -166,9 +209,10 @@ void DebugUISystem::renderHoveredUnit() {
         ImGui::SameLine();
     }
     ImGui::Text("%s", class_name.class_name_.c_str());
-    ImGui::Text("等级: %d", stats.level_);
+    const auto& level = registry_.get<game::component::LevelComponent>(entity);
+    ImGui::Text("等级: %d", level.level_);
     ImGui::SameLine();
-    ImGui::Text("稀有度: %d", stats.rarity_);
+    ImGui::Text("稀有度: %d", level.rarity_);
     ImGui::Text("生命值: %d/%d", static_cast<int>(std::round(stats.hp_)), static_cast<int>(std::round(stats.max_hp_)));
     ImGui::Text("攻击力: %d", static_cast<int>(std::round(stats.atk_)));
     ImGui::Text("防御力: %d", static_cast<int>(std::round(stats.def_)));
@@ -199,9 +243,10 @@ void DebugUISystem::renderSelectedUnit() {
         ImGui::SameLine();
     }
     ImGui::Text("%s", class_name.class_name_.c_str());
-    ImGui::Text("等级: %d", stats.level_);
+    const auto& level = registry_.get<game::component::LevelComponent>(entity);
+    ImGui::Text("等级: %d", level.level_);
     ImGui::SameLine();
-    ImGui::Text("稀有度: %d", stats.rarity_);
+    ImGui::Text("稀有度: %d", level.rarity_);
     ImGui::Text("生命值: %d/%d", static_cast<int>(std::round(stats.hp_)), static_cast<int>(std::round(stats.max_hp_)));
     ImGui::Text("攻击力: %d", static_cast<int>(std::round(stats.atk_)));
     ImGui::SameLine();
@@ -222,7 +267,7 @@ void DebugUISystem::renderSelectedUnit() {
     // 设置快捷键 U 升级
     ImGui::SetNextItemShortcut(ImGuiKey_U, ImGuiInputFlags_RouteAlways | ImGuiInputFlags_Tooltip);
     if (ImGui::Button("升级")) {
-        context_.getDispatcher().enqueue<game::defs::UpgradeUnitEvent>(entity, player.cost_);
+        enqueueUIEvent(game::defs::UpgradeUnitEvent{entity, player.cost_});
     }
     ImGui::SameLine();
     ImGui::Text("快捷键 U: COST消费: %d", player.cost_);
@@ -233,13 +278,14 @@ void DebugUISystem::renderSelectedUnit() {
     // 设置快捷键 R 撤退
     ImGui::SetNextItemShortcut(ImGuiKey_R, ImGuiInputFlags_RouteAlways | ImGuiInputFlags_Tooltip);
     if (ImGui::Button("撤退")) {
-        context_.getDispatcher().enqueue<game::defs::RetreatEvent>(entity, return_cost);
+        enqueueUIEvent(game::defs::RetreatEvent{entity, return_cost});
     }
     ImGui::SameLine();
     ImGui::Text("快捷键 R: COST返还: %d", return_cost);
 
     // 技能显示与交互
     if (auto skill = registry_.try_get<game::component::SkillComponent>(entity); skill) {
+        const auto& timing_wheel = registry_.ctx().get<engine::core::TimingWheel&>();
         // 如果技能准备就绪，则按钮可用（激活技能），否则按钮不可用
         auto ready = registry_.all_of<game::defs::SkillReadyTag>(entity);
         ImGui::BeginDisabled(!ready);
@@ -247,7 +293,7 @@ void DebugUISystem::renderSelectedUnit() {
         ImGui::SetNextItemShortcut(ImGuiKey_S, ImGuiInputFlags_RouteAlways | ImGuiInputFlags_Tooltip);
         if (ImGui::Button(skill->name_.c_str())) {
             // 激活技能
-            context_.getDispatcher().enqueue<game::defs::SkillActiveEvent>(entity);
+            enqueueUIEvent(game::defs::SkillActiveEvent{entity});
         }
         ImGui::EndDisabled();
         ImGui::SameLine();
@@ -256,7 +302,7 @@ void DebugUISystem::renderSelectedUnit() {
             if (registry_.all_of<game::defs::PassiveSkillTag>(entity)) {
                 ImGui::Text("被动技能激活中");
             } else {
-                ImGui::Text("激活中，剩余时间: %.1f 秒", skill->duration_ - skill->duration_timer_);
+                ImGui::Text("激活中，剩余时间: %.1f 秒", timing_wheel.remaining(skill->duration_timer_));
             }
         // 否则显示冷却时间
         } else {
@@ -266,7 +312,7 @@ void DebugUISystem::renderSelectedUnit() {
                 ImGui::Text("技能准备就绪");
             } else {
                 // 用进度条显示冷却时间百分比
-                ImGui::ProgressBar(skill->cooldown_timer_ / skill->cooldown_);
+                ImGui::ProgressBar(1.0f - timing_wheel.remaining(skill->cooldown_timer_) / skill->cooldown_);
             }
         }
         // 显示技能描述
@@ -286,7 +332,7 @@ void DebugUISystem::renderInfoUI() {
     const auto& waves = registry_.ctx().get<game::data::Waves&>();
     const auto& session_data = registry_.ctx().get<std::shared_ptr<game::data::SessionData>>();
     // 显示
-    ImGui::Text("基地血量: %d / 5", game_stats.home_hp_);
+    ImGui::Text("基地血量: %d / %d", game_stats.home_hp_, game_stats.max_home_hp_);
     ImGui::SameLine();
     ImGui::Text("COST: %d", static_cast<int>(game_stats.cost_));
     ImGui::SameLine();
@@ -322,15 +368,22 @@ void DebugUISystem::renderSettingUI() {
     }
     ImGui::SameLine();
     if (ImGui::Button("重新开始")) {
-        context_.getDispatcher().enqueue<game::defs::RestartEvent>();
+        enqueueUIEvent(game::defs::RestartEvent{});
     }
     if (ImGui::Button("返回标题")) {
-        context_.getDispatcher().enqueue<game::defs::BackToTitleEvent>();
+        enqueueUIEvent(game::defs::BackToTitleEvent{});
     }
     ImGui::SameLine();
     if (ImGui::Button("保存")) {
         context_.getDispatcher().enqueue<game::defs::SaveEvent>();
     }
+    if (ImGui::Button("快速存档(F5)")) {
+        enqueueUIEvent(game::defs::QuickSaveEvent{});
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("快速读档(F9)")) {
+        enqueueUIEvent(game::defs::QuickLoadEvent{});
+    }
     ImGui::Separator();
 
     // 游戏速度调节
@@ -381,12 +434,231 @@ void DebugUISystem::renderDebugUI() {
         game_stats.cost_ += 100;
     }
     if (ImGui::Button("通关")) {
-        context_.getDispatcher().enqueue<game::defs::LevelClearEvent>();
+        enqueueUIEvent(game::defs::LevelClearEvent{});
     }
+    // 录像状态
+    const auto& replay_manager = context_.getReplayManager();
+    if (replay_manager.isRecording()) {
+        ImGui::Text("录制中: 第 %llu 帧", static_cast<unsigned long long>(replay_manager.getTick()));
+    } else if (replay_manager.isReplaying()) {
+        ImGui::Text("回放中: %llu / %llu 帧", static_cast<unsigned long long>(replay_manager.getTick()),
+                    static_cast<unsigned long long>(replay_manager.getEndTick()));
+    }
+    renderResourceUsage();
+    renderVoiceStats();
+    renderCullingStats();
+    renderFrameStats();
+    renderMemoryStats();
+    renderEcsTelemetry();
     // TODO: 未来可按需添加其他调试工具
     ImGui::End();
 }
 
+void DebugUISystem::renderResourceUsage() {
+    if (!ImGui::CollapsingHeader("资源驻留")) return;
+    using engine::resource::ResourceType;
+    constexpr std::pair<ResourceType, const char*> TYPES[] = {
+        {ResourceType::TEXTURE, "纹理"},
+        {ResourceType::SOUND, "音效"},
+        {ResourceType::MUSIC, "音乐"},
+        {ResourceType::FONT, "字体"},
+    };
+    constexpr float MB = 1024.0f * 1024.0f;
+    const auto& resource_manager = context_.getResourceManager();
+    if (ImGui::BeginTable("resource_usage", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+        ImGui::TableSetupColumn("类型");
+        ImGui::TableSetupColumn("数量");
+        ImGui::TableSetupColumn("驻留(MB)");
+        ImGui::TableSetupColumn("预算(MB)");
+        ImGui::TableSetupColumn("峰值(MB)");
+        ImGui::TableSetupColumn("已淘汰");
+        ImGui::TableHeadersRow();
+        for (const auto& [type, name] : TYPES) {
+            const auto& stats = resource_manager.getResidencyStats(type);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(name);
+            ImGui::TableNextColumn(); ImGui::Text("%zu", resource_manager.getResidentCount(type));
+            ImGui::TableNextColumn(); ImGui::Text("%.2f", static_cast<float>(stats.resident_bytes_) / MB);
+            ImGui::TableNextColumn();
+            if (stats.budget_bytes_ == 0) ImGui::TextUnformatted("-");
+            else ImGui::Text("%.0f", static_cast<float>(stats.budget_bytes_) / MB);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f", static_cast<float>(stats.peak_bytes_) / MB);
+            ImGui::TableNextColumn(); ImGui::Text("%zu", stats.evicted_count_);
+        }
+        // 音效以压缩数据驻留，解码后的PCM单独缓存
+        const auto& pcm_stats = resource_manager.getSoundCacheStats();
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn(); ImGui::TextUnformatted("音效PCM");
+        ImGui::TableNextColumn(); ImGui::Text("%zu", resource_manager.getSoundCacheCount());
+        ImGui::TableNextColumn(); ImGui::Text("%.2f", static_cast<float>(pcm_stats.resident_bytes_) / MB);
+        ImGui::TableNextColumn();
+        if (pcm_stats.budget_bytes_ == 0) ImGui::TextUnformatted("-");
+        else ImGui::Text("%.0f", static_cast<float>(pcm_stats.budget_bytes_) / MB);
+        ImGui::TableNextColumn(); ImGui::Text("%.2f", static_cast<float>(pcm_stats.peak_bytes_) / MB);
+        ImGui::TableNextColumn(); ImGui::Text("%zu", pcm_stats.evicted_count_);
+        ImGui::EndTable();
+    }
+}
+
+void DebugUISystem::renderVoiceStats() {
+    if (!ImGui::CollapsingHeader("音效发声")) return;
+    const auto& voice_manager = context_.getAudioPlayer().getVoiceManager();
+    const auto& stats = voice_manager.getStats();
+    ImGui::Text("发声中: %d / %d", stats.active_voices_, voice_manager.getSettings().channel_count_);
+    ImGui::Text("请求: %d  播放: %d", stats.requested_, stats.played_);
+    ImGui::Text("合并: %d  剔除: %d  限流: %d", stats.coalesced_, stats.culled_, stats.capped_);
+    ImGui::Text("抢占: %d  丢弃: %d", stats.stolen_, stats.rejected_);
+}
+
+void DebugUISystem::renderCullingStats() {
+    if (!ImGui::CollapsingHeader("渲染剔除")) return;
+    if (!registry_.ctx().contains<engine::system::RenderStats&>()) {
+        ImGui::TextUnformatted("无统计数据");
+        return;
+    }
+    const auto& stats = registry_.ctx().get<engine::system::RenderStats&>();
+    ImGui::Text("绘制: %d / %d", stats.drawn_, stats.total_);
+    ImGui::Text("剔除: %d  候选: %d", stats.culled_, stats.candidates_);
+}
+
+void DebugUISystem::renderFrameStats() {
+    if (!ImGui::CollapsingHeader("帧时长")) return;
+    auto& time = context_.getTime();
+    auto& histogram = time.getFrameHistogram();
+    constexpr float MS = 1000.0f;
+    const float mean_ms = static_cast<float>(histogram.getMean()) / MS;
+    ImGui::Text("帧数: %llu  平均: %.2f ms (%.1f FPS)", static_cast<unsigned long long>(histogram.getCount()),
+                mean_ms, mean_ms > 0.0f ? 1000.0f / mean_ms : 0.0f);
+    ImGui::Text("p50: %.2f  p95: %.2f  p99: %.2f ms",
+                static_cast<float>(histogram.getPercentile(50.0)) / MS,
+                static_cast<float>(histogram.getPercentile(95.0)) / MS,
+                static_cast<float>(histogram.getPercentile(99.0)) / MS);
+    ImGui::Text("最小: %.2f  最大: %.2f ms", static_cast<float>(histogram.getMin()) / MS, static_cast<float>(histogram.getMax()) / MS);
+    bool precise_pacing = time.isPrecisePacing();
+    if (ImGui::Checkbox("精确帧率限制", &precise_pacing)) {
+        time.setPrecisePacing(precise_pacing);
+        histogram.reset();
+    }
+    ImGui::SameLine();
+    ImGui::Text("(睡眠估计: %.2f ms)", time.getSleepEstimate());
+    if (ImGui::Button("重置统计")) {
+        histogram.reset();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("导出CSV")) {
+        (void)histogram.writeCsv("frame_times.csv");
+    }
+}
+
+void DebugUISystem::renderMemoryStats() {
+    if (!ImGui::CollapsingHeader("内存")) return;
+    auto& frame_arena = context_.getFrameArena();
+    ImGui::Text("上一帧堆分配: %llu 次  (峰值: %llu)", static_cast<unsigned long long>(frame_arena.getLastFrameAllocations()),
+                static_cast<unsigned long long>(frame_arena.getPeakFrameAllocations()));
+    ImGui::SameLine();
+    if (ImGui::SmallButton("重置峰值")) {
+        frame_arena.resetPeak();
+    }
+    ImGui::Text("累计: new %llu / delete %llu", static_cast<unsigned long long>(engine::memory::getAllocationCount()),
+                static_cast<unsigned long long>(engine::memory::getDeallocationCount()));
+
+    // 线性分配器用量 (帧分配器显示的是绘制到这里为止的本帧用量)
+    const auto show_arena = [](const engine::memory::LinearArena& arena) {
+        constexpr float KB = 1024.0f;
+        ImGui::Text("%.*s: %.1f / %.1f KB  峰值 %.1f KB  块 %zu  (累计申请 %zu 次)",
+                    static_cast<int>(arena.getName().size()), arena.getName().data(),
+                    static_cast<float>(arena.getUsedBytes()) / KB, static_cast<float>(arena.getCapacity()) / KB,
+                    static_cast<float>(arena.getPeakBytes()) / KB, arena.getBlockCount(), arena.getBlockAllocations());
+    };
+    show_arena(frame_arena.getArena());
+    if (registry_.ctx().contains<engine::memory::LinearArena&>()) {
+        show_arena(registry_.ctx().get<engine::memory::LinearArena&>());
+    }
+}
+
+void DebugUISystem::renderEcsTelemetry() {
+    if (!ImGui::CollapsingHeader("ECS统计")) return;
+    if (!registry_.ctx().contains<engine::core::EcsTelemetry&>()) {
+        ImGui::TextUnformatted("无统计数据");
+        return;
+    }
+    using Metric = engine::core::EcsTelemetry::Metric;
+    using SortKey = engine::core::EcsTelemetry::SortKey;
+    auto& telemetry = registry_.ctx().get<engine::core::EcsTelemetry&>();
+    const auto& summary = telemetry.getSummary();
+    constexpr float KB = 1024.0f;
+    constexpr float MB = 1024.0f * 1024.0f;
+    ImGui::Text("实体: %zu  (可复用: %zu)  组件存储: %zu", summary.live_entities_, summary.free_entities_, summary.storage_count_);
+    ImGui::Text("存储内存: %.1f KB  组件堆内存: %.1f KB", static_cast<float>(summary.storage_bytes_) / KB,
+                static_cast<float>(summary.heap_bytes_) / KB);
+    ImGui::Text("纹理: %.2f MB  音效: %.2f MB  排队事件: %zu", static_cast<float>(summary.texture_bytes_) / MB,
+                static_cast<float>(summary.sound_bytes_) / MB, summary.queued_events_);
+
+    // 曲线 (缓冲区写满之前从头绘制，写满后从最旧的数据开始)
+    constexpr std::pair<Metric, const char*> PLOTS[] = {
+        {Metric::ENTITIES, "实体"},
+        {Metric::STORAGE_KB, "存储(KB)"},
+        {Metric::HEAP_KB, "堆(KB)"},
+        {Metric::TEXTURE_MB, "纹理(MB)"},
+        {Metric::SOUND_MB, "音效(MB)"},
+        {Metric::QUEUED_EVENTS, "事件"},
+    };
+    const auto count = static_cast<int>(telemetry.getHistoryCount());
+    const auto offset = count < static_cast<int>(engine::core::EcsTelemetry::HISTORY_SIZE) ? 0 : static_cast<int>(telemetry.getHistoryOffset());
+    for (const auto& [metric, label] : PLOTS) {
+        const float* values = telemetry.getHistory(metric);
+        const float current = count > 0 ? values[(offset + count - 1) % engine::core::EcsTelemetry::HISTORY_SIZE] : 0.0f;
+        const auto overlay = std::format("{:.1f}", current);
+        ImGui::PlotLines(label, values, count, offset, overlay.c_str(), 0.0f, FLT_MAX, ImVec2(240.0f, 32.0f));
+    }
+
+    // 组件存储表 (点击表头排序)
+    constexpr ImGuiTableFlags TABLE_FLAGS = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit |
+                                            ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY;
+    if (ImGui::BeginTable("ecs_storages", 5, TABLE_FLAGS, ImVec2(0.0f, 240.0f))) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("组件", ImGuiTableColumnFlags_None, 0.0f, static_cast<ImGuiID>(SortKey::NAME));
+        ImGui::TableSetupColumn("数量", ImGuiTableColumnFlags_None, 0.0f, static_cast<ImGuiID>(SortKey::SIZE));
+        ImGui::TableSetupColumn("容量", ImGuiTableColumnFlags_None, 0.0f, static_cast<ImGuiID>(SortKey::CAPACITY));
+        ImGui::TableSetupColumn("内存(KB)", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending,
+                                0.0f, static_cast<ImGuiID>(SortKey::STORAGE_BYTES));
+        ImGui::TableSetupColumn("堆内存(KB)", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, static_cast<ImGuiID>(SortKey::HEAP_BYTES));
+        ImGui::TableHeadersRow();
+        // 排序方式保存在统计模块中，之后每帧采样后保持该顺序
+        if (auto* sort_specs = ImGui::TableGetSortSpecs(); sort_specs && sort_specs->SpecsDirty) {
+            if (sort_specs->SpecsCount > 0) {
+                const auto& spec = sort_specs->Specs[0];
+                telemetry.setSortOrder(static_cast<SortKey>(spec.ColumnUserID), spec.SortDirection == ImGuiSortDirection_Ascending);
+            }
+            sort_specs->SpecsDirty = false;
+        }
+        for (const auto& storage : telemetry.getStorages()) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(storage.name_.data(), storage.name_.data() + storage.name_.size());
+            ImGui::TableNextColumn(); ImGui::Text("%zu", storage.size_);
+            ImGui::TableNextColumn(); ImGui::Text("%zu", storage.capacity_);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", static_cast<float>(storage.storage_bytes_) / KB);
+            ImGui::TableNextColumn();
+            if (storage.heap_bytes_ == 0) ImGui::TextUnformatted("-");
+            else ImGui::Text("%.1f", static_cast<float>(storage.heap_bytes_) / KB);
+        }
+        ImGui::EndTable();
+    }
+
+    // 事件队列 (本帧排队、尚未分发的事件)
+    if (ImGui::TreeNode("事件队列")) {
+        for (const auto& queue : telemetry.getEventQueues()) {
+            ImGui::Text("%.*s: %zu", static_cast<int>(queue.name_.size()), queue.name_.data(), queue.size_);
+        }
+        ImGui::TreePop();
+    }
+
+    if (ImGui::Button("导出CSV##ecs")) {
+        (void)telemetry.writeCsv("ecs_storages.csv");
+        (void)telemetry.writeHistoryCsv("ecs_history.csv");
+    }
+}
+
 // ----------------------------- TitleScene -----------------------------
 void DebugUISystem::renderTitleLogo() {
     if (!ImGui::Begin("TitleLogo", nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoBackground)) {
@@ -423,6 +695,10 @@ void DebugUISystem::renderTitleButtons(game::scene::TitleScene& title_scene) {
         title_scene.onLoadGameClick();
     }
     ImGui::SameLine(); ImGui::SetCursorPosX(ImGui::GetCursorPosX() + 20.0f);
+    if (ImGui::Button("回放录像", ImVec2(200, 60))) {
+        title_scene.onReplayClick();
+    }
+    ImGui::SameLine(); ImGui::SetCursorPosX(ImGui::GetCursorPosX() + 20.0f);
     if (ImGui::Button("退出游戏", ImVec2(200, 60))) {
         title_scene.onQuitClick();
     }
@@ -458,7 +734,7 @@ void DebugUISystem::renderLevelClearTable(game::scene::LevelClearScene& level_cl
     ImGui::SameLine();
     ImGui::Text("击杀数量: %d / %d", session_info.enemy_killed_count_, session_info.enemy_count_);
     ImGui::SameLine();
-    ImGui::Text("基地血量: %d / 5", session_info.home_hp_);
+    ImGui::Text("基地血量: %d / %d", session_info.home_hp_, session_info.max_home_hp_);
     ImGui::SameLine();
     ImGui::Text("奖励点数: %d", session_info.enemy_killed_count_ + session_info.home_hp_ * 5);
     ImGui::SameLine();
@@ -547,16 +823,14 @@ void DebugUISystem::renderLoadPanelUI(bool& show_load_panel) {
         return;
     }
     const auto& session_data = registry_.ctx().get<std::shared_ptr<game::data::SessionData>>();
-    if (ImGui::Button("SLOT 1")) {
-        session_data->loadFromFile("assets/save/SLOT_1.json");
-    }
-    ImGui::SameLine();
-    if (ImGui::Button("SLOT 2")) {
-        session_data->loadFromFile("assets/save/SLOT_2.json");
-    }
-    ImGui::SameLine();
-    if (ImGui::Button("SLOT 3")) {
-        session_data->loadFromFile("assets/save/SLOT_3.json");
+    for (int slot = 1; slot <= 3; ++slot) {
+        if (slot > 1) ImGui::SameLine();
+        if (ImGui::Button(std::format("SLOT {}", slot).c_str())) {
+            // 还有存档在写入时先等待写完，避免读到旧文件 (仅在读档时可能等待)
+            auto& save_service = context_.getSaveService();
+            if (save_service.isBusy()) save_service.flush();
+            session_data->loadFromFile(newestSlotPath(slot));
+        }
     }
     // 如果已经通关了，则提示将进入下一关，否则显示“当前关卡”
     if (session_data->isLevelClear()) {
@@ -575,16 +849,19 @@ void DebugUISystem::renderSavePanelUI(bool& show_save_panel) {
         return;
     }
     const auto& session_data = registry_.ctx().get<std::shared_ptr<game::data::SessionData>>();
-    if (ImGui::Button("SLOT 1")) {        
-        session_data->saveToFile("assets/save/SLOT_1.json");
-    }
-    ImGui::SameLine();
-    if (ImGui::Button("SLOT 2")) {
-        session_data->saveToFile("assets/save/SLOT_2.json");
+    auto& save_service = context_.getSaveService();
+    const auto format = binary_save_ ? game::data::SaveFormat::BINARY : game::data::SaveFormat::JSON;
+    for (int slot = 1; slot <= 3; ++slot) {
+        if (slot > 1) ImGui::SameLine();
+        if (ImGui::Button(std::format("SLOT {}", slot).c_str())) {
+            // 存档在后台线程编码并写入，完成后通过 SaveCompletedEvent 通知
+            session_data->saveToFileAsync(save_service, slotPath(slot, format), format);
+            save_status_ = "保存中...";
+        }
     }
-    ImGui::SameLine();
-    if (ImGui::Button("SLOT 3")) {
-        session_data->saveToFile("assets/save/SLOT_3.json");
+    ImGui::Checkbox("二进制格式", &binary_save_);
+    if (!save_status_.empty()) {
+        ImGui::Text("%s", save_status_.c_str());
     }
     // 根据是否已经通关，切换显示提示信息
     if (session_data->isLevelClear()) {
@@ -747,7 +1024,7 @@ void DebugUISystem::renderUnitTable() {
         const auto atk = engine::utils::statModify(stats.atk_, unit->level_, unit->rarity_);
         const auto def = engine::utils::statModify(stats.def_, unit->level_, unit->rarity_);
         const auto cost = engine::utils::statModify(player_class_blueprint.player_.cost_, 1, unit->rarity_);
-        std::string type = player_class_blueprint.player_.type_ == game::defs::PlayerType::MELEE ? "近战" : 
+        const char* type = player_class_blueprint.player_.type_ == game::defs::PlayerType::MELEE ? "近战" : 
             player_class_blueprint.player_.type_ == game::defs::PlayerType::RANGED ? "远程" : 
             player_class_blueprint.player_.type_ == game::defs::PlayerType::MIXED ? "混合" : "未知";
 
@@ -755,7 +1032,7 @@ void DebugUISystem::renderUnitTable() {
         const auto& portrait_image = ui_config->getPortrait(unit->name_id_);
         auto portrait_texture = context_.getResourceManager().getTexture(portrait_image.getTextureId(), portrait_image.getTexturePath());
         auto portrait_rect = portrait_image.getSourceRect();  // 源矩形的区域
-        auto sprite_sheet_size = context_.getResourceManager().getTextureSize(portrait_image.getTextureId());   // 获取精灵图的尺寸
+        auto sprite_sheet_size = context_.getResourceManager().getTextureSize(portrait_image.getTextureId(), portrait_image.getTexturePath());   // 获取精灵图的尺寸
 
         // 计算头像的UV坐标（即源矩形左上、右下的坐标，相对于整张精灵图大小的比例，取值在0～1之间）
         float u = portrait_rect->position.x / sprite_sheet_size.x;
@@ -783,7 +1060,7 @@ void DebugUISystem::renderUnitTable() {
         // 如果鼠标悬浮在该UI组件上，显示描述信息（只支持文本）
         ImGui::SetItemTooltip("%s", player_class_blueprint.display_info_.description_.c_str());
         ImGui::TableNextColumn();       // 第三列：类型
-        ImGui::Text("%s", type.c_str());
+        ImGui::Text("%s", type);
         ImGui::TableNextColumn();       // 第四列：等级
         ImGui::Text("%d", unit->level_);
         ImGui::TableNextColumn();       // 第五列：稀有度
@@ -812,7 +1089,8 @@ void DebugUISystem::renderUnitTable() {
             // 根据积分点数，判断是否可以升级，并决定升级按钮是否可用
         bool can_upgrade = session_data->getPoint() >= static_cast<int>(std::round(cost));
         ImGui::BeginDisabled(!can_upgrade);
-        std::string button_text = "- " + std::to_string(static_cast<int>(std::round(cost)));
+        engine::memory::String button_text("- ", context_.getFrameArena().getResource());   // 帧分配器，本帧之后失效
+        button_text += std::to_string(static_cast<int>(std::round(cost)));
         if (ImGui::Button(button_text.c_str())) {   // 如果没有PushID，默认会以Button中显示参数作为ID，那会出现重复ID
             session_data->addPoint(-static_cast<int>(std::round(cost)));
             unit->level_ += 1;
@@ -832,4 +1110,9 @@ void DebugUISystem::onUIPortraitHoverLeaveEvent() {
     hovered_portrait_ = entt::null;
 }
 
+void DebugUISystem::onSaveCompletedEvent(const engine::utils::SaveCompletedEvent& event) {
+    save_status_ = event.success_ ? std::format("已保存: {}", event.path_)
+                                  : std::format("保存失败: {}", event.error_);
+}
+
 } // namespace game::system
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <entt/entity/fwd.hpp>
 #include <entt/entity/entity.hpp>
 #include "../defs/events.h"
@@ -8,6 +9,10 @@ namespace engine::core {
     class Context;
 }
 
+namespace engine::utils {
+    struct SaveCompletedEvent;
+}
+
 namespace game::scene {
     class TitleScene;
     class LevelClearScene;
@@ -28,6 +33,8 @@ class DebugUISystem {
 
     entt::id_type hovered_portrait_{entt::null};    ///< @brief 悬浮肖像的角色名称ID
     bool show_debug_ui_{true};                      ///< @brief 是否显示调试UI
+    bool binary_save_{false};                       ///< @brief 存档时是否使用二进制格式
+    std::string save_status_;                       ///< @brief 最近一次存档的结果 (显示在存档面板中)
 
 public:
     DebugUISystem(entt::registry& registry, engine::core::Context& context);
@@ -44,6 +51,10 @@ private:
     void beginFrame();
     void endFrame();
 
+    /// @brief 派发影响对局的界面事件 (录制时同时记入录像，回放时忽略)
+    template <typename Event>
+    void enqueueUIEvent(const Event& event);
+
     // 封装每个UI显示模块
     // --- GameScene ---
     void renderHoveredPortrait();
@@ -52,6 +63,12 @@ private:
     void renderInfoUI();
     void renderSettingUI();
     void renderDebugUI();
+    void renderResourceUsage();     ///< @brief 调试工具中的资源驻留统计（各类资源的驻留字节数/预算）
+    void renderVoiceStats();        ///< @brief 调试工具中的音效发声统计（上一帧）
+    void renderCullingStats();      ///< @brief 调试工具中的渲染剔除统计（上一帧）
+    void renderFrameStats();        ///< @brief 调试工具中的帧时长分布（p50/p95/p99）
+    void renderMemoryStats();       ///< @brief 调试工具中的内存统计（每帧堆分配次数、帧/场景分配器用量）
+    void renderEcsTelemetry();      ///< @brief 调试工具中的ECS统计（实体数、各组件存储的用量、事件队列，可排序、导出CSV）
 
     // --- TitleScene ---
     void renderTitleLogo();
@@ -75,6 +92,7 @@ private:
     // 事件回调函数
     void onUIPortraitHoverEnterEvent(const game::defs::UIPortraitHoverEnterEvent& event);
     void onUIPortraitHoverLeaveEvent();
+    void onSaveCompletedEvent(const engine::utils::SaveCompletedEvent& event);
 
 };
 
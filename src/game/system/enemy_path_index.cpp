@@ -0,0 +1,84 @@
+#include "enemy_path_index.h"
+#include "../component/enemy_component.h"
+#include "../../engine/component/transform_component.h"
+#include <entt/entity/registry.hpp>
+#include <glm/geometric.hpp>
+#include <spdlog/spdlog.h>
+#include <limits>
+
+namespace game::system {
+
+namespace {
+    constexpr float ENEMY_CELL_SIZE = 128.0f;   ///< @brief 敌人网格的格子边长 (与远程单位的攻击范围相近)
+}
+
+EnemyPathIndex::EnemyPathIndex(entt::registry& registry, const std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes)
+    : registry_(registry), waypoint_nodes_(waypoint_nodes), grid_(ENEMY_CELL_SIZE) {
+    buildDistanceTable();
+    registry_.on_destroy<game::component::EnemyComponent>().connect<&EnemyPathIndex::onEnemyDestroy>(this);
+}
+
+EnemyPathIndex::~EnemyPathIndex() {
+    registry_.on_destroy<game::component::EnemyComponent>().disconnect(this);
+}
+
+void EnemyPathIndex::update() {
+    auto view = registry_.view<engine::component::TransformComponent, game::component::EnemyComponent>();
+    for (auto entity : view) {
+        const auto& transform = view.get<engine::component::TransformComponent>(entity);
+        auto& enemy = view.get<game::component::EnemyComponent>(entity);
+        // 剩余路程 = 目标节点到终点的路程 + 当前位置到目标节点的距离
+        enemy.path_distance_ = std::numeric_limits<float>::max();
+        if (auto it = waypoint_nodes_.find(enemy.target_waypoint_id_); it != waypoint_nodes_.end()) {
+            const float distance_to_home = getDistanceToHome(enemy.target_waypoint_id_);
+            if (distance_to_home < std::numeric_limits<float>::max()) {
+                enemy.path_distance_ = distance_to_home + glm::length(it->second.position_ - transform.position_);
+            }
+        }
+        grid_.update(entity, engine::utils::Rect{transform.position_, glm::vec2(0.0f)});
+    }
+}
+
+void EnemyPathIndex::query(const glm::vec2& center, float radius, std::vector<entt::entity>& out) const {
+    grid_.query(engine::utils::Rect{center - glm::vec2(radius), glm::vec2(radius * 2.0f)}, out);
+}
+
+float EnemyPathIndex::getDistanceToHome(int waypoint_id) const {
+    auto it = distance_to_home_.find(waypoint_id);
+    return it == distance_to_home_.end() ? std::numeric_limits<float>::max() : it->second;
+}
+
+void EnemyPathIndex::buildDistanceTable() {
+    // 终点 (没有下一个节点) 的路程为0；其余节点反复取“到下一个节点的距离 + 下一个节点的路程”的最小值，
+    // 直到不再变化 (节点只有几十个，每轮遍历所有节点即可，最多轮数为节点数量)
+    distance_to_home_.clear();
+    for (const auto& [id, node] : waypoint_nodes_) {
+        if (node.next_node_ids_.empty()) distance_to_home_[id] = 0.0f;
+    }
+    for (std::size_t round = 0; round < waypoint_nodes_.size(); ++round) {
+        bool changed = false;
+        for (const auto& [id, node] : waypoint_nodes_) {
+            for (auto next_id : node.next_node_ids_) {
+                auto next_node = waypoint_nodes_.find(next_id);
+                auto next_distance = distance_to_home_.find(next_id);
+                if (next_node == waypoint_nodes_.end() || next_distance == distance_to_home_.end()) continue;
+                const float distance = next_distance->second + glm::length(next_node->second.position_ - node.position_);
+                auto [it, inserted] = distance_to_home_.try_emplace(id, distance);
+                if (inserted || distance < it->second) {
+                    it->second = distance;
+                    changed = true;
+                }
+            }
+        }
+        if (!changed) break;
+    }
+    if (distance_to_home_.size() != waypoint_nodes_.size()) {
+        spdlog::warn("EnemyPathIndex: {} of {} waypoints cannot reach home", waypoint_nodes_.size() - distance_to_home_.size(), waypoint_nodes_.size());
+    }
+}
+
+void EnemyPathIndex::onEnemyDestroy(entt::registry&, entt::entity entity) {
+    grid_.remove(entity);
+}
+
+} // namespace game::system
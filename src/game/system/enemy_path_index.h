@@ -0,0 +1,56 @@
+#pragma once
+#include <unordered_map>
+#include <vector>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/fwd.hpp>
+#include <glm/vec2.hpp>
+#include "../data/waypoint_node.h"
+#include "../../engine/spatial/spatial_grid.h"
+
+namespace game::system {
+
+/**
+ * @brief 敌人路径索引：敌人沿路径到终点的剩余路程，以及按位置登记敌人的空间网格。
+ *
+ * 构造时对路径节点图计算每个节点到终点的最短路程 (路径节点由 EntityBuilderMW::buildPath 生成，
+ * 分叉处取较短的一支)。update() 时每个敌人的剩余路程 = 目标节点的路程 + 到目标节点的直线距离，
+ * 写入 EnemyComponent::path_distance_，作为“先后”的比较键，不需要每帧对所有敌人排序。
+ * 敌人同时登记在空间网格中 (所在格子不变时几乎没有开销)，范围查询只访问覆盖的格子，
+ * 因此玩家单位选择目标时只比较攻击范围附近的少量敌人。
+ */
+class EnemyPathIndex final {
+    entt::registry& registry_;
+    const std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes_;
+    std::unordered_map<int, float> distance_to_home_;   ///< @brief 路径节点ID -> 到终点的最短路程 (无法到达终点的节点不在表中)
+    engine::spatial::SpatialGrid grid_;                 ///< @brief 敌人位置的空间索引
+
+public:
+    EnemyPathIndex(entt::registry& registry, const std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes);
+    ~EnemyPathIndex();
+
+    // 删除复制/移动操作
+    EnemyPathIndex(const EnemyPathIndex&) = delete;
+    EnemyPathIndex& operator=(const EnemyPathIndex&) = delete;
+    EnemyPathIndex(EnemyPathIndex&&) = delete;
+    EnemyPathIndex& operator=(EnemyPathIndex&&) = delete;
+
+    /// @brief 更新所有敌人的剩余路程与网格中的位置 (在选择目标之前调用)
+    void update();
+
+    /**
+     * @brief 查询圆形范围附近的敌人 (格子粒度的候选，需要由调用者精确检测距离)。
+     * @param center 圆心。
+     * @param radius 半径。
+     * @param out 结果追加到此容器中 (不会清空)。
+     */
+    void query(const glm::vec2& center, float radius, std::vector<entt::entity>& out) const;
+
+    /// @brief 路径节点到终点的最短路程，无法到达终点时返回 float 的最大值
+    [[nodiscard]] float getDistanceToHome(int waypoint_id) const;
+
+private:
+    void buildDistanceTable();      ///< @brief 计算每个路径节点到终点的最短路程
+    void onEnemyDestroy(entt::registry& registry, entt::entity entity);     ///< @brief 从网格中移除
+};
+
+} // namespace game::system
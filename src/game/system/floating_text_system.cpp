@@ -0,0 +1,144 @@
+#include "floating_text_system.h"
+#include "../defs/constants.h"
+#include "../../engine/render/glyph_atlas.h"
+#include "../../engine/render/renderer.h"
+#include "../../engine/render/camera.h"
+#include "../../engine/utils/math.h"
+#include <entt/core/hashed_string.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <string_view>
+
+namespace game::system {
+
+namespace {
+    constexpr std::string_view FONT_PATH = "assets/fonts/VonwaonBitmap-16px.ttf";
+    constexpr int FONT_SIZE = 16;                       ///< @brief 位图字体的原生字号
+    constexpr std::string_view GLYPHS = "0123456789+-!.";   ///< @brief 预先光栅化的字符
+
+    constexpr float LIFETIME = 0.8f;                    ///< @brief 飘字寿命 (秒)
+    constexpr float RISE_SPEED = 60.0f;                 ///< @brief 初始上升速度 (像素/秒)
+    constexpr float SPREAD_SPEED = 12.0f;               ///< @brief 水平速度的间隔 (相邻飘字错开，避免重叠)
+    constexpr float DAMPING = 3.0f;                     ///< @brief 速度衰减系数 (每秒)
+    constexpr float FADE_START = 0.6f;                  ///< @brief 开始淡出的时刻 (寿命的比例)
+    constexpr float POP_DURATION = 0.12f;               ///< @brief 出现时放大效果的持续时间 (秒)
+    constexpr float POP_SCALE = 0.5f;                   ///< @brief 出现时额外放大的比例
+    constexpr float SHADOW_OFFSET = 1.0f;               ///< @brief 阴影偏移 (像素，随缩放)
+
+    constexpr engine::utils::FColor ENEMY_DAMAGE_COLOR = {1.0f, 1.0f, 1.0f, 1.0f};
+    constexpr engine::utils::FColor PLAYER_DAMAGE_COLOR = {1.0f, 0.3f, 0.3f, 1.0f};
+    constexpr engine::utils::FColor HEAL_COLOR = {0.4f, 1.0f, 0.4f, 1.0f};
+}
+
+FloatingTextSystem::FloatingTextSystem(entt::dispatcher& dispatcher, engine::render::Renderer& renderer,
+                                       engine::resource::ResourceManager& resource_manager)
+    : dispatcher_(dispatcher) {
+    atlas_ = std::make_unique<engine::render::GlyphAtlas>(renderer, resource_manager, entt::hashed_string::value(FONT_PATH.data(), FONT_PATH.size()),
+                                                          FONT_SIZE, FONT_PATH, GLYPHS);
+    dispatcher_.sink<game::defs::CombatTextEvent>().connect<&FloatingTextSystem::onCombatTextEvent>(this);
+}
+
+FloatingTextSystem::~FloatingTextSystem() {
+    dispatcher_.disconnect(this);
+}
+
+void FloatingTextSystem::update(float delta_time) {
+    const std::size_t count = positions_.size();
+    if (count == 0) return;
+
+    // 逐列计算 (连续数组上的纯计算，无分支)
+    const float damping = std::max(0.0f, 1.0f - DAMPING * delta_time);
+    glm::vec2* positions = positions_.data();
+    glm::vec2* velocities = velocities_.data();
+    float* ages = ages_.data();
+    for (std::size_t i = 0; i < count; ++i) {
+        positions[i] += velocities[i] * delta_time;
+        velocities[i] *= damping;
+        ages[i] += delta_time;
+    }
+
+    // 从后向前移除过期的飘字，交换到当前位置的元素已经检查过
+    for (std::size_t i = count; i-- > 0;) {
+        if (ages_[i] >= lifetimes_[i]) removeAt(i);
+    }
+}
+
+void FloatingTextSystem::render(engine::render::Renderer& renderer, const engine::render::Camera& camera) {
+    if (positions_.empty()) return;
+    const auto viewport_size = camera.getViewportSize();
+    const float line_height = atlas_->getLineHeight();
+
+    // 第一个字符预留给治疗的 '+'
+    char buffer[16];
+    buffer[0] = '+';
+    for (std::size_t i = 0; i < positions_.size(); ++i) {
+        const auto kind = kinds_[i];
+        const auto result = std::to_chars(buffer + 1, buffer + sizeof(buffer), values_[i]);
+        const auto* text_begin = kind == Kind::HEAL ? buffer : buffer + 1;
+        const std::string_view text(text_begin, static_cast<std::size_t>(result.ptr - text_begin));
+
+        // 出现时先放大再恢复，寿命末尾淡出
+        const float age = ages_[i];
+        const float progress = age / lifetimes_[i];
+        const float scale = 1.0f + POP_SCALE * std::max(0.0f, 1.0f - age / POP_DURATION);
+        const float alpha = std::clamp(1.0f - (progress - FADE_START) / (1.0f - FADE_START), 0.0f, 1.0f);
+
+        // 位置为文字底部中点，视口外的跳过
+        const glm::vec2 size{atlas_->measure(text, scale), line_height * scale};
+        const glm::vec2 top_left = camera.worldToScreen(positions_[i]) - glm::vec2(size.x / 2.0f, size.y);
+        if (top_left.x + size.x < 0.0f || top_left.x > viewport_size.x || top_left.y + size.y < 0.0f || top_left.y > viewport_size.y) {
+            continue;
+        }
+
+        auto color = kind == Kind::HEAL ? HEAL_COLOR : (kind == Kind::PLAYER_DAMAGE ? PLAYER_DAMAGE_COLOR : ENEMY_DAMAGE_COLOR);
+        color.a = alpha;
+        atlas_->addText(batch_, text, top_left + glm::vec2(SHADOW_OFFSET * scale), scale, {0.0f, 0.0f, 0.0f, alpha});
+        atlas_->addText(batch_, text, top_left, scale, color);
+    }
+    // 所有飘字合并为一次绘制调用
+    renderer.drawBatch(batch_, atlas_->getTexture());
+}
+
+void FloatingTextSystem::clear() {
+    positions_.clear();
+    velocities_.clear();
+    ages_.clear();
+    lifetimes_.clear();
+    values_.clear();
+    kinds_.clear();
+}
+
+void FloatingTextSystem::onCombatTextEvent(const game::defs::CombatTextEvent& event) {
+    if (event.amount_ <= 0.0f || positions_.size() >= MAX_TEXTS) return;
+    // 相邻生成的飘字向左右错开 (-2 ~ 2 倍间隔)
+    const float spread = static_cast<float>(static_cast<int>(spawn_count_++ % 5) - 2) * SPREAD_SPEED;
+    positions_.push_back(event.position_ + glm::vec2(0.0f, game::defs::FLOATING_TEXT_OFFSET_Y));
+    velocities_.emplace_back(spread, -RISE_SPEED);
+    ages_.push_back(0.0f);
+    lifetimes_.push_back(LIFETIME);
+    // 小于1的伤害也显示为1
+    values_.push_back(std::max<std::int32_t>(1, static_cast<std::int32_t>(std::lround(event.amount_))));
+    kinds_.push_back(event.heal_ ? Kind::HEAL : (event.is_player_ ? Kind::PLAYER_DAMAGE : Kind::ENEMY_DAMAGE));
+}
+
+void FloatingTextSystem::removeAt(std::size_t index) {
+    const std::size_t last = positions_.size() - 1;
+    if (index != last) {
+        positions_[index] = positions_[last];
+        velocities_[index] = velocities_[last];
+        ages_[index] = ages_[last];
+        lifetimes_[index] = lifetimes_[last];
+        values_[index] = values_[last];
+        kinds_[index] = kinds_[last];
+    }
+    positions_.pop_back();
+    velocities_.pop_back();
+    ages_.pop_back();
+    lifetimes_.pop_back();
+    values_.pop_back();
+    kinds_.pop_back();
+}
+
+} // namespace game::system
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <entt/signal/fwd.hpp>
+#include <glm/vec2.hpp>
+#include "../defs/events.h"
+#include "../../engine/render/primitive_batch.h"
+
+namespace engine::render {
+    class Renderer;
+    class Camera;
+    class GlyphAtlas;
+}
+
+namespace engine::resource {
+    class ResourceManager;
+}
+
+namespace game::system {
+
+/**
+ * @brief 战斗飘字系统，在单位头顶显示伤害与治疗数值
+ *
+ * 飘字不是注册表中的实体，而是按列保存的粒子 (位置、速度、已存在时间、寿命、数值、类型各一个数组)：
+ * 更新时逐列计算，过期的飘字与末尾交换后移除，数组容量在帧间复用。
+ * 文字使用启动时预先光栅化的位图字体图集 (数字与少量符号)，所有飘字 (含阴影) 合并为一次绘制调用。
+ * 飘字只是显示效果，不保存到快照中，恢复快照时清空。
+ */
+class FloatingTextSystem {
+public:
+    static constexpr std::size_t MAX_TEXTS = 512;       ///< @brief 同时存在的飘字上限 (超出时丢弃新的飘字)
+
+private:
+    /// @brief 飘字类型 (决定颜色与前缀)
+    enum class Kind : std::uint8_t {
+        ENEMY_DAMAGE,       ///< @brief 敌人受到伤害
+        PLAYER_DAMAGE,      ///< @brief 玩家单位受到伤害
+        HEAL,               ///< @brief 治疗
+    };
+
+    entt::dispatcher& dispatcher_;
+    std::unique_ptr<engine::render::GlyphAtlas> atlas_;     ///< @brief 数字与符号的位图字体图集
+
+    // --- 飘字 (按列保存，下标相同的元素属于同一个飘字) ---
+    std::vector<glm::vec2> positions_;      ///< @brief 世界坐标 (文字底部中点)
+    std::vector<glm::vec2> velocities_;     ///< @brief 速度 (像素/秒)
+    std::vector<float> ages_;               ///< @brief 已存在的时间 (秒)
+    std::vector<float> lifetimes_;          ///< @brief 寿命 (秒)
+    std::vector<std::int32_t> values_;      ///< @brief 显示的数值
+    std::vector<Kind> kinds_;               ///< @brief 类型
+
+    std::uint32_t spawn_count_{0};          ///< @brief 已生成的飘字数量 (用于错开水平速度)
+    engine::render::PrimitiveBatch batch_;  ///< @brief 绘制时累积的字形四边形
+
+public:
+    /**
+     * @brief 构造函数，创建位图字体图集
+     * @throws std::runtime_error 如果图集创建失败
+     */
+    FloatingTextSystem(entt::dispatcher& dispatcher, engine::render::Renderer& renderer, engine::resource::ResourceManager& resource_manager);
+    ~FloatingTextSystem();
+
+    void update(float delta_time);                  ///< @brief 移动飘字并移除过期的飘字
+    void render(engine::render::Renderer& renderer, const engine::render::Camera& camera);  ///< @brief 一次绘制调用绘制所有飘字
+    void clear();                                   ///< @brief 清空所有飘字 (恢复快照时调用)
+
+    [[nodiscard]] std::size_t size() const { return positions_.size(); }
+
+private:
+    void onCombatTextEvent(const game::defs::CombatTextEvent& event);
+    void removeAt(std::size_t index);               ///< @brief 与末尾交换后移除
+};
+
+} // namespace game::system
@@ -6,7 +6,7 @@
 #include "../defs/events.h"
 #include "../../engine/component/velocity_component.h"
 #include "../../engine/component/transform_component.h"
-#include "../../engine/utils/math.h"
+#include "../../engine/utils/random.h"
 #include <entt/signal/dispatcher.hpp>
 #include <entt/entity/registry.hpp>
 #include <glm/geometric.hpp>
@@ -17,14 +17,15 @@ namespace game::system {
 
 void FollowPathSystem::update(entt::registry& registry, entt::dispatcher& dispatcher, std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes) {
     spdlog::trace("FollowPathSystem::update");
-    // 筛选依据：速度组件、变换组件、敌人组件，排除“被阻挡的敌人”和“动作锁定敌人”
-    auto view = registry.view<engine::component::VelocityComponent, 
-        engine::component::TransformComponent, 
-        game::component::EnemyComponent>(entt::exclude<game::component::BlockedByComponent, game::defs::ActionLockTag>);
-    for (auto entity : view) {
-        auto& velocity = view.get<engine::component::VelocityComponent>(entity);
-        auto& transform = view.get<engine::component::TransformComponent>(entity);
-        auto& enemy = view.get<game::component::EnemyComponent>(entity);
+    // 筛选依据：敌人组件、速度组件、变换组件，排除“被阻挡的敌人”和“动作锁定敌人”
+    // 拥有组：敌人组件按组内顺序紧密排列 (速度与变换组件已被 MovementSystem 的组拥有，只能按实体查找)。
+    // 排除条件不放进组：快照恢复时标签在敌人组件之后载入，会打乱组内顺序，进而改变随机选择路径的顺序。
+    auto group = registry.group<game::component::EnemyComponent>(
+        entt::get<engine::component::VelocityComponent, engine::component::TransformComponent>);
+    const auto& blocked_by_storage = registry.storage<game::component::BlockedByComponent>();
+    const auto& action_lock_storage = registry.storage<game::defs::ActionLockTag>();
+    for (auto [entity, enemy, velocity, transform] : group.each()) {
+        if (blocked_by_storage.contains(entity) || action_lock_storage.contains(entity)) continue;
 
         // 获取目标节点
         auto target_node = waypoint_nodes.at(enemy.target_waypoint_id_);
@@ -43,8 +44,8 @@ void FollowPathSystem::update(entt::registry& registry, entt::dispatcher& dispat
                 registry.emplace<game::defs::DeadTag>(entity);          // 用于延迟删除
                 continue;
             }
-            // 随机选择下一个节点
-            auto target_index = engine::utils::randomInt(0, size - 1);
+            // 随机选择下一个节点 (使用场景的随机数生成器，保证对局可以复现)
+            auto target_index = registry.ctx().get<engine::utils::Random&>().randomInt(0, static_cast<int>(size) - 1);
             enemy.target_waypoint_id_ = target_node.next_node_ids_[target_index];
             // 更新目标节点与方向矢量
             target_node = waypoint_nodes.at(enemy.target_waypoint_id_);
@@ -15,6 +15,7 @@ class CombatResolveSystem;
 class ProjectileSystem;
 class EffectSystem;
 class HealthBarSystem;
+class FloatingTextSystem;
 class GameRuleSystem;
 class PlaceUnitSystem;
 class RenderRangeSystem;
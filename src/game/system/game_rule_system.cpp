@@ -3,10 +3,12 @@
 #include "../factory/blueprint_manager.h"
 #include "../component/cost_regen_component.h"
 #include "../component/stats_component.h"
+#include "../component/level_component.h"
 #include "../component/class_name_component.h"
 #include "../../engine/component/transform_component.h"
 #include "../../engine/utils/math.h"
 #include "../../engine/utils/events.h"
+#include "../../engine/core/timing_wheel.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include <entt/core/hashed_string.hpp>
@@ -22,10 +24,14 @@ GameRuleSystem::GameRuleSystem(entt::registry& registry, entt::dispatcher& dispa
     dispatcher_.sink<game::defs::UpgradeUnitEvent>().connect<&GameRuleSystem::onUpgradeUnitEvent>(this);
     dispatcher_.sink<game::defs::RetreatEvent>().connect<&GameRuleSystem::onRetreatEvent>(this);
     dispatcher_.sink<game::defs::LevelClearDelayedEvent>().connect<&GameRuleSystem::onLevelClearDelayedEvent>(this);
+    registry_.ctx().get<engine::core::TimingWheel&>().connect<&GameRuleSystem::onLevelClearTimer>("level_clear"_hs, this);
 }
 
 GameRuleSystem::~GameRuleSystem() {
     dispatcher_.disconnect(this);
+    auto& timing_wheel = registry_.ctx().get<engine::core::TimingWheel&>();
+    timing_wheel.cancel(level_clear_timer_);
+    timing_wheel.disconnect("level_clear"_hs);
 }
 
 void GameRuleSystem::update(float delta_time) {
@@ -38,14 +44,6 @@ void GameRuleSystem::update(float delta_time) {
         auto& cost_regen = view_cost_regen.get<game::component::CostRegenComponent>(entity);
         game_stats.cost_ += cost_regen.rate_ * delta_time;
     }
-    // 如果已经通关，计时器归零后切换场景
-    if (is_level_clear_) {
-        level_clear_timer_ -= delta_time;
-        if (level_clear_timer_ <= 0.0f) {
-            dispatcher_.enqueue(game::defs::LevelClearEvent{});
-            is_level_clear_ = false;    // 重置关卡通关标志, 避免重复触发
-        }
-    }
 }
 
 void GameRuleSystem::onEnemyArriveHome(const game::defs::EnemyArriveHomeEvent&) {
@@ -69,17 +67,18 @@ void GameRuleSystem::onUpgradeUnitEvent(const game::defs::UpgradeUnitEvent& even
     // 扣除COST
     auto& game_stats = registry_.ctx().get<game::data::GameStats&>();
     game_stats.cost_ -= event.cost_;
-    // 获取Stats组件并让其等级 + 1
+    // 获取Level组件并让其等级 + 1
+    auto& level = registry_.get<game::component::LevelComponent>(event.entity_);
+    level.level_++;
     auto& stats = registry_.get<game::component::StatsComponent>(event.entity_);
-    stats.level_++;
     // 更新属性 (需要从蓝图中获取基础数据，然后根据等级和稀有度修改Stats组件)
     auto& blueprint_mgr = registry_.ctx().get<std::shared_ptr<game::factory::BlueprintManager>>();
     const auto& class_name = registry_.get<game::component::ClassNameComponent>(event.entity_);
     const auto& stats_blueprint = blueprint_mgr->getPlayerClassBlueprint(class_name.class_id_).stats_;
-    stats.hp_ = engine::utils::statModify(stats_blueprint.hp_, stats.level_, stats.rarity_);
-    stats.max_hp_ = engine::utils::statModify(stats_blueprint.hp_, stats.level_, stats.rarity_);
-    stats.atk_ = engine::utils::statModify(stats_blueprint.atk_, stats.level_, stats.rarity_);
-    stats.def_ = engine::utils::statModify(stats_blueprint.def_, stats.level_, stats.rarity_);
+    stats.hp_ = engine::utils::statModify(stats_blueprint.hp_, level.level_, level.rarity_);
+    stats.max_hp_ = engine::utils::statModify(stats_blueprint.hp_, level.level_, level.rarity_);
+    stats.atk_ = engine::utils::statModify(stats_blueprint.atk_, level.level_, level.rarity_);
+    stats.def_ = engine::utils::statModify(stats_blueprint.def_, level.level_, level.rarity_);
     // 创建特效
     const auto& transform = registry_.get<engine::component::TransformComponent>(event.entity_);
     dispatcher_.enqueue(game::defs::EffectEvent{"level_up"_hs, transform.position_, false});
@@ -97,9 +96,15 @@ void GameRuleSystem::onRetreatEvent(const game::defs::RetreatEvent& event) {
 }
 
 void GameRuleSystem::onLevelClearDelayedEvent(const game::defs::LevelClearDelayedEvent& event) {
-    // 设置关卡通关标志和计时器
-    is_level_clear_ = true;
-    level_clear_timer_ = event.delay_time_;
+    // 设置关卡通关计时器 (重复触发时以最后一次为准)
+    auto& timing_wheel = registry_.ctx().get<engine::core::TimingWheel&>();
+    timing_wheel.cancel(level_clear_timer_);
+    level_clear_timer_ = timing_wheel.schedule(event.delay_time_, "level_clear"_hs);
+}
+
+void GameRuleSystem::onLevelClearTimer(entt::entity) {
+    // 延迟结束，切换场景 (计时器只触发一次，不会重复发送)
+    dispatcher_.enqueue(game::defs::LevelClearEvent{});
 }
 
 }   // namespace game::system
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../defs/events.h"
+#include "../../engine/core/timer_handle.h"
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
 
@@ -15,8 +16,7 @@ class GameRuleSystem {
     entt::registry& registry_;
     entt::dispatcher& dispatcher_;
 
-    bool is_level_clear_{false};        ///< @brief 是否关卡通关
-    float level_clear_timer_{0.0f};     ///< @brief 关卡通关计时器(实现延迟切换场景)
+    engine::core::TimerHandle level_clear_timer_{};     ///< @brief 关卡通关计时器(实现延迟切换场景)
 
 public:
     GameRuleSystem(entt::registry& registry, entt::dispatcher& dispatcher);
@@ -24,6 +24,12 @@ public:
 
     void update(float delta_time);
 
+    /// @brief 读写快照 (计时器句柄需与时间轮一起保存)
+    template <typename Archive>
+    void serialize(Archive& archive) {
+        archive(level_clear_timer_);
+    }
+
 private:
     // 事件回调函数
     void onEnemyArriveHome(const game::defs::EnemyArriveHomeEvent& event);
@@ -31,6 +37,9 @@ private:
     void onRetreatEvent(const game::defs::RetreatEvent& event);
     void onLevelClearDelayedEvent(const game::defs::LevelClearDelayedEvent& event);
 
+    // 时间轮回调函数
+    void onLevelClearTimer(entt::entity entity);
+
 };
 
 }
\ No newline at end of file
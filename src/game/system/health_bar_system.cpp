@@ -17,6 +17,8 @@ void HealthBarSystem::update(entt::registry& registry, engine::render::Renderer&
         game::defs::HasHealthBarTag,
         game::defs::InjuredTag>();
 
+    // 所有血量条合并为一次绘制调用
+    renderer.beginBatch();
     for (auto entity : view) {
         const auto [transform, stats] = view.get<engine::component::TransformComponent, game::component::StatsComponent>(entity);
 
@@ -40,6 +42,7 @@ void HealthBarSystem::update(entt::registry& registry, engine::render::Renderer&
         size.x = size.x * health_percent;
         renderer.drawFilledRect(camera, position, size, color);
     }
+    renderer.flushBatch();
 }
 
 } // namespace game::system
\ No newline at end of file
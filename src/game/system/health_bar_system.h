@@ -11,6 +11,7 @@ namespace game::system {
 
 /**
  * @brief 地图血量条系统(渲染)，用于显示角色的血量条
+ * @note 所有血量条在一个图元批中绘制
  */
 class HealthBarSystem {
 public:
@@ -36,6 +36,11 @@ void ProjectileSystem::update(float delta_time) {
         // 如果飞行时间超过总飞行时间，则命中目标（发送攻击事件以及播放音效）并销毁
         if (projectile.current_flight_time_ >= projectile.total_flight_time_) {
             dispatcher_.enqueue(game::defs::AttackEvent{entity, projectile.target_, projectile.damage_});
+            // 溅射：命中点周围的其它单位受到衰减后的伤害 (目标已死亡时仍会在落点造成溅射)
+            if (projectile.splash_radius_ > 0.0f) {
+                dispatcher_.enqueue(game::defs::AreaEffectEvent{entity, projectile.target_, projectile.target_position_,
+                    projectile.splash_radius_, projectile.splash_falloff_, projectile.damage_, false, projectile.target_is_player_});
+            }
             dispatcher_.enqueue(engine::utils::PlaySoundEvent{entity, "hit"_hs});
             registry_.emplace<game::defs::DeadTag>(entity);
             continue;
@@ -13,7 +13,7 @@ namespace game::system {
 /**
  * @brief 投射物系统
  * 1. 相响应投射物创建事件，创建投射物实体
- * 2. 更新投射物的飞行状态，并发送攻击事件和播放音效
+ * 2. 更新投射物的飞行状态，并发送攻击事件和播放音效 (带溅射的投射物同时发送范围攻击事件)
  */
 class ProjectileSystem {
     entt::registry& registry_;
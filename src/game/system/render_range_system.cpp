@@ -10,6 +10,8 @@
 namespace game::system {
 
 void RenderRangeSystem::update(entt::registry& registry, engine::render::Renderer& renderer, const engine::render::Camera& camera) {
+    // 所有范围圆形合并为一次绘制调用
+    renderer.beginBatch();
     // 准备放置类型的单位
     auto view_prep = registry.view<game::defs::ShowRangeTag, engine::component::TransformComponent, game::component::UnitPrepComponent>();
     for (auto entity : view_prep) {
@@ -26,6 +28,7 @@ void RenderRangeSystem::update(entt::registry& registry, engine::render::Rendere
         // 攻击范围显示为透明绿色圆形
         renderer.drawFilledCircle(camera, transform.position_, stats.range_, game::defs::RANGE_COLOR);
     }
+    renderer.flushBatch();
 }
 
 }   // namespace game::system
\ No newline at end of file
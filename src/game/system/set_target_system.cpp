@@ -12,16 +12,19 @@
 
 namespace game::system {
 
-void SetTargetSystem::update(entt::registry& registry) {
-    updateHasTarget(registry);
-    updateNoTargetPlayer(registry);
-    updateNoTargetEnemy(registry);
-    updateHealer(registry);
+SetTargetSystem::SetTargetSystem(entt::registry& registry, const std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes)
+    : registry_(registry), enemy_index_(registry, waypoint_nodes) {}
+
+void SetTargetSystem::update() {
+    updateHasTarget();
+    updateNoTargetPlayer();
+    updateNoTargetEnemy();
+    updateHealer();
 }
 
-void SetTargetSystem::updateHasTarget(entt::registry& registry) {
+void SetTargetSystem::updateHasTarget() {
     // 筛选条件：敌我双方所有攻击型角色（排除治疗者，治疗者是另外逻辑）
-    auto view_has_target = registry.view<engine::component::TransformComponent, 
+    auto view_has_target = registry_.view<engine::component::TransformComponent, 
         game::component::TargetComponent, 
         game::component::StatsComponent>(entt::exclude<game::defs::HealerTag>);
     // 遍历每一个有目标的角色
@@ -30,59 +33,67 @@ void SetTargetSystem::updateHasTarget(entt::registry& registry) {
         const auto& transform = view_has_target.get<engine::component::TransformComponent>(entity);
         const auto& stats = view_has_target.get<game::component::StatsComponent>(entity);
         // 检查目标是否还有效
-        if (!registry.valid(target.entity_)) {
+        if (!registry_.valid(target.entity_)) {
             // 如果目标实体无效，则清除目标
-            registry.remove<game::component::TargetComponent>(entity);
+            registry_.remove<game::component::TargetComponent>(entity);
             spdlog::info("ID: {}, target: ID: {}, invalid, clear target", 
                          entt::to_integral(entity), 
                          entt::to_integral(target.entity_));
             continue;
         }
         // 检查目标是否还在攻击范围之内（检测半径 = 角色攻击范围 + 目标角色半径）
-        const auto& target_transform = registry.get<engine::component::TransformComponent>(target.entity_);
+        const auto& target_transform = registry_.get<engine::component::TransformComponent>(target.entity_);
         auto range_radius = stats.range_ + game::defs::UNIT_RADIUS;
         if (engine::utils::distanceSquared(transform.position_, target_transform.position_) > range_radius * range_radius) {
             // 如果在攻击范围外，则清除目标
-            registry.remove<game::component::TargetComponent>(entity);
+            registry_.remove<game::component::TargetComponent>(entity);
             spdlog::info("ID: {}, target: ID: {}, not in range, clear target", entt::to_integral(entity), entt::to_integral(target.entity_));
             continue;
         }
     }
 }
 
-void SetTargetSystem::updateNoTargetPlayer(entt::registry& registry) {
+void SetTargetSystem::updateNoTargetPlayer() {
     // 筛选条件：没有目标的玩家攻击型角色
-    auto view_player_no_target = registry.view<engine::component::TransformComponent, 
+    auto view_player_no_target = registry_.view<engine::component::TransformComponent, 
         game::component::StatsComponent, 
         game::component::PlayerComponent>(entt::exclude<game::component::TargetComponent, game::defs::HealerTag>);
-    // 获取所有敌方角色用于检测
-    auto view_enemy = registry.view<engine::component::TransformComponent, game::component::EnemyComponent>();
+    if (view_player_no_target.begin() == view_player_no_target.end()) return;
+    // 更新敌人的剩余路程与网格 (没有需要选择目标的角色时不必更新)
+    enemy_index_.update();
     // 遍历每一个没有目标的玩家攻击型角色
     for (auto player_entity : view_player_no_target) {
         const auto& player_transform = view_player_no_target.get<engine::component::TransformComponent>(player_entity);
         const auto& player_stats = view_player_no_target.get<game::component::StatsComponent>(player_entity);
-        // 检查敌人是否在攻击范围之内
-        for (auto enemy_entity : view_enemy) {
-            const auto& enemy_transform = view_enemy.get<engine::component::TransformComponent>(enemy_entity);
-            auto range_radius = player_stats.range_ + game::defs::UNIT_RADIUS;
-            if (engine::utils::distanceSquared(player_transform.position_, enemy_transform.position_) <= range_radius * range_radius) {
-                // 如果敌人在攻击范围之内，则设置目标
-                registry.emplace<game::component::TargetComponent>(player_entity, enemy_entity);
-                spdlog::info("player: ID: {}, set target: ID: {}", entt::to_integral(player_entity), entt::to_integral(enemy_entity));
-                break;  // 设置一个目标敌人就停止检查
+        const auto policy = view_player_no_target.get<game::component::PlayerComponent>(player_entity).target_policy_;
+        // 只检查攻击范围附近的敌人，按目标优先级选出最优的一个
+        auto range_radius = player_stats.range_ + game::defs::UNIT_RADIUS;
+        candidates_.clear();
+        enemy_index_.query(player_transform.position_, range_radius, candidates_);
+        entt::entity target_entity = entt::null;
+        for (auto enemy_entity : candidates_) {
+            const auto& enemy_transform = registry_.get<engine::component::TransformComponent>(enemy_entity);
+            if (engine::utils::distanceSquared(player_transform.position_, enemy_transform.position_) > range_radius * range_radius) continue;
+            if (target_entity == entt::null || isPreferred(policy, enemy_entity, target_entity)) {
+                target_entity = enemy_entity;
             }
         }
+        if (target_entity != entt::null) {
+            // 如果有敌人在攻击范围之内，则设置目标
+            registry_.emplace<game::component::TargetComponent>(player_entity, target_entity);
+            spdlog::info("player: ID: {}, set target: ID: {}", entt::to_integral(player_entity), entt::to_integral(target_entity));
+        }
     }
 }
 
-void SetTargetSystem::updateNoTargetEnemy(entt::registry& registry) {
+void SetTargetSystem::updateNoTargetEnemy() {
     // 筛选条件：没有目标的敌人角色（只考虑远程型，近战敌人的目标就是阻挡者）
-    auto view_enemy_no_target = registry.view<game::component::EnemyComponent, 
+    auto view_enemy_no_target = registry_.view<game::component::EnemyComponent, 
         engine::component::TransformComponent, 
         game::component::StatsComponent, 
         game::defs::RangedUnitTag>(entt::exclude<game::component::TargetComponent>);
     // 获取所有玩家角色用于检测
-    auto view_player = registry.view<engine::component::TransformComponent, game::component::PlayerComponent>();
+    auto view_player = registry_.view<engine::component::TransformComponent, game::component::PlayerComponent>();
     // 遍历每一个没有目标的敌人角色
     for (auto enemy_entity : view_enemy_no_target) {
         const auto& enemy_transform = view_enemy_no_target.get<engine::component::TransformComponent>(enemy_entity);
@@ -93,7 +104,7 @@ void SetTargetSystem::updateNoTargetEnemy(entt::registry& registry) {
             auto range_radius = enemy_stats.range_ + game::defs::UNIT_RADIUS;
             if (engine::utils::distanceSquared(enemy_transform.position_, player_transform.position_) <= range_radius * range_radius) {
                 // 如果玩家角色在攻击范围之内，则设置目标
-                registry.emplace<game::component::TargetComponent>(enemy_entity, player_entity);
+                registry_.emplace<game::component::TargetComponent>(enemy_entity, player_entity);
                 spdlog::info("enemy: ID: {}, set target: ID: {}", entt::to_integral(enemy_entity), entt::to_integral(player_entity));
                 break;  // 设置一个目标玩家角色就停止检查
             }
@@ -101,22 +112,22 @@ void SetTargetSystem::updateNoTargetEnemy(entt::registry& registry) {
     }
 }
 
-void SetTargetSystem::updateHealer(entt::registry& registry) {
+void SetTargetSystem::updateHealer() {
     // --- 检查治疗者(玩家角色)的目标，选择血量百分比最低的受伤玩家角色作为目标 ---
     // 筛选条件：玩家治疗者角色
-    auto view_healer = registry.view<game::defs::HealerTag, 
+    auto view_healer = registry_.view<game::defs::HealerTag, 
         game::component::PlayerComponent,
         engine::component::TransformComponent,
         game::component::StatsComponent>();
     // 获取所有受伤玩家角色用于检测
-    auto view_injured_player = registry.view<game::component::PlayerComponent, 
+    auto view_injured_player = registry_.view<game::component::PlayerComponent, 
         game::component::StatsComponent, 
         game::defs::InjuredTag,
         engine::component::TransformComponent>();
     // 遍历每一个治疗者
     for (auto healer_entity : view_healer) {
-        auto& healer_stats = registry.get<game::component::StatsComponent>(healer_entity);
-        auto& healer_transform = registry.get<engine::component::TransformComponent>(healer_entity);
+        auto& healer_stats = registry_.get<game::component::StatsComponent>(healer_entity);
+        auto& healer_transform = registry_.get<engine::component::TransformComponent>(healer_entity);
         // ---获取血量百分比最低的玩家角色---
         float lowest_hp_percent = 1.0f;             // 保存最低血量百分比（初始为100%）
         entt::entity lowest_hp_player = entt::null; // 保存最低血量百分比的玩家角色（初始为空）
@@ -138,13 +149,32 @@ void SetTargetSystem::updateHealer(entt::registry& registry) {
         // 如果找到了最低血量百分比的玩家角色，则设置目标
         if (lowest_hp_player != entt::null) {
             // 设置（更新）目标
-            registry.emplace_or_replace<game::component::TargetComponent>(healer_entity, lowest_hp_player);
+            registry_.emplace_or_replace<game::component::TargetComponent>(healer_entity, lowest_hp_player);
         }
         // 否则移除目标(即使没有组件，也可以安全调用remove)
         else {
-            registry.remove<game::component::TargetComponent>(healer_entity);
+            registry_.remove<game::component::TargetComponent>(healer_entity);
         }
     }
 }
 
+bool SetTargetSystem::isPreferred(game::defs::TargetPolicy policy, entt::entity candidate, entt::entity current) const {
+    const auto& candidate_enemy = registry_.get<game::component::EnemyComponent>(candidate);
+    const auto& current_enemy = registry_.get<game::component::EnemyComponent>(current);
+    // 生命值优先级：生命值不同时直接决定
+    if (policy == game::defs::TargetPolicy::STRONGEST || policy == game::defs::TargetPolicy::WEAKEST) {
+        const float candidate_hp = registry_.get<game::component::StatsComponent>(candidate).hp_;
+        const float current_hp = registry_.get<game::component::StatsComponent>(current).hp_;
+        if (candidate_hp != current_hp) {
+            return policy == game::defs::TargetPolicy::STRONGEST ? candidate_hp > current_hp : candidate_hp < current_hp;
+        }
+    }
+    // 路程优先级 (生命值相同时也按离终点的远近)
+    if (candidate_enemy.path_distance_ != current_enemy.path_distance_) {
+        return policy == game::defs::TargetPolicy::LAST ? candidate_enemy.path_distance_ > current_enemy.path_distance_
+                                                        : candidate_enemy.path_distance_ < current_enemy.path_distance_;
+    }
+    return entt::to_integral(candidate) < entt::to_integral(current);
+}
+
 }   // namespace game::system
\ No newline at end of file
@@ -1,22 +1,41 @@
 #pragma once
 
+#include "enemy_path_index.h"
+#include "../data/waypoint_node.h"
+#include "../defs/constants.h"
+#include <unordered_map>
+#include <vector>
+#include <entt/entity/entity.hpp>
 #include <entt/entity/fwd.hpp>
 
 namespace game::system {
 
 /**
  * @brief 设置目标系统，用于设置角色的攻击目标。
+ *
+ * 没有目标的玩家攻击型角色从攻击范围内的敌人中按职业的目标优先级 (TargetPolicy) 选择目标：
+ * 候选敌人由 EnemyPathIndex 的空间网格查询得到，“先后”使用敌人到终点的剩余路程比较，
+ * 生命值相同或路程相同时依次比较剩余路程与实体ID，保证结果与候选顺序无关 (快照恢复后结果相同)。
  */
 class SetTargetSystem {
+    entt::registry& registry_;
+    EnemyPathIndex enemy_index_;                ///< @brief 敌人的剩余路程与空间网格
+    std::vector<entt::entity> candidates_;      ///< @brief 网格查询得到的候选敌人 (复用容量)
+
 public:
-    void update(entt::registry& registry);
+    SetTargetSystem(entt::registry& registry, const std::unordered_map<int, game::data::WaypointNode>& waypoint_nodes);
+
+    void update();
 
 private:
     // 拆分逻辑的函数，在update中调用
-    void updateHasTarget(entt::registry& registry);         ///< @brief 处理有目标的角色
-    void updateNoTargetPlayer(entt::registry& registry);    ///< @brief 处理没有目标的玩家攻击型角色
-    void updateNoTargetEnemy(entt::registry& registry);     ///< @brief 处理没有目标的敌人角色
-    void updateHealer(entt::registry& registry);            ///< @brief 处理治疗者
+    void updateHasTarget();         ///< @brief 处理有目标的角色
+    void updateNoTargetPlayer();    ///< @brief 处理没有目标的玩家攻击型角色
+    void updateNoTargetEnemy();     ///< @brief 处理没有目标的敌人角色
+    void updateHealer();            ///< @brief 处理治疗者
+
+    /// @brief 按目标优先级比较两个敌人，candidate 优先于 current 时返回 true
+    [[nodiscard]] bool isPreferred(game::defs::TargetPolicy policy, entt::entity candidate, entt::entity current) const;
 };
 
 }   // namespace game::system
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "../component/cost_regen_component.h"
 #include "../component/stats_component.h"
 #include "../../engine/component/transform_component.h"
+#include "../../engine/core/timing_wheel.h"
 #include "../../engine/utils/events.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
@@ -68,6 +69,15 @@ void SkillSystem::onSkillActiveEvent(const game::defs::SkillActiveEvent& event)
 
     // 添加Buff
     addBuff(event.entity_, skill.skill_id_);
+
+    // 治疗脉冲：以施放者为中心治疗半径内的友军 (由战斗结算系统统一结算)
+    auto blueprint_mgr = registry_.ctx().get<std::shared_ptr<game::factory::BlueprintManager>>();
+    const auto& skill_blueprint = blueprint_mgr->getSkillBlueprint(skill.skill_id_);
+    if (skill_blueprint.pulse_.radius_ > 0.0f && skill_blueprint.pulse_heal_ > 0.0f) {
+        const auto& stats = registry_.get<game::component::StatsComponent>(event.entity_);
+        dispatcher_.enqueue(game::defs::AreaEffectEvent{event.entity_, entt::null, transform.position_,
+            skill_blueprint.pulse_.radius_, skill_blueprint.pulse_.falloff_, stats.atk_ * skill_blueprint.pulse_heal_, true, true});
+    }
 }
 
 void SkillSystem::onSkillDurationEndEvent(const game::defs::SkillDurationEndEvent& event) {
@@ -116,7 +126,9 @@ void SkillSystem::addBuff(entt::entity entity, entt::id_type skill_id) {
     stats.atk_ *= buff_blueprint.atk_multiplier_;
     stats.def_ *= buff_blueprint.def_multiplier_;
     stats.range_ *= buff_blueprint.range_multiplier_;
+    const auto old_interval = stats.atk_interval_;
     stats.atk_interval_ *= buff_blueprint.atk_interval_multiplier_;
+    rescaleAttackTimer(stats, old_interval);
     
     // 若存在Cost相关Buff，则添加COST恢复组件
     if (buff_blueprint.cost_regen_ > 0.0f) {
@@ -137,7 +149,9 @@ void SkillSystem::removeBuff(entt::entity entity, entt::id_type skill_id) {
     stats.atk_ /= buff_blueprint.atk_multiplier_;
     stats.def_ /= buff_blueprint.def_multiplier_;
     stats.range_ /= buff_blueprint.range_multiplier_;
+    const auto old_interval = stats.atk_interval_;
     stats.atk_interval_ /= buff_blueprint.atk_interval_multiplier_;
+    rescaleAttackTimer(stats, old_interval);
 
     // 若存在Cost相关Buff，则移除COST恢复组件
     if (buff_blueprint.cost_regen_ > 0.0f) {
@@ -145,4 +159,12 @@ void SkillSystem::removeBuff(entt::entity entity, entt::id_type skill_id) {
     }
 }
 
+void SkillSystem::rescaleAttackTimer(game::component::StatsComponent& stats, float old_interval) {
+    auto& timing_wheel = registry_.ctx().get<engine::core::TimingWheel&>();
+    // 攻击未在冷却中 (已经“可攻击”)，新的间隔会在下次调度时生效
+    if (!timing_wheel.isActive(stats.atk_timer_)) return;
+    const auto elapsed = old_interval - timing_wheel.remaining(stats.atk_timer_);
+    timing_wheel.reschedule(stats.atk_timer_, stats.atk_interval_ - elapsed);
+}
+
 }   // namespace game::system
\ No newline at end of file
@@ -8,6 +8,10 @@ namespace game::factory {
     class EntityFactory;
 }
 
+namespace game::component {
+    struct StatsComponent;
+}
+
 namespace game::system {
 
 /**
@@ -33,6 +37,8 @@ private:
     // Buff增删函数
     void addBuff(entt::entity entity, entt::id_type skill_id);
     void removeBuff(entt::entity entity, entt::id_type skill_id);
+    /// @brief 攻击间隔改变后，按已冷却的时间重新调度攻击计时器 (与之前“计时器累加到新间隔”的效果一致)
+    void rescaleAttackTimer(game::component::StatsComponent& stats, float old_interval);
 };
 
 }   // namespace game::system
\ No newline at end of file
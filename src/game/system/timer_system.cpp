@@ -3,69 +3,139 @@
 #include "../component/skill_component.h"
 #include "../defs/tags.h"
 #include "../defs/events.h"
+#include "../../engine/core/timing_wheel.h"
 #include <entt/entity/registry.hpp>
 #include <entt/signal/dispatcher.hpp>
+#include <entt/core/hashed_string.hpp>
 #include <spdlog/spdlog.h>
 
+using namespace entt::literals;
+
 namespace game::system {
 
-TimerSystem::TimerSystem(entt::registry& registry, entt::dispatcher& dispatcher)
-    : registry_(registry), dispatcher_(dispatcher) {
-}
+TimerSystem::TimerSystem(entt::registry& registry, entt::dispatcher& dispatcher, engine::core::TimingWheel& timing_wheel)
+    : registry_(registry), dispatcher_(dispatcher), timing_wheel_(timing_wheel) {
+    connectSignals();
 
-void TimerSystem::update(float delta_time) {
-    updateAttackTimer(delta_time);
-    updateSkillCooldownTimer(delta_time);
-    updateSkillDurationTimer(delta_time);
-}
+    timing_wheel_.connect<&TimerSystem::onAttackTimer>("attack_cooldown"_hs, this);
+    timing_wheel_.connect<&TimerSystem::onSkillCooldownTimer>("skill_cooldown"_hs, this);
+    timing_wheel_.connect<&TimerSystem::onSkillDurationTimer>("skill_duration"_hs, this);
 
-void TimerSystem::updateAttackTimer(float delta_time) {
-    // 筛选条件：有StatsComponent组件，但没有AttackReadyTag标签（即攻击正在冷却）
+    // 系统创建前已存在的实体不会触发信号，补上它们的计时器
     auto view_unit = registry_.view<game::component::StatsComponent>(entt::exclude<game::defs::AttackReadyTag>);
     for (auto entity : view_unit) {
-        auto& stats = view_unit.get<game::component::StatsComponent>(entity);
-        stats.atk_timer_ += delta_time;     // 推进计时器
-        // 如果攻击计时器大于等于攻击间隔，代表冷却结束。添加“可攻击”标签，并重置攻击计时器
-        if (stats.atk_timer_ >= stats.atk_interval_) {
-            registry_.emplace_or_replace<game::defs::AttackReadyTag>(entity);
-            stats.atk_timer_ = 0.0f;
-        }
+        onStatsConstruct(registry_, entity);
     }
-}
-
-void TimerSystem::updateSkillCooldownTimer(float delta_time) {
-    // 筛选条件：有SkillComponent组件，但没有SkillReadyTag标签（即技能正在冷却），排除被动技能
-    auto view_skill = registry_.view<game::component::SkillComponent>(
-        entt::exclude<game::defs::SkillReadyTag, game::defs::PassiveSkillTag>
-    );
+    auto view_skill = registry_.view<game::component::SkillComponent>(entt::exclude<game::defs::SkillReadyTag>);
     for (auto entity : view_skill) {
-        auto& skill = view_skill.get<game::component::SkillComponent>(entity);
-        skill.cooldown_timer_ += delta_time;
-        // 如果技能冷却计时器大于等于技能冷却时间，代表冷却结束。添加“可施放”标签，并重置技能冷却计时器
-        if (skill.cooldown_timer_ >= skill.cooldown_) {
-            registry_.emplace_or_replace<game::defs::SkillReadyTag>(entity);
-            skill.cooldown_timer_ = 0.0f;
-            // 发送技能准备就绪事件
-            dispatcher_.enqueue(game::defs::SkillReadyEvent{entity});
-        }
+        onSkillConstruct(registry_, entity);
     }
 }
 
-void TimerSystem::updateSkillDurationTimer(float delta_time) {
-    // 筛选条件：有SkillComponent组件，且有SkillActiveTag标签（即技能正在激活中），排除被动技能
-    auto view_skill = registry_.view<game::component::SkillComponent,
-        game::defs::SkillActiveTag>(entt::exclude<game::defs::PassiveSkillTag>);
-    for (auto entity : view_skill) {
-        auto& skill = view_skill.get<game::component::SkillComponent>(entity);
-        skill.duration_timer_ += delta_time;
-        // 如果技能持续计时器大于等于技能持续时间，代表持续结束。移除“技能激活”标签，并重置技能持续计时器
-        if (skill.duration_timer_ >= skill.duration_) {
-            registry_.remove<game::defs::SkillActiveTag>(entity);
-            skill.duration_timer_ = 0.0f;
-            // 发送技能持续结束事件
-            dispatcher_.enqueue(game::defs::SkillDurationEndEvent{entity});
-        }
-    }
+TimerSystem::~TimerSystem() {
+    disconnectSignals();
+
+    timing_wheel_.disconnect("attack_cooldown"_hs);
+    timing_wheel_.disconnect("skill_cooldown"_hs);
+    timing_wheel_.disconnect("skill_duration"_hs);
+}
+
+void TimerSystem::update(float delta_time) {
+    // 推进时间轮，到期的计时器会调用下面的回调
+    timing_wheel_.advance(delta_time);
+}
+
+void TimerSystem::connectSignals() {
+    registry_.on_construct<game::component::StatsComponent>().connect<&TimerSystem::onStatsConstruct>(this);
+    registry_.on_destroy<game::component::StatsComponent>().connect<&TimerSystem::onStatsDestroy>(this);
+    registry_.on_destroy<game::defs::AttackReadyTag>().connect<&TimerSystem::onAttackReadyDestroy>(this);
+    registry_.on_construct<game::component::SkillComponent>().connect<&TimerSystem::onSkillConstruct>(this);
+    registry_.on_destroy<game::component::SkillComponent>().connect<&TimerSystem::onSkillDestroy>(this);
+    registry_.on_destroy<game::defs::SkillReadyTag>().connect<&TimerSystem::onSkillReadyDestroy>(this);
+    registry_.on_construct<game::defs::SkillActiveTag>().connect<&TimerSystem::onSkillActiveConstruct>(this);
+}
+
+void TimerSystem::disconnectSignals() {
+    registry_.on_construct<game::component::StatsComponent>().disconnect(this);
+    registry_.on_destroy<game::component::StatsComponent>().disconnect(this);
+    registry_.on_destroy<game::defs::AttackReadyTag>().disconnect(this);
+    registry_.on_construct<game::component::SkillComponent>().disconnect(this);
+    registry_.on_destroy<game::component::SkillComponent>().disconnect(this);
+    registry_.on_destroy<game::defs::SkillReadyTag>().disconnect(this);
+    registry_.on_construct<game::defs::SkillActiveTag>().disconnect(this);
+}
+
+// --- 注册表信号回调 ---
+void TimerSystem::onStatsConstruct(entt::registry& registry, entt::entity entity) {
+    auto& stats = registry.get<game::component::StatsComponent>(entity);
+    timing_wheel_.cancel(stats.atk_timer_);
+    stats.atk_timer_ = timing_wheel_.schedule(stats.atk_interval_, "attack_cooldown"_hs, entity);
+}
+
+void TimerSystem::onStatsDestroy(entt::registry& registry, entt::entity entity) {
+    auto& stats = registry.get<game::component::StatsComponent>(entity);
+    timing_wheel_.cancel(stats.atk_timer_);
+}
+
+void TimerSystem::onAttackReadyDestroy(entt::registry& registry, entt::entity entity) {
+    // 实体销毁时也会移除标签，此时属性组件可能已经先被移除
+    auto stats = registry.try_get<game::component::StatsComponent>(entity);
+    if (!stats) return;
+    timing_wheel_.cancel(stats->atk_timer_);
+    stats->atk_timer_ = timing_wheel_.schedule(stats->atk_interval_, "attack_cooldown"_hs, entity);
+}
+
+void TimerSystem::onSkillConstruct(entt::registry& registry, entt::entity entity) {
+    auto& skill = registry.get<game::component::SkillComponent>(entity);
+    timing_wheel_.cancel(skill.cooldown_timer_);
+    // 初始技能冷却时间为技能冷却时间的一半 (被动技能的标签此时还未添加，到期时再过滤)
+    skill.cooldown_timer_ = timing_wheel_.schedule(skill.cooldown_ / 2.0f, "skill_cooldown"_hs, entity);
+}
+
+void TimerSystem::onSkillDestroy(entt::registry& registry, entt::entity entity) {
+    auto& skill = registry.get<game::component::SkillComponent>(entity);
+    timing_wheel_.cancel(skill.cooldown_timer_);
+    timing_wheel_.cancel(skill.duration_timer_);
+}
+
+void TimerSystem::onSkillReadyDestroy(entt::registry& registry, entt::entity entity) {
+    auto skill = registry.try_get<game::component::SkillComponent>(entity);
+    if (!skill || registry.all_of<game::defs::PassiveSkillTag>(entity)) return;
+    // 技能施放后 (移除“可施放”标签) 开始新一轮冷却
+    timing_wheel_.cancel(skill->cooldown_timer_);
+    skill->cooldown_timer_ = timing_wheel_.schedule(skill->cooldown_, "skill_cooldown"_hs, entity);
+}
+
+void TimerSystem::onSkillActiveConstruct(entt::registry& registry, entt::entity entity) {
+    auto skill = registry.try_get<game::component::SkillComponent>(entity);
+    if (!skill || registry.all_of<game::defs::PassiveSkillTag>(entity)) return;
+    timing_wheel_.cancel(skill->duration_timer_);
+    skill->duration_timer_ = timing_wheel_.schedule(skill->duration_, "skill_duration"_hs, entity);
+}
+
+// --- 时间轮回调 ---
+void TimerSystem::onAttackTimer(entt::entity entity) {
+    if (!registry_.valid(entity) || !registry_.all_of<game::component::StatsComponent>(entity)) return;
+    // 冷却结束，添加“可攻击”标签
+    registry_.emplace_or_replace<game::defs::AttackReadyTag>(entity);
+}
+
+void TimerSystem::onSkillCooldownTimer(entt::entity entity) {
+    if (!registry_.valid(entity) || !registry_.all_of<game::component::SkillComponent>(entity)) return;
+    if (registry_.any_of<game::defs::SkillReadyTag, game::defs::PassiveSkillTag>(entity)) return;
+    // 冷却结束，添加“可施放”标签
+    registry_.emplace<game::defs::SkillReadyTag>(entity);
+    // 发送技能准备就绪事件
+    dispatcher_.enqueue(game::defs::SkillReadyEvent{entity});
+}
+
+void TimerSystem::onSkillDurationTimer(entt::entity entity) {
+    if (!registry_.valid(entity) || !registry_.all_of<game::defs::SkillActiveTag>(entity)) return;
+    if (registry_.all_of<game::defs::PassiveSkillTag>(entity)) return;
+    // 持续结束，移除“技能激活”标签
+    registry_.remove<game::defs::SkillActiveTag>(entity);
+    // 发送技能持续结束事件
+    dispatcher_.enqueue(game::defs::SkillDurationEndEvent{entity});
 }
 
-}   // namespace game::system
\ No newline at end of file
+}   // namespace game::system
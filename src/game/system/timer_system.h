@@ -3,27 +3,54 @@
 #include <entt/entity/fwd.hpp>
 #include <entt/signal/fwd.hpp>
 
+namespace engine::core {
+    class TimingWheel;
+}
+
 namespace game::system {
 
 /**
- * @brief 计时器系统，用于更新所有包含计时器的组件，
- * 并在满足条件时添加必要的标签，（如攻击冷却完成后，添加“可攻击”标签）。
+ * @brief 计时器系统，负责推进场景的时间轮，
+ * 并在计时器到期时添加必要的标签，（如攻击冷却完成后，添加“可攻击”标签）。
+ *
+ * 计时器只在状态切换时调度一次（通过注册表的组件信号）：
+ * - StatsComponent 创建或 AttackReadyTag 被移除时，调度攻击冷却；
+ * - SkillComponent 创建或 SkillReadyTag 被移除时，调度技能冷却；
+ * - SkillActiveTag 添加时，调度技能持续结束。
+ * 因此每帧的开销只与到期的计时器数量有关，而不再需要遍历所有实体。
  */
 class TimerSystem {
     entt::registry& registry_;
     entt::dispatcher& dispatcher_;
+    engine::core::TimingWheel& timing_wheel_;
 
 public:
-    TimerSystem(entt::registry& registry, entt::dispatcher& dispatcher);
+    TimerSystem(entt::registry& registry, entt::dispatcher& dispatcher, engine::core::TimingWheel& timing_wheel);
+    ~TimerSystem();
 
     void update(float delta_time);
 
+    /**
+     * @brief 连接/断开注册表信号。
+     * @note 恢复快照时组件与时间轮一起恢复，恢复期间需断开信号，避免为恢复的组件重新调度计时器。
+     */
+    void connectSignals();
+    void disconnectSignals();
+
 private:
-    // 拆分逻辑的函数，在update中调用
-    void updateAttackTimer(float delta_time); ///< @brief 处理攻击计时器
-    void updateSkillCooldownTimer(float delta_time); ///< @brief 处理技能冷却计时器
-    void updateSkillDurationTimer(float delta_time); ///< @brief 处理技能持续计时器
-    // TODO: 处理其他计时器
+    // 注册表信号回调：在状态切换时调度计时器
+    void onStatsConstruct(entt::registry& registry, entt::entity entity);       ///< @brief 新单位开始攻击冷却
+    void onStatsDestroy(entt::registry& registry, entt::entity entity);         ///< @brief 取消攻击计时器
+    void onAttackReadyDestroy(entt::registry& registry, entt::entity entity);   ///< @brief 发起攻击后重新开始冷却
+    void onSkillConstruct(entt::registry& registry, entt::entity entity);       ///< @brief 新技能开始冷却
+    void onSkillDestroy(entt::registry& registry, entt::entity entity);         ///< @brief 取消技能计时器
+    void onSkillReadyDestroy(entt::registry& registry, entt::entity entity);    ///< @brief 技能施放后重新开始冷却
+    void onSkillActiveConstruct(entt::registry& registry, entt::entity entity); ///< @brief 技能激活后开始计算持续时间
+
+    // 时间轮回调：计时器到期
+    void onAttackTimer(entt::entity entity);            ///< @brief 攻击冷却结束
+    void onSkillCooldownTimer(entt::entity entity);     ///< @brief 技能冷却结束
+    void onSkillDurationTimer(entt::entity entity);     ///< @brief 技能持续结束
 };
 
-}
\ No newline at end of file
+}
@@ -17,6 +17,7 @@
 #include <entt/signal/dispatcher.hpp>
 #include <spdlog/spdlog.h>
 #include <glm/common.hpp>
+#include <algorithm>
 
 using namespace entt::literals;
 
@@ -52,16 +53,28 @@ void UnitsPortraitUI::update(float delta_time) {
 void UnitsPortraitUI::updatePortraitCover() {
     // 获取game_stats
     auto& game_stats = registry_.ctx().get<game::data::GameStats&>();
-    // 获取anchor_panel中的所有子元素(frame_panel)
-    auto& frame_panels = anchor_panel_->getChildren();
-    for (auto& frame_panel : frame_panels) {
-        // 获取frame_panel中的cover_panel
-        auto cover_panel = frame_panel->getChildById("cover_panel"_hs);
-        // 设置cover_panel的可见性（frame_panel的order_index_已设为出击cost耗费值）
-        if (cover_panel) {
-            cover_panel->setVisible(game_stats.cost_ < frame_panel->getOrderIndex());
+    // 遮盖按cost升序排列，cost足以出击的肖像一定是前缀，只需比较前缀长度
+    auto it = std::partition_point(covers_.begin(), covers_.end(), [&game_stats](const PortraitCover& cover) {
+        return game_stats.cost_ >= cover.cost_;
+    });
+    int affordable_count = static_cast<int>(it - covers_.begin());
+    if (affordable_count == affordable_count_) return;      // 没有跨越任何阈值，UI无需变化
+    affordable_count_ = affordable_count;
+    // 设置cover_panel的可见性（cost不足以出击时显示）
+    for (int i = 0; i < static_cast<int>(covers_.size()); ++i) {
+        covers_[i].cover_panel_->setVisible(i >= affordable_count_);
+    }
+}
+
+void UnitsPortraitUI::collectPortraitCovers() {
+    covers_.clear();
+    // 获取anchor_panel中的所有子元素(frame_panel)，frame_panel的order_index_已设为出击cost耗费值
+    for (auto& frame_panel : anchor_panel_->getChildren()) {
+        if (auto cover_panel = frame_panel->getChildById("cover_panel"_hs); cover_panel) {
+            covers_.push_back({frame_panel->getOrderIndex(), cover_panel});
         }
     }
+    affordable_count_ = -1;     // 强制下次更新时刷新遮盖
 }
 
 void UnitsPortraitUI::createUnitsPortraitUI() {
@@ -148,6 +161,8 @@ void UnitsPortraitUI::createUnitsPortraitUI() {
     
     anchor_panel_->sortChildrenByOrderIndex();  // 对anchor_panel中的子元素(frame_panel)进行排序
     arrangeUnitsPortraitUI();                   // 按顺序排列anchor_panel中的子元素(frame_panel)的位置 
+    // 肖像栏很少变化，缓存为纹理，只在遮盖、悬停状态等变化时重新绘制
+    anchor_panel_->setRenderCached(true);
 }
 
 void UnitsPortraitUI::arrangeUnitsPortraitUI() {
@@ -164,6 +179,7 @@ void UnitsPortraitUI::arrangeUnitsPortraitUI() {
     // 更新panel的size
     anchor_panel_->setSize(glm::vec2(padding + anchor_panel_->getChildren().size() * (frame_size.x + padding), 
                                     frame_size.y + 2 * padding));
+    collectPortraitCovers();
 }
 
 void UnitsPortraitUI::movePortraitPanelRight(float delta_time) {
@@ -188,8 +204,20 @@ void UnitsPortraitUI::movePortraitPanelLeft(float delta_time) {
     anchor_panel_->setPosition(panel_position);
 }
 
+void UnitsPortraitUI::rebuild(const std::vector<entt::id_type>& removed_portraits) {
+    // 移除旧的肖像栏后重新创建，再移除已出击过的单位的肖像
+    ui_manager_.getRootElement()->removeChildById("anchor_panel"_hs);
+    createUnitsPortraitUI();
+    removed_portraits_ = removed_portraits;
+    for (auto name_id : removed_portraits_) {
+        anchor_panel_->removeChildById(name_id);
+    }
+    arrangeUnitsPortraitUI();
+}
+
 void UnitsPortraitUI::onRemoveUIPortraitEvent(const game::defs::RemoveUIPortraitEvent& event) {
     anchor_panel_->removeChildById(event.name_id_);
+    removed_portraits_.push_back(event.name_id_);
     arrangeUnitsPortraitUI();
 }
 
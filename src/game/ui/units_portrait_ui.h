@@ -3,12 +3,14 @@
 #include "../defs/events.h"
 #include <entt/entity/fwd.hpp>
 #include <glm/vec2.hpp>
+#include <vector>
 
 namespace engine::core {
     class Context;
 }
 
 namespace engine::ui {
+    class UIElement;
     class UIPanel;
     class UIManager;
 }
@@ -28,6 +30,15 @@ class UnitsPortraitUI {
 
     engine::ui::UIPanel* anchor_panel_;     ///< @brief 保存单位肖像UI的根面板(非拥有指针)，方便使用
 
+    /// @brief 肖像遮盖，按出击cost升序排列 (与anchor_panel_中frame_panel的顺序一致)
+    struct PortraitCover {
+        int cost_;
+        engine::ui::UIElement* cover_panel_;    ///< @brief 非拥有指针
+    };
+    std::vector<PortraitCover> covers_;
+    int affordable_count_{-1};              ///< @brief 当前cost足以出击的肖像数量，只有跨越阈值时才更新遮盖
+    std::vector<entt::id_type> removed_portraits_;  ///< @brief 已移除的肖像(单位名称ID)，按移除顺序 (保存快照用)
+
 public:
     /**
      * @brief 构造函数
@@ -43,9 +54,17 @@ public:
     void update(float delta_time);
 
     engine::ui::UIPanel* getAnchorPanel() const { return anchor_panel_; }
+    const std::vector<entt::id_type>& getRemovedPortraits() const { return removed_portraits_; }
+
+    /**
+     * @brief 重建肖像栏并移除指定的肖像 (恢复快照时调用)
+     * @param removed_portraits 需要移除的肖像(单位名称ID)
+     */
+    void rebuild(const std::vector<entt::id_type>& removed_portraits);
 
 private:
-    void updatePortraitCover();         ///< @brief 更新肖像遮盖
+    void updatePortraitCover();         ///< @brief 更新肖像遮盖 (cost跨越某个肖像的出击阈值时)
+    void collectPortraitCovers();       ///< @brief 收集肖像遮盖（肖像增/减时调用）
     void createUnitsPortraitUI();       ///< @brief 创建单位肖像UI
     void arrangeUnitsPortraitUI();      ///< @brief 排列单位肖像UI（肖像增/减时调用）
 
@@ -1,22 +1,111 @@
 #include "engine/core/game_app.h"
 #include "engine/core/context.h"
 #include "game/scene/title_scene.h"
+#include "game/scene/game_scene.h"
+#include "game/data/level_config.h"
+#include "game/data/session_data.h"
+#include "game/data/stress_config.h"
+#include "game/loader/stress_level_generator.h"
 #include "engine/utils/events.h"
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL_main.h>
 #include <entt/signal/dispatcher.hpp>
 
+/*
+ * 命令行参数 (均为可选)：
+ *   --stress [配置路径]   直接进入程序生成的压力测试关卡 (默认配置 assets/data/stress_config.json)
+ *   --headless           无窗口运行 (不显示画面、不输出声音、不限制帧率)
+ *   --frames N           运行 N 帧后退出，并输出帧时长统计
+ */
+namespace {
+
+struct CommandLine {
+    engine::core::LaunchOptions launch_options_;
+    bool stress_ = false;
+    std::string stress_config_path_{"assets/data/stress_config.json"};
+};
+
+bool parseCommandLine(int argc, char* argv[], CommandLine& command_line) {
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--stress") {
+            command_line.stress_ = true;
+            // 配置路径可以省略
+            if (i + 1 < argc && !std::string_view(argv[i + 1]).starts_with("--")) {
+                command_line.stress_config_path_ = argv[++i];
+            }
+        } else if (arg == "--headless") {
+            command_line.launch_options_.headless_ = true;
+        } else if (arg == "--frames" && i + 1 < argc) {
+            try {
+                command_line.launch_options_.max_frames_ = std::max(0, std::stoi(argv[++i]));
+            } catch (const std::exception&) {
+                spdlog::error("invalid frame count: {}", argv[i]);
+                return false;
+            }
+        } else {
+            spdlog::error("unknown argument: {}", arg);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
 void setupInitialScene(engine::core::Context& context) {
     // GameApp在调用run方法之前，先创建并设置初始场景
     auto title_scene = std::make_unique<game::scene::TitleScene>(context);
     context.getDispatcher().trigger<engine::utils::PushSceneEvent>(engine::utils::PushSceneEvent{std::move(title_scene)});
 }
 
-int main(int /* argc */, char* /* argv */[]) {
+/**
+ * @brief 压力测试：按配置生成地图与关卡数据 (作为唯一的一关)，然后直接进入游戏场景
+ * @return 初始场景设置函数，生成失败时返回空函数
+ */
+std::function<void(engine::core::Context&)> makeStressSceneSetup(std::string_view config_path) {
+    game::data::StressConfig stress_config;
+    if (!stress_config.loadFromFile(config_path)) return {};
+
+    game::data::LevelData level_data;
+    game::loader::StressLevelGenerator generator(stress_config);
+    if (!generator.generate(level_data)) return {};
+
+    auto level_config = std::make_shared<game::data::LevelConfig>();
+    level_config->addLevel(std::move(level_data));
+    auto session_data = std::make_shared<game::data::SessionData>();
+    if (!session_data->loadDefaultData()) return {};
+
+    return [level_config, session_data](engine::core::Context& context) {
+        auto game_scene = std::make_unique<game::scene::GameScene>(context, nullptr, session_data, nullptr, level_config);
+        context.getDispatcher().trigger<engine::utils::PushSceneEvent>(engine::utils::PushSceneEvent{std::move(game_scene)});
+    };
+}
+
+int main(int argc, char* argv[]) {
     spdlog::set_level(spdlog::level::info);
 
+    CommandLine command_line;
+    if (!parseCommandLine(argc, argv, command_line)) return 1;
+
     engine::core::GameApp app;
-    app.registerSceneSetup(setupInitialScene);
+    app.setLaunchOptions(command_line.launch_options_);
+    if (command_line.stress_) {
+        auto stress_setup = makeStressSceneSetup(command_line.stress_config_path_);
+        if (!stress_setup) {
+            spdlog::error("generate stress level failed");
+            return 1;
+        }
+        app.registerSceneSetup(std::move(stress_setup));
+    } else {
+        app.registerSceneSetup(setupInitialScene);
+    }
     app.run();
     return 0;
-}
\ No newline at end of file
+}